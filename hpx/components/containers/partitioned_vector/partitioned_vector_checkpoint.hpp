@@ -0,0 +1,405 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#ifndef HPX_PARTITIONED_VECTOR_CHECKPOINT_HPP
+#define HPX_PARTITIONED_VECTOR_CHECKPOINT_HPP
+
+/// \brief Full and incremental (delta) checkpoints of a partitioned_vector.
+///
+/// A full checkpoint stores the data of all segments of a partitioned_vector.
+/// A delta checkpoint is taken relative to a previous (full or delta)
+/// checkpoint of the same vector and stores only the segments which were
+/// modified since. Every checkpoint is serializable, it can be stored using
+/// hpx::util::save_checkpoint or hpx::util::save_checkpoint_file.
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A full or incremental checkpoint of a partitioned_vector.
+    template <typename T, typename Data = std::vector<T> >
+    class partitioned_vector_checkpoint
+    {
+    public:
+        typedef Data data_type;
+
+        partitioned_vector_checkpoint()
+          : is_delta_(false)
+        {}
+
+        partitioned_vector_checkpoint(bool is_delta,
+                std::vector<naming::gid_type> && ids,
+                std::vector<std::uint64_t> && modification_counts,
+                std::vector<std::uint64_t> && previous_modification_counts,
+                std::vector<std::size_t> && segments,
+                std::vector<data_type> && data)
+          : is_delta_(is_delta)
+          , ids_(std::move(ids))
+          , modification_counts_(std::move(modification_counts))
+          , previous_modification_counts_(
+                std::move(previous_modification_counts))
+          , segments_(std::move(segments))
+          , data_(std::move(data))
+        {
+            HPX_ASSERT(ids_.size() == modification_counts_.size());
+            HPX_ASSERT(segments_.size() == data_.size());
+        }
+
+        /// Return whether this is a delta checkpoint
+        bool is_delta() const
+        {
+            return is_delta_;
+        }
+
+        /// Return the number of segments of the checkpointed vector
+        std::size_t num_segments() const
+        {
+            return modification_counts_.size();
+        }
+
+        /// Return the (sorted) sequence numbers of the segments whose data is
+        /// stored in this checkpoint
+        std::vector<std::size_t> const& get_stored_segments() const
+        {
+            return segments_;
+        }
+
+        /// Return the number of segments whose data is stored in this
+        /// checkpoint
+        std::size_t get_num_stored_segments() const
+        {
+            return data_.size();
+        }
+
+        /// Return the data stored for the n-th stored segment
+        data_type const& get_segment_data(std::size_t n) const
+        {
+            HPX_ASSERT(n < data_.size());
+            return data_[n];
+        }
+
+        /// Return the (stripped) global ids of the checkpointed segments
+        std::vector<naming::gid_type> const& get_ids() const
+        {
+            return ids_;
+        }
+
+        /// Return the modification counters of all segments at the point the
+        /// checkpoint was taken
+        std::vector<std::uint64_t> const& get_modification_counts() const
+        {
+            return modification_counts_;
+        }
+
+        /// Return the modification counters of the checkpoint this delta
+        /// checkpoint was taken relative to
+        std::vector<std::uint64_t> const&
+        get_previous_modification_counts() const
+        {
+            return previous_modification_counts_;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & is_delta_ & ids_ & modification_counts_ &
+                previous_modification_counts_ & segments_ & data_;
+        }
+
+        bool is_delta_;
+        std::vector<naming::gid_type> ids_;
+        std::vector<std::uint64_t> modification_counts_;
+        std::vector<std::uint64_t> previous_modification_counts_;
+        std::vector<std::size_t> segments_;
+        std::vector<data_type> data_;
+    };
+
+    namespace detail
+    {
+        template <typename T, typename Data>
+        hpx::future<partitioned_vector_checkpoint<T, Data> >
+        save_partitioned_vector_checkpoint(
+            partitioned_vector<T, Data> const& v,
+            partitioned_vector_checkpoint<T, Data> const* previous)
+        {
+            typedef partitioned_vector_partition<T, Data> partition_type;
+            typedef partitioned_vector_checkpoint<T, Data> checkpoint_type;
+
+            std::vector<partition_type> partitions;
+            std::vector<naming::gid_type> ids;
+            for (auto it = v.segment_cbegin(); it != v.segment_cend(); ++it)
+            {
+                partitions.push_back(partition_type(it->get_id()));
+                ids.push_back(
+                    naming::detail::get_stripped_gid(it->get_id().get_gid()));
+            }
+
+            std::vector<std::uint64_t> previous_counts;
+            if (previous != nullptr)
+            {
+                if (previous->get_ids() != ids)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "hpx::save_partitioned_vector_checkpoint",
+                        "the previous checkpoint was not taken from the "
+                        "given partitioned_vector");
+                }
+                previous_counts = previous->get_modification_counts();
+            }
+
+            // The modification counters of all segments are retrieved before
+            // any data is copied. A segment modified after its counter was
+            // read will be considered to be modified by the next delta.
+            std::vector<hpx::future<std::uint64_t> > counts;
+            counts.reserve(partitions.size());
+            for (partition_type const& part : partitions)
+                counts.push_back(part.get_modification_count());
+
+            bool is_delta = previous != nullptr;
+            return hpx::when_all(counts).then(
+                [is_delta, partitions, ids, previous_counts](
+                    hpx::future<std::vector<hpx::future<std::uint64_t> > > f)
+                ->  hpx::future<checkpoint_type>
+                {
+                    std::vector<hpx::future<std::uint64_t> > fs = f.get();
+
+                    std::vector<std::uint64_t> counts;
+                    std::vector<std::size_t> segments;
+                    std::vector<hpx::future<Data> > data;
+
+                    counts.reserve(fs.size());
+                    for (std::size_t i = 0; i != fs.size(); ++i)
+                    {
+                        counts.push_back(fs[i].get());
+                        if (!is_delta || counts[i] != previous_counts[i])
+                        {
+                            segments.push_back(i);
+                            data.push_back(partitions[i].get_copied_data());
+                        }
+                    }
+
+                    return hpx::when_all(data).then(
+                        [is_delta, ids, counts, previous_counts, segments](
+                            hpx::future<std::vector<hpx::future<Data> > > f)
+                        ->  checkpoint_type
+                        {
+                            std::vector<hpx::future<Data> > fs = f.get();
+
+                            std::vector<Data> data;
+                            data.reserve(fs.size());
+                            for (hpx::future<Data>& d : fs)
+                                data.push_back(d.get());
+
+                            return checkpoint_type(is_delta,
+                                std::vector<naming::gid_type>(ids),
+                                std::vector<std::uint64_t>(counts),
+                                std::vector<std::uint64_t>(previous_counts),
+                                std::vector<std::size_t>(segments),
+                                std::move(data));
+                        });
+                });
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Take a full checkpoint of the given partitioned_vector.
+    ///
+    /// \param v    The partitioned_vector to checkpoint
+    ///
+    /// \returns A future referring to the checkpoint holding the data of all
+    ///          segments of \a v.
+    ///
+    /// \note The vector must not be modified concurrently.
+    ///
+    template <typename T, typename Data>
+    hpx::future<partitioned_vector_checkpoint<T, Data> >
+    save_partitioned_vector_checkpoint(partitioned_vector<T, Data> const& v)
+    {
+        return detail::save_partitioned_vector_checkpoint(v,
+            static_cast<partitioned_vector_checkpoint<T, Data> const*>(nullptr));
+    }
+
+    /// Take a delta checkpoint of the given partitioned_vector.
+    ///
+    /// \param v        The partitioned_vector to checkpoint
+    /// \param previous The last checkpoint (full or delta) taken from \a v
+    ///
+    /// \returns A future referring to the checkpoint holding the data of the
+    ///          segments of \a v which were modified since \a previous was
+    ///          taken.
+    ///
+    /// \note Segments are considered to be modified whenever they were
+    ///       accessed through a modifying operation, even if no element was
+    ///       changed. Segments for which non-const access to their data was
+    ///       handed out (local views, local iterators) are stored by every
+    ///       delta until release_mutable_access() is called for them. The
+    ///       vector must not be modified concurrently.
+    ///
+    template <typename T, typename Data>
+    hpx::future<partitioned_vector_checkpoint<T, Data> >
+    save_partitioned_vector_checkpoint(partitioned_vector<T, Data> const& v,
+        partitioned_vector_checkpoint<T, Data> const& previous)
+    {
+        return detail::save_partitioned_vector_checkpoint(v, &previous);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore a partitioned_vector from a full checkpoint and a sequence of
+    /// delta checkpoints.
+    ///
+    /// \param v        The partitioned_vector to restore the data into. It
+    ///                 must have the same layout as the checkpointed vector.
+    /// \param base     The full checkpoint to restore
+    /// \param deltas   The delta checkpoints taken after \a base, in the
+    ///                 order they were taken
+    ///
+    /// \returns A future which becomes ready once all segments of \a v have
+    ///          been restored.
+    ///
+    /// \note Restoring a vector modifies all of its segments, a new full
+    ///       checkpoint should be taken before taking further deltas.
+    ///
+    template <typename T, typename Data>
+    hpx::future<void> restore_partitioned_vector_checkpoint(
+        partitioned_vector<T, Data>& v,
+        partitioned_vector_checkpoint<T, Data> const& base,
+        std::vector<partitioned_vector_checkpoint<T, Data> > const& deltas =
+            std::vector<partitioned_vector_checkpoint<T, Data> >())
+    {
+        typedef partitioned_vector_checkpoint<T, Data> checkpoint_type;
+
+        if (base.is_delta())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::restore_partitioned_vector_checkpoint",
+                "the base checkpoint must be a full checkpoint");
+        }
+
+        checkpoint_type const* previous = &base;
+        for (checkpoint_type const& delta : deltas)
+        {
+            if (!delta.is_delta() || delta.get_ids() != previous->get_ids() ||
+                delta.get_previous_modification_counts() !=
+                    previous->get_modification_counts())
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_data,
+                    "hpx::restore_partitioned_vector_checkpoint",
+                    "the delta checkpoints do not form a sequence starting "
+                    "at the base checkpoint");
+            }
+            previous = &delta;
+        }
+
+        std::size_t num_segments = std::distance(
+            v.segment_cbegin(), v.segment_cend());
+        if (num_segments != base.num_segments())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                "hpx::restore_partitioned_vector_checkpoint",
+                "the number of segments of the partitioned_vector does not "
+                "match the checkpoint");
+        }
+
+        // find the most recent data for every segment, the checkpoints may
+        // have been read from a corrupted file
+        std::vector<Data const*> latest(num_segments, nullptr);
+
+        auto collect =
+            [&latest, num_segments](checkpoint_type const& c)
+            {
+                std::vector<std::size_t> const& segments =
+                    c.get_stored_segments();
+                if (c.num_segments() != num_segments ||
+                    c.get_ids().size() != num_segments ||
+                    segments.size() != c.get_num_stored_segments())
+                {
+                    HPX_THROW_EXCEPTION(hpx::invalid_data,
+                        "hpx::restore_partitioned_vector_checkpoint",
+                        "the checkpoint is inconsistent");
+                }
+
+                for (std::size_t i = 0; i != segments.size(); ++i)
+                {
+                    if (segments[i] >= num_segments)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::invalid_data,
+                            "hpx::restore_partitioned_vector_checkpoint",
+                            "the checkpoint stores data for a segment which "
+                            "does not exist");
+                    }
+                    latest[segments[i]] = &c.get_segment_data(i);
+                }
+            };
+
+        collect(base);
+        for (Data const* d : latest)
+        {
+            if (d == nullptr)
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_data,
+                    "hpx::restore_partitioned_vector_checkpoint",
+                    "the base checkpoint does not store the data of all "
+                    "segments");
+            }
+        }
+
+        for (checkpoint_type const& delta : deltas)
+            collect(delta);
+
+        std::size_t i = 0;
+        for (auto it = v.segment_cbegin(); it != v.segment_cend(); ++it, ++i)
+        {
+            HPX_ASSERT(latest[i] != nullptr);
+            if (latest[i]->size() != it->size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::restore_partitioned_vector_checkpoint",
+                    "the size of a segment of the partitioned_vector does "
+                    "not match the checkpoint");
+            }
+        }
+
+        std::vector<hpx::future<void> > results;
+        results.reserve(num_segments);
+
+        i = 0;
+        for (auto it = v.segment_cbegin(); it != v.segment_cend(); ++it, ++i)
+        {
+            results.push_back(partitioned_vector_partition<T, Data>(
+                it->get_id()).set_data(Data(*latest[i])));
+        }
+
+        return hpx::when_all(results).then(
+            [](hpx::future<std::vector<hpx::future<void> > > f)
+            {
+                std::vector<hpx::future<void> > fs = f.get();
+                for (hpx::future<void>& r : fs)
+                    r.get();
+            });
+    }
+}
+
+#endif
@@ -24,10 +24,14 @@
 #include <hpx/runtime/components/server/component_base.hpp>
 #include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -38,6 +42,33 @@
 
 namespace hpx { namespace server
 {
+    /// \brief A contiguous range of elements of a
+    ///        partitioned_vector_partition component.
+    struct partitioned_vector_range
+    {
+        partitioned_vector_range()
+          : first_(0), count_(0)
+        {}
+
+        partitioned_vector_range(hpx::id_type const& partition,
+                std::size_t first, std::size_t count)
+          : partition_(partition), first_(first), count_(count)
+        {}
+
+        hpx::id_type partition_;
+        std::size_t first_;
+        std::size_t count_;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & partition_ & first_ & count_;
+        }
+    };
+
     /// \brief This is the basic wrapper class for stl vector.
     ///
     /// This contain the implementation of the partitioned_vector_partition's
@@ -174,6 +205,32 @@ namespace hpx { namespace server
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return the \a count elements starting at position \a first in the
+        /// partitioned_vector_partition container.
+        ///
+        /// \param first Position of the first element to return
+        /// \param count Number of elements to return
+        ///
+        /// \return Return the values of the elements in the given range.
+        ///
+        std::vector<T> get_range(size_type first, size_type count) const;
+
+        /// Return \a count blocks of \a block_size consecutive elements
+        /// each, the first block starts at position \a first, consecutive
+        /// blocks start \a stride elements apart. The blocks are returned
+        /// packed into a single sequence.
+        ///
+        /// \param first      Position of the first element to return
+        /// \param count      Number of blocks to return
+        /// \param block_size Number of elements in each block
+        /// \param stride     Distance between the first elements of two
+        ///                   consecutive blocks
+        ///
+        /// \return Return the values of the elements in the given blocks.
+        ///
+        std::vector<T> get_blocks(size_type first, size_type count,
+            size_type block_size, size_type stride) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -240,11 +297,53 @@ namespace hpx { namespace server
         void set_values(std::vector<size_type> const& pos,
             std::vector<T> const& val);
 
+        /// Copy the elements of the given ranges of (other)
+        /// partitioned_vector_partition components into consecutive
+        /// elements of this partitioned_vector_partition, starting at
+        /// position \a pos. All ranges are fetched concurrently.
+        ///
+        /// \param pos    Position of the first element to overwrite
+        /// \param ranges The ranges to copy, in order
+        ///
+        void copy_ranges(size_type pos,
+            std::vector<partitioned_vector_range> const& ranges);
+
         /// Remove all elements from the vector leaving the
         /// partitioned_vector_partition with size 0.
         ///
         void clear();
 
+        ///////////////////////////////////////////////////////////////////////
+        // Modification tracking
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the number of (potential) modifications of the
+        /// partitioned_vector_partition.
+        ///
+        /// The counter is incremented by every modifying operation. Two
+        /// equal values imply that the data was not changed in between.
+        ///
+        /// Handing out non-const access to the underlying data (get_data(),
+        /// begin(), end()) marks the partition as being accessible for
+        /// writing, which can't be tracked afterwards. While this is the
+        /// case every call returns a new value, i.e. the partition is always
+        /// considered to be modified, until release_mutable_access() is
+        /// called. Direct modifications of partitioned_vector_partition_ are
+        /// not tracked, use mark_modified() in this case.
+        ///
+        std::uint64_t get_modification_count() const;
+
+        /// Record a modification of the data which was done without going
+        /// through the API of this component.
+        void mark_modified();
+
+        /// Declare that no reference or iterator obtained through non-const
+        /// access to the data (get_data(), begin(), end()) is used for
+        /// writing anymore. Modifications done through those are accounted
+        /// for, subsequent calls to get_modification_count() return equal
+        /// values until the partition is modified again.
+        void release_mutable_access();
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, size);
 
@@ -258,6 +357,8 @@ namespace hpx { namespace server
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_range);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_blocks);
 
 //         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front);
 //         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back);
@@ -267,10 +368,21 @@ namespace hpx { namespace server
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_values);
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, copy_ranges);
 
 //         HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_data);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partitioned_vector, get_modification_count);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partitioned_vector, release_mutable_access);
+
+    private:
+        void mark_mutable_access();
+
+        mutable std::atomic<std::uint64_t> modification_count_;
+        std::atomic<bool> mutable_access_;
     };
 }}
 
@@ -289,10 +401,16 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_get_value_action_, name));                        \
     HPX_REGISTER_ACTION_DECLARATION(type::get_values_action,                  \
         HPX_PP_CAT(__vector_get_values_action_, name));                       \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_range_action,                   \
+        HPX_PP_CAT(__vector_get_range_action_, name));                        \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_blocks_action,                  \
+        HPX_PP_CAT(__vector_get_blocks_action_, name));                       \
     HPX_REGISTER_ACTION_DECLARATION(type::set_value_action,                   \
         HPX_PP_CAT(__vector_set_value_action_, name));                        \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                  \
         HPX_PP_CAT(__vector_set_values_action_, name));                       \
+    HPX_REGISTER_ACTION_DECLARATION(type::copy_ranges_action,                 \
+        HPX_PP_CAT(__vector_copy_ranges_action_, name));                      \
     HPX_REGISTER_ACTION_DECLARATION(type::size_action,                        \
         HPX_PP_CAT(__vector_size_action_, name));                             \
     HPX_REGISTER_ACTION_DECLARATION(type::resize_action,                      \
@@ -301,6 +419,10 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_get_copied_data_action_, name));                  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_data_action,                    \
         HPX_PP_CAT(__vector_set_data_action_, name));                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_modification_count_action,      \
+        HPX_PP_CAT(__vector_get_modification_count_action_, name));           \
+    HPX_REGISTER_ACTION_DECLARATION(type::release_mutable_access_action,      \
+        HPX_PP_CAT(__vector_release_mutable_access_action_, name));           \
 /**/
 
 #define HPX_REGISTER_VECTOR_DECLARATION_1(type)                               \
@@ -456,6 +578,63 @@ namespace hpx
         future<std::vector<T> >
         get_values(std::vector<std::size_t> const& pos) const;
 
+        /// Returns the \a count elements starting at position \a first in
+        /// the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element to return
+        /// \param count Number of elements to return
+        ///
+        /// \return Returns the values of the elements in the given range
+        ///
+        std::vector<T> get_range(launch::sync_policy, std::size_t first,
+            std::size_t count) const;
+
+        /// Returns the \a count elements starting at position \a first in
+        /// the partitioned_vector_partition component.
+        ///
+        /// \param first Position of the first element to return
+        /// \param count Number of elements to return
+        ///
+        /// \return This returns the values as an hpx::future
+        ///
+        future<std::vector<T> > get_range(std::size_t first,
+            std::size_t count) const;
+
+        /// Returns \a count blocks of \a block_size consecutive elements
+        /// each from the partitioned_vector_partition component, the first
+        /// block starts at position \a first, consecutive blocks start
+        /// \a stride elements apart.
+        ///
+        /// \param first      Position of the first element to return
+        /// \param count      Number of blocks to return
+        /// \param block_size Number of elements in each block
+        /// \param stride     Distance between the first elements of two
+        ///                   consecutive blocks
+        ///
+        /// \return Returns the values of the elements in the given blocks
+        ///         packed into a single sequence
+        ///
+        std::vector<T> get_blocks(launch::sync_policy, std::size_t first,
+            std::size_t count, std::size_t block_size,
+            std::size_t stride) const;
+
+        /// Returns \a count blocks of \a block_size consecutive elements
+        /// each from the partitioned_vector_partition component, the first
+        /// block starts at position \a first, consecutive blocks start
+        /// \a stride elements apart.
+        ///
+        /// \param first      Position of the first element to return
+        /// \param count      Number of blocks to return
+        /// \param block_size Number of elements in each block
+        /// \param stride     Distance between the first elements of two
+        ///                   consecutive blocks
+        ///
+        /// \return This returns the packed values as an hpx::future
+        ///
+        future<std::vector<T> > get_blocks(std::size_t first,
+            std::size_t count, std::size_t block_size,
+            std::size_t stride) const;
+
 //         future<T> front_async() const
 //         {
 //             HPX_ASSERT(this->get_id());
@@ -538,6 +717,28 @@ namespace hpx
         future<void> set_values(std::vector<std::size_t> const& pos,
             std::vector<T> const& val);
 
+        /// Copy the elements of the given ranges of (other)
+        /// partitioned_vector_partition components into consecutive
+        /// elements of this component, starting at position \a pos.
+        ///
+        /// \param pos    Position of the first element to overwrite
+        /// \param ranges The ranges to copy, in order
+        ///
+        void copy_ranges(launch::sync_policy, std::size_t pos,
+            std::vector<server::partitioned_vector_range> const& ranges);
+
+        /// Copy the elements of the given ranges of (other)
+        /// partitioned_vector_partition components into consecutive
+        /// elements of this component, starting at position \a pos.
+        ///
+        /// \param pos    Position of the first element to overwrite
+        /// \param ranges The ranges to copy, in order
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> copy_ranges(std::size_t pos,
+            std::vector<server::partitioned_vector_range> const& ranges);
+
 //         void clear()
 //         {
 //             HPX_ASSERT(this->get_id());
@@ -573,6 +774,35 @@ namespace hpx
         ///
         hpx::future<void> set_data(
             typename server_type::data_type&& other) const;
+
+        /// Returns the modification counter of the
+        /// partitioned_vector_partition component.
+        ///
+        /// \return This returns the number of (potential) modifications of
+        ///         the data of the partitioned_vector_partition
+        ///
+        std::uint64_t get_modification_count(launch::sync_policy) const;
+
+        /// Returns the modification counter of the
+        /// partitioned_vector_partition component.
+        ///
+        /// \return This returns the counter as an hpx::future
+        ///
+        hpx::future<std::uint64_t> get_modification_count() const;
+
+        /// Declares that no reference or iterator obtained through non-const
+        /// access to the data of the partitioned_vector_partition component
+        /// is used for writing anymore.
+        ///
+        void release_mutable_access(launch::sync_policy) const;
+
+        /// Declares that no reference or iterator obtained through non-const
+        /// access to the data of the partitioned_vector_partition component
+        /// is used for writing anymore.
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        hpx::future<void> release_mutable_access() const;
     };
 }
 
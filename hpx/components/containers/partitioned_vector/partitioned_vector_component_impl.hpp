@@ -8,6 +8,8 @@
 #define HPX_PARTITIONED_VECTOR_COMPONENT_IMPL_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
@@ -18,11 +20,15 @@
 #include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -36,6 +42,8 @@ namespace hpx { namespace server
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector()
+      : modification_count_(0)
+      , mutable_access_(false)
     {
         HPX_ASSERT(false);    // shouldn't ever be called
     }
@@ -44,6 +52,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(size_type partition_size)
       : partitioned_vector_partition_(partition_size)
+      , modification_count_(0)
+      , mutable_access_(false)
     {
     }
 
@@ -52,6 +62,8 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::partitioned_vector(
         size_type partition_size, T const& val)
       : partitioned_vector_partition_(partition_size, val)
+      , modification_count_(0)
+      , mutable_access_(false)
     {
     }
 
@@ -60,6 +72,8 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::partitioned_vector(
         size_type partition_size, T const& val, allocator_type const& alloc)
       : partitioned_vector_partition_(partition_size, val, alloc)
+      , modification_count_(0)
+      , mutable_access_(false)
     {
     }
 
@@ -69,6 +83,8 @@ namespace hpx { namespace server
         partitioned_vector const& rhs)
       : base_type(rhs)
       , partitioned_vector_partition_(rhs.partitioned_vector_partition_)
+      , modification_count_(rhs.modification_count_.load())
+      , mutable_access_(rhs.mutable_access_.load())
     {
     }
 
@@ -78,6 +94,8 @@ namespace hpx { namespace server
       : base_type(std::move(rhs))
       , partitioned_vector_partition_(
             std::move(rhs.partitioned_vector_partition_))
+      , modification_count_(rhs.modification_count_.load())
+      , mutable_access_(rhs.mutable_access_.load())
     {
     }
 
@@ -87,6 +105,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::data_type&
         partitioned_vector<T, Data>::get_data()
     {
+        mark_mutable_access();
         return partitioned_vector_partition_;
     }
 
@@ -110,6 +129,7 @@ namespace hpx { namespace server
     void partitioned_vector<T, Data>::set_data(data_type&& other)
     {
         partitioned_vector_partition_ = std::move(other);
+        mark_modified();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -118,6 +138,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::iterator_type
         partitioned_vector<T, Data>::begin()
     {
+        mark_mutable_access();
         return partitioned_vector_partition_.begin();
     }
 
@@ -142,6 +163,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::iterator_type
         partitioned_vector<T, Data>::end()
     {
+        mark_mutable_access();
         return partitioned_vector_partition_.end();
     }
 
@@ -198,6 +220,7 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::resize(size_type n, T const& val)
     {
         partitioned_vector_partition_.resize(n, val);
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -228,6 +251,57 @@ namespace hpx { namespace server
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector<T, Data>::get_range(
+        size_type first, size_type count) const
+    {
+        size_type size = partitioned_vector_partition_.size();
+        if (first > size || count > size - first)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "server::partitioned_vector::get_range",
+                "the requested range exceeds the size of the partition");
+        }
+
+        const_iterator_type it = partitioned_vector_partition_.begin() + first;
+        return std::vector<T>(it, it + count);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector<T, Data>::get_blocks(size_type first, size_type count,
+        size_type block_size, size_type stride) const
+    {
+        std::vector<T> result;
+
+        // the last block has to end inside of this partition and the packed
+        // blocks have to fit into the result, the checks are arranged such
+        // that they cannot overflow
+        size_type size = partitioned_vector_partition_.size();
+        if (count != 0 &&
+            (first > size || block_size > size - first ||
+                (stride != 0 &&
+                    count - 1 > (size - first - block_size) / stride) ||
+                (block_size != 0 &&
+                    count > result.max_size() / block_size)))
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "server::partitioned_vector::get_blocks",
+                "the requested blocks exceed the size of the partition");
+        }
+
+        result.reserve(count * block_size);
+
+        const_iterator_type begin = partitioned_vector_partition_.begin();
+        for (size_type i = 0; i != count; ++i)
+        {
+            const_iterator_type it = begin + (first + i * stride);
+            result.insert(result.end(), it, it + block_size);
+        }
+        return result;
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -248,6 +322,7 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::assign(size_type n, T const& val)
     {
         partitioned_vector_partition_.assign(n, val);
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -255,6 +330,7 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::push_back(T const& val)
     {
         partitioned_vector_partition_.push_back(val);
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -262,6 +338,7 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::pop_back()
     {
         partitioned_vector_partition_.pop_back();
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -269,6 +346,7 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::set_value(size_type pos, T const& val)
     {
         partitioned_vector_partition_[pos] = val;
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -281,6 +359,54 @@ namespace hpx { namespace server
 
         for (std::size_t i = 0; i != pos.size(); ++i)
             partitioned_vector_partition_[pos[i]] = val[i];
+        mark_modified();
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::copy_ranges(size_type pos,
+        std::vector<partitioned_vector_range> const& ranges)
+    {
+        // all ranges have to fit into this partition, starting at pos
+        size_type size = partitioned_vector_partition_.size();
+        if (pos > size)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "server::partitioned_vector::copy_ranges",
+                "the target position exceeds the size of the partition");
+        }
+
+        size_type last = pos;
+        for (partitioned_vector_range const& r : ranges)
+        {
+            if (r.count_ > size - last)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "server::partitioned_vector::copy_ranges",
+                    "the copied ranges exceed the size of the partition");
+            }
+            last += r.count_;
+        }
+
+        std::vector<hpx::future<std::vector<T> > > values;
+        values.reserve(ranges.size());
+
+        for (partitioned_vector_range const& r : ranges)
+        {
+            values.push_back(hpx::async<get_range_action>(
+                r.partition_, r.first_, r.count_));
+        }
+
+        for (hpx::future<std::vector<T> >& f : values)
+        {
+            std::vector<T> v = f.get();
+            HPX_ASSERT(pos + v.size() <= partitioned_vector_partition_.size());
+
+            std::move(v.begin(), v.end(),
+                partitioned_vector_partition_.begin() + pos);
+            pos += v.size();
+        }
+        mark_modified();
     }
 
     template <typename T, typename Data>
@@ -288,6 +414,47 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::clear()
     {
         partitioned_vector_partition_.clear();
+        mark_modified();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::uint64_t
+    partitioned_vector<T, Data>::get_modification_count() const
+    {
+        // the data may have been written through handed out references or
+        // iterators at any point
+        if (mutable_access_.load(std::memory_order_acquire))
+        {
+            return modification_count_.fetch_add(
+                1, std::memory_order_acq_rel) + 1;
+        }
+
+        return modification_count_.load(std::memory_order_acquire);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::mark_modified()
+    {
+        modification_count_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::release_mutable_access()
+    {
+        // account for the writes done so far before clearing the flag, a
+        // concurrent reader sees either the flag or the new counter value
+        mark_modified();
+        mutable_access_.store(false, std::memory_order_release);
+    }
+
+    template <typename T, typename Data>
+    void partitioned_vector<T, Data>::mark_mutable_access()
+    {
+        mark_modified();
+        mutable_access_.store(true, std::memory_order_release);
     }
 }}
 
@@ -305,10 +472,16 @@ namespace hpx { namespace server
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name)); \
     HPX_REGISTER_ACTION(type::get_values_action,                               \
         HPX_PP_CAT(__vector_get_values_action_, name));                        \
+    HPX_REGISTER_ACTION(                                                       \
+        type::get_range_action, HPX_PP_CAT(__vector_get_range_action_, name)); \
+    HPX_REGISTER_ACTION(type::get_blocks_action,                               \
+        HPX_PP_CAT(__vector_get_blocks_action_, name));                        \
     HPX_REGISTER_ACTION(                                                       \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name)); \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
         HPX_PP_CAT(__vector_set_values_action_, name));                        \
+    HPX_REGISTER_ACTION(type::copy_ranges_action,                              \
+        HPX_PP_CAT(__vector_copy_ranges_action_, name));                       \
     HPX_REGISTER_ACTION(                                                       \
         type::size_action, HPX_PP_CAT(__vector_size_action_, name));           \
     HPX_REGISTER_ACTION(                                                       \
@@ -317,6 +490,10 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_get_copied_data_action_, name));                   \
     HPX_REGISTER_ACTION(                                                       \
         type::set_data_action, HPX_PP_CAT(__vector_set_data_action_, name));   \
+    HPX_REGISTER_ACTION(type::get_modification_count_action,                   \
+        HPX_PP_CAT(__vector_get_modification_count_action_, name));            \
+    HPX_REGISTER_ACTION(type::release_mutable_access_action,                   \
+        HPX_PP_CAT(__vector_release_mutable_access_action_, name));            \
     typedef ::hpx::components::component<type> HPX_PP_CAT(__vector_, name);    \
     HPX_REGISTER_COMPONENT(HPX_PP_CAT(__vector_, name))    \
 /**/
@@ -464,6 +641,43 @@ namespace hpx
             this->get_id(), pos, val);
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector_partition<T, Data>::get_range(
+        launch::sync_policy, std::size_t first, std::size_t count) const
+    {
+        return get_range(first, count).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::vector<T>>
+    partitioned_vector_partition<T, Data>::get_range(
+        std::size_t first, std::size_t count) const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_range_action>(
+            this->get_id(), first, count);
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector_partition<T, Data>::get_blocks(launch::sync_policy,
+        std::size_t first, std::size_t count, std::size_t block_size,
+        std::size_t stride) const
+    {
+        return get_blocks(first, count, block_size, stride).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::vector<T>>
+    partitioned_vector_partition<T, Data>::get_blocks(std::size_t first,
+        std::size_t count, std::size_t block_size, std::size_t stride) const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_blocks_action>(
+            this->get_id(), first, count, block_size, stride);
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_values(launch::sync_policy,
@@ -482,6 +696,25 @@ namespace hpx
             this->get_id(), pos, val);
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::copy_ranges(launch::sync_policy,
+        std::size_t pos,
+        std::vector<server::partitioned_vector_range> const& ranges)
+    {
+        copy_ranges(pos, ranges).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::copy_ranges(std::size_t pos,
+        std::vector<server::partitioned_vector_range> const& ranges)
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::copy_ranges_action>(
+            this->get_id(), pos, ranges);
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector_partition<T, Data>::server_type::data_type
@@ -518,6 +751,40 @@ namespace hpx
         return hpx::async<typename server_type::set_data_action>(
             this->get_id(), std::move(other));
     }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::uint64_t
+    partitioned_vector_partition<T, Data>::get_modification_count(
+        launch::sync_policy) const
+    {
+        return get_modification_count().get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::uint64_t>
+    partitioned_vector_partition<T, Data>::get_modification_count() const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::get_modification_count_action>(
+            this->get_id());
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::release_mutable_access(
+        launch::sync_policy) const
+    {
+        release_mutable_access().get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::release_mutable_access() const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::release_mutable_access_action>(
+            this->get_id());
+    }
 }
 
 #endif
@@ -27,6 +27,7 @@
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_segmented_iterator.hpp>
+#include <hpx/components/containers/redistribution_policy.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -321,6 +322,45 @@ namespace hpx
         const_segment_iterator get_const_segment_iterator(
             size_type global_index) const;
 
+        /// Redistribute the elements of this vector to the layout described
+        /// by the given policy (see block_distribution, cyclic_distribution,
+        /// and weighted_distribution).
+        ///
+        /// Partitions which keep their elements and their locality are left
+        /// in place. All other partitions are newly created on their target
+        /// locality and fetch their elements in bulk from the old
+        /// partitions, all partitions do so concurrently.
+        ///
+        /// Global iterators stay valid as they refer to an element by its
+        /// index. Segment iterators and local iterators are invalidated.
+        /// If the vector was registered using register_as() the registered
+        /// metadata is updated to the new layout, instances connecting
+        /// afterwards (using connect_to()) see the new layout. Instances
+        /// which were connected before still refer to the old layout and
+        /// have to reconnect. The vector must not be modified until the
+        /// redistribution has finished.
+        ///
+        /// \param policy  The new layout of the vector
+        ///
+        /// \returns The number of moved elements and bytes and the time
+        ///          needed for the redistribution.
+        ///
+        redistribution_statistics redistribute(launch::sync_policy,
+            redistribution_policy const& policy);
+
+        /// Asynchronously redistribute the elements of this vector to the
+        /// layout described by the given policy. See the synchronous
+        /// version for details.
+        ///
+        /// \param policy  The new layout of the vector
+        ///
+        /// \returns A future which becomes ready once the redistribution
+        ///          has finished. The vector has to be kept alive until
+        ///          then.
+        ///
+        hpx::future<redistribution_statistics> redistribute(
+            redistribution_policy const& policy);
+
     protected:
         /// \cond NOINTERNAL
         typedef std::pair<hpx::id_type, std::vector<hpx::id_type> >
@@ -0,0 +1,404 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_halo.hpp
+
+#ifndef HPX_PARTITIONED_VECTOR_HALO_HPP
+#define HPX_PARTITIONED_VECTOR_HALO_HPP
+
+/// \brief Ghost zones (halos) for the tiles of a partitioned_vector_view.
+///
+/// Every segment of a partitioned_vector_view is treated as a tile of a
+/// N-dimensional grid, the elements of a tile are stored with the first
+/// dimension running fastest. For each tile owned by the current image a
+/// partitioned_vector_halo keeps one ghost buffer per face, holding the
+/// boundary layers of the neighbouring tile. exchange_halos() refreshes all
+/// ghost buffers, each of them is transferred as a single strided slab.
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <hpx/components/containers/partitioned_vector/detail/view_element.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    /// Identifies one of the two faces of a tile along a dimension
+    enum class halo_side
+    {
+        lower = 0,      ///< the face towards the index 0
+        upper = 1       ///< the face towards the largest index
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Ghost buffers for all tiles of a partitioned_vector_view owned by the
+    /// current image of the spmd_block the view was created for.
+    ///
+    /// The ghost buffer of a tile for dimension \a d and side \a s holds the
+    /// \a ghost_width layers of the neighbouring tile adjacent to that face.
+    /// It is laid out like a tile with the extent \a ghost_width along
+    /// \a d (the other extents are unchanged), its layers are ordered by
+    /// increasing index in the neighbour, i.e. for halo_side::lower the last
+    /// layer touches the tile, for halo_side::upper the first one does.
+    /// Only faces are exchanged, edges and corners are not.
+    ///
+    /// The data of neighbours located on the current locality is copied
+    /// directly from the neighbouring partition, avoiding any serialization.
+    /// Remote neighbours send their boundary as one packed message.
+    ///
+    /// \note The halo object must outlive the future returned by
+    ///       exchange_halos(). Neighbouring tiles must not be modified
+    ///       while an exchange is in flight, use spmd_block::sync_all()
+    ///       before and after the exchange.
+    template <typename T, std::size_t N, typename Data = std::vector<T> >
+    class partitioned_vector_halo
+    {
+    private:
+        using view_type = partitioned_vector_view<T, N, Data>;
+        using segment_iterator = typename view_type::segment_iterator;
+        using partition_type = partitioned_vector_partition<T, Data>;
+        using server_type = server::partitioned_vector<T, Data>;
+
+    public:
+        using index_type = std::array<std::size_t, N>;
+
+    private:
+        // A ghost buffer of one of the owned tiles, it receives count_
+        // blocks of block_size_ elements each from the neighbouring tile.
+        struct slab
+        {
+            slab()
+              : first_(0), count_(0), block_size_(0), stride_(0)
+            {}
+
+            hpx::id_type partition_;                // invalid if no neighbour
+            std::shared_ptr<server_type> local_;    // set if neighbour is local
+            std::size_t first_;
+            std::size_t count_;
+            std::size_t block_size_;
+            std::size_t stride_;
+            std::vector<T> data_;
+        };
+
+        struct tile
+        {
+            index_type index_;
+            std::array<slab, 2 * N> ghosts_;
+        };
+
+    public:
+        /// Create the ghost buffers for the tiles of \a view owned by the
+        /// current image.
+        ///
+        /// \param view         The view describing the grid of tiles
+        /// \param tile_extents The extents of a single tile, their product
+        ///                     must be equal to the size of the segments
+        /// \param ghost_width  The number of layers exchanged across each
+        ///                     face, must not exceed any of the extents
+        /// \param periodic     Whether the tiles at the boundaries of the
+        ///                     grid are neighbours of the tiles at the
+        ///                     opposite boundary
+        ///
+        partitioned_vector_halo(view_type const& view,
+                index_type const& tile_extents, std::size_t ghost_width,
+                bool periodic = false)
+          : tile_extents_(tile_extents), ghost_width_(ghost_width),
+            periodic_(periodic)
+        {
+            std::size_t tile_size = 1;
+            for (std::size_t extent : tile_extents_)
+            {
+                if (ghost_width_ == 0 || ghost_width_ > extent)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "partitioned_vector_halo::partitioned_vector_halo",
+                        "the ghost width must be positive and must not "
+                        "exceed the extents of a tile");
+                }
+                tile_size *= extent;
+            }
+
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                num_tiles_[d] = view.sw_basis_[d + 1] / view.sw_basis_[d];
+            }
+
+            std::size_t const total = view.sw_basis_[N];
+            tile_map_.assign(total, std::size_t(-1));
+
+            index_type index;
+            index.fill(0);
+
+            for (std::size_t t = 0; t != total; ++t, next_index(index))
+            {
+                hpx::detail::view_element<T, Data> element(view.block_,
+                    view.begin_, view.end_, segment(view, index));
+
+                if (!element.is_owned_by_current_thread())
+                    continue;
+
+                if (element.data().size() != tile_size)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "partitioned_vector_halo::partitioned_vector_halo",
+                        "the size of a tile does not match the given tile "
+                        "extents");
+                }
+
+                tile_map_[t] = tiles_.size();
+                tiles_.emplace_back();
+
+                tile& current = tiles_.back();
+                current.index_ = index;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    init_slab(view, current.ghosts_[2 * d], index, d,
+                        halo_side::lower);
+                    init_slab(view, current.ghosts_[2 * d + 1], index, d,
+                        halo_side::upper);
+                }
+            }
+        }
+
+        /// Return the number of layers exchanged across each face
+        std::size_t ghost_width() const
+        {
+            return ghost_width_;
+        }
+
+        /// Return the extents of a single tile
+        index_type const& tile_extents() const
+        {
+            return tile_extents_;
+        }
+
+        /// Return whether the grid of tiles wraps around at its boundaries
+        bool periodic() const
+        {
+            return periodic_;
+        }
+
+        /// Return whether the given tile is owned by the current image
+        bool is_owned(index_type const& index) const
+        {
+            return tile_map_[linear_index(index)] != std::size_t(-1);
+        }
+
+        /// Return whether the given owned tile has a neighbour across the
+        /// given face
+        bool has_ghost(index_type const& index, std::size_t dim,
+            halo_side side) const
+        {
+            return bool(get_slab(index, dim, side).partition_);
+        }
+
+        /// Return the ghost buffer of the given owned tile for the given
+        /// face. The buffer is empty if the tile has no neighbour across
+        /// this face.
+        std::vector<T> const& get_ghost(index_type const& index,
+            std::size_t dim, halo_side side) const
+        {
+            return get_slab(index, dim, side).data_;
+        }
+
+        /// Fill the ghost buffers of all owned tiles with the current
+        /// boundary data of their neighbours.
+        ///
+        /// \return A future which becomes ready once all ghost buffers were
+        ///         filled, it holds the first exception thrown while
+        ///         transferring the data, if any.
+        ///
+        hpx::future<void> exchange_halos()
+        {
+            using get_blocks_action =
+                typename server_type::get_blocks_action;
+
+            std::vector<hpx::future<void> > results;
+            results.reserve(2 * N * tiles_.size());
+
+            for (tile& t : tiles_)
+            {
+                for (slab& s : t.ghosts_)
+                {
+                    if (!s.partition_)
+                        continue;
+
+                    if (s.local_)
+                    {
+                        results.push_back(hpx::async(
+                            [&s]()
+                            {
+                                copy_slab(s);
+                            }));
+                    }
+                    else
+                    {
+                        results.push_back(hpx::async<get_blocks_action>(
+                            s.partition_, s.first_, s.count_,
+                            s.block_size_, s.stride_).then(
+                                [&s](hpx::future<std::vector<T> > f)
+                                {
+                                    s.data_ = f.get();
+                                }));
+                    }
+                }
+            }
+
+            return hpx::when_all(results).then(
+                [](hpx::future<std::vector<hpx::future<void> > > f)
+                {
+                    std::vector<hpx::future<void> > fs = f.get();
+                    for (hpx::future<void>& r : fs)
+                        r.get();
+                });
+        }
+
+    private:
+        static segment_iterator segment(view_type const& view,
+            index_type const& index)
+        {
+            std::size_t offset = 0;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                offset += index[d] * view.hw_basis_[d];
+            }
+            return view.begin_ + offset;
+        }
+
+        // advance to the next tile, the first dimension runs fastest
+        void next_index(index_type& index) const
+        {
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (++index[d] != num_tiles_[d])
+                    return;
+                index[d] = 0;
+            }
+        }
+
+        std::size_t linear_index(index_type const& index) const
+        {
+            std::size_t result = 0;
+            std::size_t basis = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                HPX_ASSERT(index[d] < num_tiles_[d]);
+                result += index[d] * basis;
+                basis *= num_tiles_[d];
+            }
+            return result;
+        }
+
+        slab const& get_slab(index_type const& index, std::size_t dim,
+            halo_side side) const
+        {
+            HPX_ASSERT(dim < N);
+
+            std::size_t t = tile_map_[linear_index(index)];
+            if (t == std::size_t(-1))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partitioned_vector_halo::get_slab",
+                    "the given tile is not owned by the current image");
+            }
+            return tiles_[t].ghosts_[2 * dim + static_cast<std::size_t>(side)];
+        }
+
+        // Determine the neighbour of the tile with the given index and the
+        // geometry of the layers to fetch from it.
+        void init_slab(view_type const& view, slab& s, index_type index,
+            std::size_t dim, halo_side side)
+        {
+            if (side == halo_side::lower)
+            {
+                if (index[dim] == 0)
+                {
+                    if (!periodic_)
+                        return;
+                    index[dim] = num_tiles_[dim];
+                }
+                --index[dim];
+            }
+            else if (++index[dim] == num_tiles_[dim])
+            {
+                if (!periodic_)
+                    return;
+                index[dim] = 0;
+            }
+
+            // all elements with the same index in the dimensions above dim
+            // form one contiguous block of the slab
+            std::size_t inner = 1;
+            std::size_t outer = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                if (d < dim)
+                    inner *= tile_extents_[d];
+                else if (d > dim)
+                    outer *= tile_extents_[d];
+            }
+
+            std::size_t start = (side == halo_side::lower) ?
+                tile_extents_[dim] - ghost_width_ : 0;
+
+            s.first_ = start * inner;
+            s.count_ = outer;
+            s.block_size_ = ghost_width_ * inner;
+            s.stride_ = tile_extents_[dim] * inner;
+            s.data_.resize(s.count_ * s.block_size_);
+
+            s.partition_ = segment(view, index)->get_id();
+            if (naming::get_locality_id_from_id(s.partition_) ==
+                hpx::get_locality_id())
+            {
+                s.local_ = partition_type(s.partition_).get_ptr();
+            }
+        }
+
+        // copy the slab directly from the data of the local neighbour
+        static void copy_slab(slab& s)
+        {
+            HPX_ASSERT(s.local_);
+
+            Data const& data =
+                static_cast<server_type const&>(*s.local_).get_data();
+            HPX_ASSERT(s.count_ == 0 ||
+                s.first_ + (s.count_ - 1) * s.stride_ + s.block_size_ <=
+                    data.size());
+
+            auto dest = s.data_.begin();
+            for (std::size_t i = 0; i != s.count_; ++i)
+            {
+                auto it = data.begin() + (s.first_ + i * s.stride_);
+                dest = std::copy(it, it + s.block_size_, dest);
+            }
+        }
+
+    private:
+        index_type tile_extents_;
+        index_type num_tiles_;
+        std::size_t ghost_width_;
+        bool periodic_;
+
+        std::vector<tile> tiles_;
+        std::vector<std::size_t> tile_map_;    // tile -> position in tiles_
+    };
+}
+
+#endif
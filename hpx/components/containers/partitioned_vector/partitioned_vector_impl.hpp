@@ -21,17 +21,20 @@
 #include <hpx/traits/is_distribution_policy.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind_back.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 
 #include <hpx/components/containers/container_distribution_policy.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_impl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_segmented_iterator.hpp>
+#include <hpx/components/containers/redistribution_policy.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -451,6 +454,195 @@ namespace hpx
         std::swap(partitions_, partitions);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT redistribution_statistics
+    partitioned_vector<T, Data>::redistribute(
+        launch::sync_policy, redistribution_policy const& policy)
+    {
+        typedef typename partitioned_vector_partition_client::server_component_type
+            component_type;
+
+        std::uint64_t start = util::high_resolution_clock::now();
+        redistribution_statistics stats;
+
+        std::size_t num_parts = policy.get_num_partitions();
+        if (num_parts == 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "partitioned_vector::redistribute",
+                "the new layout must have at least one partition");
+        }
+
+        if (size_ == 0)
+        {
+            stats.elapsed_ = util::high_resolution_clock::now() - start;
+            return stats;
+        }
+
+        std::size_t part_size = (size_ + num_parts - 1) / num_parts;
+        std::size_t old_part_size = partition_size_;
+
+        // Partitions holding the same elements on the same locality are
+        // kept, all others are created on their target locality.
+        partitions_vector_type partitions(num_parts);
+        std::vector<std::size_t> created;
+        std::map<std::uint32_t, std::vector<std::size_t> > created_on;
+
+        for (std::size_t i = 0; i != num_parts; ++i)
+        {
+            std::size_t first = (std::min)(i * part_size, size_);
+            std::size_t size = (std::min)(part_size, size_ - first);
+
+            std::uint32_t locality =
+                naming::get_locality_id_from_id(policy.get_locality(i));
+
+            if (part_size == old_part_size && i < partitions_.size() &&
+                partitions_[i].size_ == size &&
+                partitions_[i].locality_id_ == locality)
+            {
+                partitions[i] = partitions_[i];
+                ++stats.partitions_kept_;
+                continue;
+            }
+
+            partitions[i] = partition_data(id_type(), size, locality);
+            created.push_back(i);
+            created_on[locality].push_back(i);
+        }
+
+        // create all new partitions, one bulk operation per locality
+        std::vector<hpx::future<std::vector<hpx::id_type> > > objs;
+        objs.reserve(created_on.size());
+        for (auto const& p : created_on)
+        {
+            objs.push_back(hpx::new_<component_type[]>(
+                policy.get_locality(p.second.front()), p.second.size(),
+                part_size));
+        }
+
+        std::uint32_t this_locality = get_locality_id();
+        std::vector<future<void> > ptrs;
+        std::vector<future<void> > resized;
+
+        std::size_t l = 0;
+        for (auto const& p : created_on)
+        {
+            std::vector<hpx::id_type> ids = objs[l++].get();
+            HPX_ASSERT(ids.size() == p.second.size());
+
+            for (std::size_t j = 0; j != ids.size(); ++j)
+            {
+                std::size_t i = p.second[j];
+                partitions[i].partition_ = std::move(ids[j]);
+
+                // shrink last partition(s), if appropriate
+                if (partitions[i].size_ != part_size)
+                {
+                    resized.push_back(partitioned_vector_partition_client(
+                        partitions[i].partition_)
+                            .resize_async(partitions[i].size_));
+                }
+
+                if (p.first == this_locality)
+                {
+                    ptrs.push_back(get_ptr<partitioned_vector_partition_server>(
+                        partitions[i].partition_)
+                            .then(get_ptr_helper{i, partitions}));
+                }
+            }
+        }
+        for (future<void>& f : resized)
+            f.get();
+
+        // every new partition fetches its elements from all old partitions
+        // it overlaps with
+        std::vector<future<void> > moved;
+        moved.reserve(created.size());
+        for (std::size_t i : created)
+        {
+            partition_data const& part = partitions[i];
+
+            std::size_t first = i * part_size;
+            std::size_t last = first + part.size_;
+
+            std::vector<server::partitioned_vector_range> ranges;
+            for (std::size_t j = first / old_part_size;
+                 first != last && j != partitions_.size(); ++j)
+            {
+                std::size_t old_first = j * old_part_size;
+                std::size_t lo = (std::max)(first, old_first);
+                std::size_t hi =
+                    (std::min)(last, old_first + partitions_[j].size_);
+                if (lo >= hi)
+                {
+                    if (old_first >= last)
+                        break;
+                    continue;
+                }
+
+                ranges.emplace_back(partitions_[j].partition_,
+                    lo - old_first, hi - lo);
+
+                std::uint64_t bytes = (hi - lo) * sizeof(T);
+                stats.elements_moved_ += hi - lo;
+                stats.bytes_moved_ += bytes;
+                if (partitions_[j].locality_id_ != part.locality_id_)
+                    stats.bytes_transferred_ += bytes;
+            }
+
+            if (!ranges.empty())
+            {
+                moved.push_back(
+                    partitioned_vector_partition_client(part.partition_)
+                        .copy_ranges(0, ranges));
+            }
+        }
+        for (future<void>& f : moved)
+            f.get();
+
+        when_all(ptrs).get();
+
+        stats.partitions_created_ = created.size();
+
+        std::swap(partitions_, partitions);
+        partition_size_ = get_partition_size();
+
+        // The metadata created by register_as() (or attached to by
+        // connect_to()) has to describe the new layout as well, otherwise
+        // it keeps the old partitions alive and instances connecting later
+        // on would see those.
+        if (this->valid())
+        {
+            typedef typename components::server::distributed_metadata_base<
+                server::partitioned_vector_config_data>::set_action act;
+
+            std::vector<server::partitioned_vector_config_data::partition_data>
+                config_partitions(partitions_.begin(), partitions_.end());
+
+            async(act(), this->get_id(),
+                server::partitioned_vector_config_data(
+                    size_, std::move(config_partitions)))
+                .get();
+        }
+
+        stats.elapsed_ = util::high_resolution_clock::now() - start;
+        return stats;
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    hpx::future<redistribution_statistics>
+    partitioned_vector<T, Data>::redistribute(
+        redistribution_policy const& policy)
+    {
+        return hpx::async(
+            [this, policy]() -> redistribution_statistics
+            {
+                return redistribute(launch::sync, policy);
+            });
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
@@ -66,7 +66,7 @@ namespace hpx
         local_iterator remote()
         {
             HPX_ASSERT(data_);
-            std::size_t local_index = std::distance(data_->begin(), this->base());
+            std::size_t local_index = this->base() - data_->cbegin();
             return local_iterator(
                 partitioned_vector_partition<T, Data>(data_->get_id()),
                 local_index, data_);
@@ -74,7 +74,7 @@ namespace hpx
         local_const_iterator remote() const
         {
             HPX_ASSERT(data_);
-            std::size_t local_index = std::distance(data_->begin(), this->base());
+            std::size_t local_index = this->base() - data_->cbegin();
             return local_const_iterator(
                 partitioned_vector_partition<T, Data>(data_->get_id()),
                 local_index, data_);
@@ -146,7 +146,7 @@ namespace hpx
                     return it_.get_partition().get_value(launch::sync,
                         it_.get_local_index());
                 }
-                return *(it_.get_data()->begin() + it_.get_local_index());
+                return *(it_.get_data()->cbegin() + it_.get_local_index());
             }
 
             template <typename T_>
@@ -159,8 +159,8 @@ namespace hpx
                 }
                 else
                 {
-                    *(it_.get_data()->begin() + it_.get_local_index()) =
-                        std::forward<T_>(value);
+                    it_.get_data()->set_value(
+                        it_.get_local_index(), std::forward<T_>(value));
                 }
                 return *this;
             }
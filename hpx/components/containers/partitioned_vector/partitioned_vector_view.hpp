@@ -28,10 +28,16 @@
 
 namespace hpx
 {
+    template <typename T, std::size_t N, typename Data>
+    class partitioned_vector_halo;
+
     template<typename T, std::size_t N, typename Data = std::vector<T> >
     struct partitioned_vector_view
     {
     private:
+        template <typename T_, std::size_t N_, typename Data_>
+        friend class partitioned_vector_halo;
+
         // Type aliases
         using pvector_iterator = hpx::vector_iterator<T,Data>;
         using const_pvector_iterator = hpx::const_vector_iterator<T,Data>;
@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_CONTAINER_REDISTRIBUTION_POLICY_HPP
+#define HPX_CONTAINER_REDISTRIBUTION_POLICY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // This class specifies the layout a partitioned container is changed to
+    // by a redistribution: the number of partitions and the locality each of
+    // the partitions is placed on.
+    class redistribution_policy
+    {
+    public:
+        redistribution_policy() = default;
+
+        explicit redistribution_policy(
+                std::vector<hpx::id_type> && partition_localities)
+          : partition_localities_(std::move(partition_localities))
+        {}
+
+        /// Return the number of partitions of the new layout
+        std::size_t get_num_partitions() const
+        {
+            return partition_localities_.size();
+        }
+
+        /// Return the locality the partition with the given sequence number
+        /// is placed on
+        hpx::id_type const& get_locality(std::size_t part) const
+        {
+            HPX_ASSERT(part < partition_localities_.size());
+            return partition_localities_[part];
+        }
+
+        /// Return the localities of all partitions
+        std::vector<hpx::id_type> const& get_partition_localities() const
+        {
+            return partition_localities_;
+        }
+
+    private:
+        std::vector<hpx::id_type> partition_localities_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics reported by a redistribution
+    struct redistribution_statistics
+    {
+        redistribution_statistics()
+          : partitions_kept_(0), partitions_created_(0),
+            elements_moved_(0), bytes_moved_(0), bytes_transferred_(0),
+            elapsed_(0)
+        {}
+
+        std::size_t partitions_kept_;       // partitions left in place
+        std::size_t partitions_created_;    // partitions newly created
+        std::uint64_t elements_moved_;      // elements copied
+        std::uint64_t bytes_moved_;         // sizeof(T) * elements_moved_
+        std::uint64_t bytes_transferred_;   // bytes sent between localities
+        std::uint64_t elapsed_;             // time needed [ns]
+    };
+
+    namespace detail
+    {
+        inline void check_redistribution_arguments(char const* name,
+            std::size_t num_partitions,
+            std::vector<hpx::id_type> const& localities)
+        {
+            if (num_partitions == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, name,
+                    "the number of partitions must not be zero");
+            }
+            if (localities.empty())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, name,
+                    "the list of localities must not be empty");
+            }
+        }
+
+        // Assign consecutive partitions to the localities, the given counts
+        // specify the number of partitions per locality.
+        inline redistribution_policy make_blocked_redistribution(
+            std::vector<hpx::id_type> const& localities,
+            std::vector<std::size_t> const& counts)
+        {
+            HPX_ASSERT(localities.size() == counts.size());
+
+            std::vector<hpx::id_type> partition_localities;
+            for (std::size_t l = 0; l != localities.size(); ++l)
+            {
+                partition_localities.insert(partition_localities.end(),
+                    counts[l], localities[l]);
+            }
+            return redistribution_policy(std::move(partition_localities));
+        }
+    }
+
+    /// Create a layout placing equally sized groups of consecutive
+    /// partitions onto the given localities (in order), the last locality
+    /// might get less partitions. This is the layout created by
+    /// container_layout.
+    inline redistribution_policy block_distribution(
+        std::size_t num_partitions, std::vector<hpx::id_type> const& localities)
+    {
+        detail::check_redistribution_arguments(
+            "hpx::block_distribution", num_partitions, localities);
+
+        std::size_t per_locality =
+            (num_partitions + localities.size() - 1) / localities.size();
+
+        std::vector<std::size_t> counts(localities.size(), 0);
+        std::size_t remaining = num_partitions;
+        for (std::size_t& count : counts)
+        {
+            count = (std::min)(per_locality, remaining);
+            remaining -= count;
+        }
+        return detail::make_blocked_redistribution(localities, counts);
+    }
+
+    /// Create a layout placing the partitions onto the given localities in
+    /// a round robin fashion.
+    inline redistribution_policy cyclic_distribution(
+        std::size_t num_partitions, std::vector<hpx::id_type> const& localities)
+    {
+        detail::check_redistribution_arguments(
+            "hpx::cyclic_distribution", num_partitions, localities);
+
+        std::vector<hpx::id_type> partition_localities;
+        partition_localities.reserve(num_partitions);
+        for (std::size_t i = 0; i != num_partitions; ++i)
+        {
+            partition_localities.push_back(localities[i % localities.size()]);
+        }
+        return redistribution_policy(std::move(partition_localities));
+    }
+
+    /// Create a layout placing groups of consecutive partitions onto the
+    /// given localities (in order), the number of partitions of each group
+    /// is proportional to the weight of its locality.
+    ///
+    /// A weight is the relative share of the elements a locality should
+    /// own, e.g. its measured throughput or the inverse of its cost per
+    /// element. As all partitions (but the last) have the same size the
+    /// achievable granularity is one partition, use a sufficient number of
+    /// partitions to approximate the weights closely.
+    inline redistribution_policy weighted_distribution(
+        std::size_t num_partitions, std::vector<hpx::id_type> const& localities,
+        std::vector<double> const& weights)
+    {
+        detail::check_redistribution_arguments(
+            "hpx::weighted_distribution", num_partitions, localities);
+
+        if (weights.size() != localities.size())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::weighted_distribution",
+                "the number of weights must be equal to the number of "
+                "localities");
+        }
+
+        double total = 0.0;
+        for (double w : weights)
+        {
+            if (!(w >= 0.0))
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::weighted_distribution",
+                    "the weights must not be negative");
+            }
+            total += w;
+        }
+        if (total == 0.0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "hpx::weighted_distribution",
+                "at least one of the weights must be positive");
+        }
+
+        // apportion the partitions using the largest remainder method
+        std::vector<std::size_t> counts(localities.size(), 0);
+        std::vector<std::pair<double, std::size_t> > remainders;
+        remainders.reserve(localities.size());
+
+        std::size_t assigned = 0;
+        for (std::size_t l = 0; l != weights.size(); ++l)
+        {
+            double quota = num_partitions * (weights[l] / total);
+            counts[l] = (std::min)(
+                static_cast<std::size_t>(quota), num_partitions - assigned);
+            assigned += counts[l];
+            remainders.emplace_back(quota - counts[l], l);
+        }
+
+        std::stable_sort(remainders.begin(), remainders.end(),
+            [](std::pair<double, std::size_t> const& lhs,
+                std::pair<double, std::size_t> const& rhs)
+            {
+                return lhs.first > rhs.first;
+            });
+
+        for (std::size_t i = 0; assigned != num_partitions; ++i)
+        {
+            ++counts[remainders[i % remainders.size()].second];
+            ++assigned;
+        }
+
+        return detail::make_blocked_redistribution(localities, counts);
+    }
+}
+
+#endif
@@ -14,7 +14,9 @@
 ///
 /// The partition_unordered_map is the wrapper to the stl unordered_map class
 /// except all API'are defined as component action. All the API's in client
-/// classes are asynchronous API which return the futures.
+/// classes are asynchronous API which return the futures. The elements are
+/// stored in a lock-striped map, which allows for concurrent access to the
+/// partition.
 
 #include <hpx/config.hpp>
 #include <hpx/lcos/reduce.hpp>
@@ -26,14 +28,17 @@
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_factory.hpp>
-#include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/components/server/simple_component_base.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/serialization/map.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 
+#include <hpx/components/containers/unordered/striped_unordered_map.hpp>
+
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -47,28 +52,28 @@ namespace hpx { namespace server
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. All operations are thread safe, operations
+    /// on different keys are usually executed concurrently.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key> >
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::simple_component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public hpx::components::simple_component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual> >
     {
     public:
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<
-                hpx::components::simple_component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
+        typedef hpx::components::simple_component_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual> >
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        typedef hpx::detail::striped_unordered_map<Key, T, Hash, KeyEqual>
+            storage_type;
+
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -124,38 +129,11 @@ namespace hpx { namespace server
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            return partition_unordered_map_.get_copied_data();
         }
         void set_copied_data(data_type && d)
         {
-            partition_unordered_map_ = std::move(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_.assign(std::move(d));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -174,13 +152,6 @@ namespace hpx { namespace server
             return partition_unordered_map_.max_size();
         }
 
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
-        }
-
         /// Checks if the container has no elements, i.e. whether
         /// begin() == end().
         bool empty() const
@@ -200,36 +171,20 @@ namespace hpx { namespace server
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            T result;
+            bool found = erase ?
+                partition_unordered_map_.extract(key, result) :
+                partition_unordered_map_.get(key, result);
+            if (!found)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return result;
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -242,14 +197,11 @@ namespace hpx { namespace server
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
-            std::vector<T> result;
-            result.reserve(keys.size());
+            std::vector<T> result(keys.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                if (!partition_unordered_map_.get(keys[i], result[i]))
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
@@ -257,11 +209,29 @@ namespace hpx { namespace server
                         "unordered_map");
                     break;
                 }
-                result.push_back(it->second);
             }
             return result;
         }
 
+        /// Return the current version of this partition. The version is
+        /// increased by every modification of the partition, writing a
+        /// single element increments it by one.
+        std::uint64_t get_version() const
+        {
+            return partition_unordered_map_.get_version();
+        }
+
+        /// Return the values of the elements with the given keys together
+        /// with the version of the partition. The version is read before
+        /// the values, i.e. the returned values are at least as recent as
+        /// the returned version.
+        std::pair<std::uint64_t, std::vector<T> > get_versioned_values(
+            std::vector<Key> const& keys)
+        {
+            std::uint64_t version = partition_unordered_map_.get_version();
+            return std::make_pair(version, get_values(keys));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
@@ -275,7 +245,7 @@ namespace hpx { namespace server
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.set(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -289,10 +259,22 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.set(keys[i], val[i]);
+        }
+
+        /// Copy the given values for the elements with the given keys and
+        /// return the versions of the partition before and after the
+        /// modification. If the difference of the versions is equal to the
+        /// number of keys, no other modification happened in between.
+        std::pair<std::uint64_t, std::uint64_t> set_versioned_values(
+            std::vector<Key> const& keys, std::vector<T> const& val)
+        {
+            std::uint64_t before = partition_unordered_map_.get_version();
+            set_values(keys, val);
+            return std::make_pair(
+                before, partition_unordered_map_.get_version());
         }
 
         /// Remove all elements from the vector leaving the
@@ -314,9 +296,14 @@ namespace hpx { namespace server
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_version);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, get_versioned_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, set_versioned_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase);
 
@@ -362,6 +349,18 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,     \
         HPX_PP_CAT(__unordered_map_set_values_action_, name));                \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_version_action,                                               \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name));               \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_versioned_values_action,                                      \
+        HPX_PP_CAT(__unordered_map_get_versioned_values_action_, name));      \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            set_versioned_values_action,                                      \
+        HPX_PP_CAT(__unordered_map_set_versioned_values_action_, name));      \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,           \
         HPX_PP_CAT(__unordered_map_size_action_, name));                      \
@@ -421,6 +420,18 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,     \
         HPX_PP_CAT(__unordered_map_set_values_action_, name));                \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_version_action,                                               \
+        HPX_PP_CAT(__unordered_map_get_version_action_, name));               \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            get_versioned_values_action,                                      \
+        HPX_PP_CAT(__unordered_map_get_versioned_values_action_, name));      \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::                       \
+            set_versioned_values_action,                                      \
+        HPX_PP_CAT(__unordered_map_set_versioned_values_action_, name));      \
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,           \
         HPX_PP_CAT(__unordered_map_size_action_, name));                      \
@@ -621,6 +632,53 @@ namespace hpx
                 this->get_id(), keys, vals);
         }
 
+        /// Return the current version of the partition_unordered_map
+        /// component.
+        ///
+        /// \return This returns the version as the hpx::future
+        ///
+        future<std::uint64_t> get_version() const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::get_version_action>(
+                this->get_id());
+        }
+
+        /// Return the values of the elements with the given keys together
+        /// with the version of the partition they were read from.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the version and the values as the hpx::future
+        ///
+        future<std::pair<std::uint64_t, std::vector<T> > >
+        get_versioned_values(std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                    typename server_type::get_versioned_values_action
+                >(this->get_id(), keys);
+        }
+
+        /// Copy the values \a vals to the elements with the given keys and
+        /// return the versions of the partition before and after the
+        /// modification.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        /// \param vals The values to be copied
+        ///
+        /// \return This returns the versions as the hpx::future
+        ///
+        future<std::pair<std::uint64_t, std::uint64_t> >
+        set_versioned_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                    typename server_type::set_versioned_values_action
+                >(this->get_id(), keys, vals);
+        }
+
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
         ///
@@ -0,0 +1,318 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/striped_unordered_map.hpp
+
+#if !defined(HPX_STRIPED_UNORDERED_MAP_OCT_18_2026_0531AM)
+#define HPX_STRIPED_UNORDERED_MAP_OCT_18_2026_0531AM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+#include <hpx/util/fibhash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail
+{
+    /// \brief A lock-striped unordered map which can be accessed concurrently.
+    ///
+    /// The elements are distributed over a fixed number of stripes, each of
+    /// which consists of a std::unordered_map protected by its own lock.
+    /// Operations on keys falling into different stripes proceed in parallel.
+    /// Operations involving all elements (copying, assigning, clearing) lock
+    /// all stripes in ascending order.
+    ///
+    /// Every stripe maintains a version counter which is incremented by
+    /// every modification of the stripe (while still holding its lock), the
+    /// version of the map is the sum of the versions of all stripes. Writers
+    /// touch only the counter of their own stripe.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key> >
+    class striped_unordered_map
+    {
+    public:
+        typedef std::unordered_map<Key, T, Hash, KeyEqual> map_type;
+        typedef typename map_type::size_type size_type;
+
+        // number of stripes, must be a power of two
+        static constexpr std::size_t num_stripes = 64;
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct stripe
+        {
+            stripe()
+              : version_(0)
+            {}
+
+            // the stripe is modified only while holding the lock, the
+            // version is read without it
+            void bump_version()
+            {
+                version_.store(version_.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+            }
+
+            mutable mutex_type mtx_;
+            map_type map_;
+            std::atomic<std::uint64_t> version_;
+        };
+
+        typedef util::cache_aligned_data<stripe> stripe_type;
+
+        // The stripe is selected based on the upper bits of the (mixed) hash
+        // value while the map inside the stripe uses the lower ones.
+        std::size_t get_stripe(Key const& key) const
+        {
+            return util::fibhash<num_stripes>(hash_(key));
+        }
+
+        stripe& get_stripe_data(Key const& key)
+        {
+            return stripes_[get_stripe(key)].data_;
+        }
+        stripe const& get_stripe_data(Key const& key) const
+        {
+            return stripes_[get_stripe(key)].data_;
+        }
+
+        std::vector<std::unique_lock<mutex_type> > lock_all() const
+        {
+            std::vector<std::unique_lock<mutex_type> > locks;
+            locks.reserve(num_stripes);
+            for (std::size_t i = 0; i != num_stripes; ++i)
+                locks.emplace_back(stripes_[i].data_.mtx_);
+            return locks;
+        }
+
+        static size_type stripe_bucket_count(size_type bucket_count)
+        {
+            return (bucket_count + num_stripes - 1) / num_stripes;
+        }
+
+    public:
+        striped_unordered_map()
+          : stripes_(new stripe_type[num_stripes])
+        {}
+
+        explicit striped_unordered_map(size_type bucket_count,
+                Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : hash_(hash), stripes_(new stripe_type[num_stripes])
+        {
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripes_[i].data_.map_ = map_type(
+                    stripe_bucket_count(bucket_count), hash, equal);
+            }
+        }
+
+        striped_unordered_map(striped_unordered_map const& rhs)
+          : hash_(rhs.hash_), stripes_(new stripe_type[num_stripes])
+        {
+            auto l = rhs.lock_all();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+                stripes_[i].data_.map_ = rhs.stripes_[i].data_.map_;
+        }
+
+        striped_unordered_map(striped_unordered_map && rhs)
+          : hash_(rhs.hash_), stripes_(new stripe_type[num_stripes])
+        {
+            auto l = rhs.lock_all();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+                stripes_[i].data_.map_ = std::move(rhs.stripes_[i].data_.map_);
+        }
+
+        striped_unordered_map& operator=(striped_unordered_map const& rhs)
+        {
+            if (this != &rhs)
+                assign(rhs.get_copied_data());
+            return *this;
+        }
+
+        striped_unordered_map& operator=(striped_unordered_map && rhs)
+        {
+            if (this != &rhs)
+                assign(rhs.get_copied_data());
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return the number of elements. The result is exact only if the
+        /// map is not modified concurrently.
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe const& s = stripes_[i].data_;
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                result += s.map_.size();
+            }
+            return result;
+        }
+
+        size_type max_size() const
+        {
+            std::lock_guard<mutex_type> l(stripes_[0].data_.mtx_);
+            return stripes_[0].data_.map_.max_size();
+        }
+
+        bool empty() const
+        {
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe const& s = stripes_[i].data_;
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                if (!s.map_.empty())
+                    return false;
+            }
+            return true;
+        }
+
+        /// Return the current version of the map, this is the sum of the
+        /// versions of all stripes. Reading the version before reading
+        /// elements guarantees that the elements are at least as recent as
+        /// the returned version. As the versions of the stripes never
+        /// decrease, two equal results imply that no stripe was modified in
+        /// between.
+        std::uint64_t get_version() const
+        {
+            std::uint64_t version = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                version += stripes_[i].data_.version_.load(
+                    std::memory_order_acquire);
+            }
+            return version;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Copy the value stored for the given key into \a val.
+        ///
+        /// \returns false if the key was not found.
+        bool get(Key const& key, T& val) const
+        {
+            stripe const& s = get_stripe_data(key);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+                return false;
+
+            val = it->second;
+            return true;
+        }
+
+        /// Move the value stored for the given key into \a val and erase the
+        /// element.
+        ///
+        /// \returns false if the key was not found.
+        bool extract(Key const& key, T& val)
+        {
+            stripe& s = get_stripe_data(key);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+                return false;
+
+            val = std::move(it->second);
+            s.map_.erase(it);
+            s.bump_version();
+            return true;
+        }
+
+        /// Insert the given value or assign it to an existing element.
+        template <typename T_>
+        void set(Key const& key, T_ && val)
+        {
+            stripe& s = get_stripe_data(key);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            s.map_[key] = std::forward<T_>(val);
+            s.bump_version();
+        }
+
+        std::size_t erase(Key const& key)
+        {
+            stripe& s = get_stripe_data(key);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t erased = s.map_.erase(key);
+            if (erased != 0)
+                s.bump_version();
+            return erased;
+        }
+
+        void clear()
+        {
+            auto l = lock_all();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe& s = stripes_[i].data_;
+                if (!s.map_.empty())
+                {
+                    s.map_.clear();
+                    s.bump_version();
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return a consistent copy of all elements
+        map_type get_copied_data() const
+        {
+            auto l = lock_all();
+
+            size_type count = 0;
+            for (std::size_t i = 0; i != num_stripes; ++i)
+                count += stripes_[i].data_.map_.size();
+
+            map_type result(count, hash_, stripes_[0].data_.map_.key_eq());
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                map_type const& m = stripes_[i].data_.map_;
+                result.insert(m.begin(), m.end());
+            }
+            return result;
+        }
+
+        /// Replace all elements with the elements of the given map
+        void assign(map_type && m)
+        {
+            auto l = lock_all();
+            for (std::size_t i = 0; i != num_stripes; ++i)
+            {
+                stripe& s = stripes_[i].data_;
+                s.map_.clear();
+                s.bump_version();
+            }
+
+            for (auto& v : m)
+            {
+                stripes_[get_stripe(v.first)].data_.map_.insert(
+                    std::move(v));
+            }
+        }
+
+    private:
+        Hash hash_;
+        std::unique_ptr<stripe_type[]> stripes_;
+    };
+}}
+
+#endif
@@ -9,7 +9,9 @@
 #define HPX_UNORDERED_MAP_NOV_11_2014_0852PM
 
 #include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_type.hpp>
 #include <hpx/runtime/components/copy_component.hpp>
@@ -326,11 +328,6 @@ namespace hpx
         }
 
         ///////////////////////////////////////////////////////////////////////
-        std::size_t get_partition(Key const& key) const
-        {
-            return this->hasher_(key) % partitions_.size();
-        }
-
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -583,6 +580,22 @@ namespace hpx
             return partitions_.size();
         }
 
+        /// Return the sequence number of the partition which stores the
+        /// element with the given key.
+        std::size_t get_partition(Key const& key) const
+        {
+            return this->hasher_(key) % partitions_.size();
+        }
+
+        /// Return whether the given partition is located on this locality.
+        /// Operations on local partitions are executed directly, without
+        /// sending a parcel.
+        bool is_local_partition(size_type part) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+            return bool(partitions_[part].local_data_);
+        }
+
         /// \brief Array subscript operator. This does not throw any exception.
         ///
         /// \param pos Position of the element in the unordered_map
@@ -827,6 +840,269 @@ namespace hpx
                 part_data.partition_).erase(key);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Bulk operations
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container. The keys are grouped by the partition they belong to
+        /// and a single request is sent to each of the involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the same order as
+        ///         the given keys.
+        ///
+        std::vector<T>
+        get_values(launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the elements with the given keys in the
+        /// unordered_map container. The keys are grouped by the partition
+        /// they belong to and a single request is sent to each of the
+        /// involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the same order as the given keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t> > indices;
+            std::vector<std::vector<Key> > part_keys;
+            group_by_partition(keys, indices, part_keys);
+
+            std::vector<future<std::vector<T> > > part_values;
+            part_values.reserve(part_keys.size());
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                part_values.push_back(get_values(part, part_keys[part]));
+            }
+
+            std::size_t count = keys.size();
+            return dataflow(launch::sync,
+                [count](std::vector<future<std::vector<T> > > && part_values,
+                    std::vector<std::vector<std::size_t> > const& indices)
+                -> std::vector<T>
+                {
+                    std::vector<T> values(count);
+                    for (std::size_t part = 0; part != indices.size(); ++part)
+                    {
+                        std::vector<T> vals = part_values[part].get();
+                        std::vector<std::size_t> const& idx = indices[part];
+                        for (std::size_t i = 0; i != idx.size(); ++i)
+                            values[idx[i]] = std::move(vals[i]);
+                    }
+                    return values;
+                },
+                std::move(part_values), std::move(indices));
+        }
+
+        /// Asynchronously returns the elements with the given keys in the
+        /// partition \a part of the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements.
+        ///
+        future<std::vector<T> >
+        get_values(size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            if (keys.empty())
+                return make_ready_future(std::vector<T>());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_values(keys));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values(keys);
+        }
+
+        /// Copy the values \a vals to the elements with the given keys in
+        /// the unordered_map container. The keys are grouped by the
+        /// partition they belong to and a single request is sent to each
+        /// of the involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the unordered_map container. The keys are grouped
+        /// by the partition they belong to and a single request is sent to
+        /// each of the involved partitions.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<std::size_t> > indices;
+            std::vector<std::vector<Key> > part_keys;
+            group_by_partition(keys, indices, part_keys);
+
+            std::vector<future<void> > part_futures;
+            part_futures.reserve(part_keys.size());
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                std::vector<T> part_vals;
+                part_vals.reserve(indices[part].size());
+                for (std::size_t i : indices[part])
+                    part_vals.push_back(vals[i]);
+
+                part_futures.push_back(
+                    set_values(part, part_keys[part], part_vals));
+            }
+
+            return dataflow(launch::sync,
+                [](std::vector<future<void> > && part_futures)
+                {
+                    for (future<void>& f : part_futures)
+                        f.get();
+                },
+                std::move(part_futures));
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the partition \a part of the unordered_map
+        /// container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < partitions_.size());
+            HPX_ASSERT(keys.size() == vals.size());
+
+            if (keys.empty())
+                return make_ready_future();
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_values(keys, vals);
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_values(keys, vals);
+        }
+
+        /// Asynchronously return the version of the partition \a part. The
+        /// version of a partition changes whenever one of its elements is
+        /// modified.
+        ///
+        /// \param part  Sequence number of the partition
+        ///
+        future<std::uint64_t> get_version(size_type part) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+                return make_ready_future(part_data.local_data_->get_version());
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_version();
+        }
+
+        /// Asynchronously returns the elements with the given keys in the
+        /// partition \a part together with the version of the partition.
+        /// The returned values are at least as recent as the returned
+        /// version.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        future<std::pair<std::uint64_t, std::vector<T> > >
+        get_versioned_values(size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_versioned_values(keys));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_versioned_values(keys);
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the partition \a part and return the versions of
+        /// the partition before and after the modification.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        future<std::pair<std::uint64_t, std::uint64_t> >
+        set_versioned_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < partitions_.size());
+            HPX_ASSERT(keys.size() == vals.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->set_versioned_values(keys, vals));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_versioned_values(keys, vals);
+        }
+
+    private:
+        // Group the given keys by the partition they belong to, indices
+        // receives the positions of the keys in the original sequence.
+        void group_by_partition(std::vector<Key> const& keys,
+            std::vector<std::vector<std::size_t> >& indices,
+            std::vector<std::vector<Key> >& part_keys) const
+        {
+            indices.resize(partitions_.size());
+            part_keys.resize(partitions_.size());
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                indices[part].push_back(i);
+                part_keys[part].push_back(keys[i]);
+            }
+        }
+
+    public:
+
         ///////////////////////////////////////////////////////////////////////
         typedef segment_unordered_map_iterator<
                 Key, T, Hash, KeyEqual,
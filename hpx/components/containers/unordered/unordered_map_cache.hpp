@@ -0,0 +1,558 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/unordered_map_cache.hpp
+
+#if !defined(HPX_UNORDERED_MAP_CACHE_OCT_18_2026_0539AM)
+#define HPX_UNORDERED_MAP_CACHE_OCT_18_2026_0539AM
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <hpx/components/containers/unordered/unordered_map.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    /// Statistics collected by an \a unordered_map_cache.
+    struct unordered_map_cache_statistics
+    {
+        std::uint64_t hits;             ///< keys served from the cache
+        std::uint64_t misses;           ///< keys fetched from a partition
+        std::uint64_t invalidations;    ///< partitions found to be stale
+        std::uint64_t round_trips;      ///< requests sent to remote partitions
+        std::uint64_t round_trips_saved;///< remote requests avoided
+    };
+
+    /// \brief A client side access layer for an hpx::unordered_map batching
+    ///        the accesses to arbitrary sets of keys and optionally caching
+    ///        the values of recently read keys.
+    ///
+    /// All keys passed to a single operation are grouped by the partition
+    /// they belong to. Each involved partition receives exactly one request,
+    /// local partitions are accessed directly.
+    ///
+    /// If the cache capacity is not zero, the values read are cached on a
+    /// per-partition basis together with the version of the partition they
+    /// were read from (read-through). A cached value is served only as long
+    /// as the cached version of its partition is current: \a validate
+    /// retrieves the versions of all partitions holding cached values (one
+    /// request per partition) and drops the entries of all partitions which
+    /// have been modified in the meantime. Writes issued through the cache
+    /// are forwarded to the partitions (write-through) and keep the cached
+    /// entries of a partition valid as long as no other modification of the
+    /// same partition happened concurrently.
+    ///
+    /// The unordered_map has to outlive the cache. The cache can be used
+    /// concurrently from several threads.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key> >
+    class unordered_map_cache
+    {
+    public:
+        typedef hpx::unordered_map<Key, T, Hash, KeyEqual> map_type;
+        typedef std::size_t size_type;
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        struct partition_cache
+        {
+            partition_cache()
+              : valid_(false), version_(0)
+            {}
+
+            // valid_ is false if the cached version is unknown, in which
+            // case entries_ is empty
+            bool valid_;
+            std::uint64_t version_;
+            std::unordered_map<Key, T, Hash, KeyEqual> entries_;
+        };
+
+        struct statistics
+        {
+            statistics()
+              : hits_(0), misses_(0), invalidations_(0), round_trips_(0)
+              , round_trips_saved_(0)
+            {}
+
+            std::atomic<std::uint64_t> hits_;
+            std::atomic<std::uint64_t> misses_;
+            std::atomic<std::uint64_t> invalidations_;
+            std::atomic<std::uint64_t> round_trips_;
+            std::atomic<std::uint64_t> round_trips_saved_;
+        };
+
+        struct shared_state
+        {
+            shared_state(map_type const& m, std::size_t capacity)
+              : map_(m), capacity_(capacity), partitions_(m.get_num_partitions())
+            {}
+
+            // Account for a request carrying the given number of keys which
+            // was sent to the given partition.
+            void count_request(size_type part, std::size_t num_keys)
+            {
+                if (num_keys == 0 || map_.is_local_partition(part))
+                    return;
+
+                ++stats_.round_trips_;
+                stats_.round_trips_saved_ += num_keys - 1;
+            }
+
+            // Store the values read for the given keys if the partition
+            // version is still the one the cached values belong to.
+            void update(size_type part, std::uint64_t version,
+                std::vector<Key> const& keys, std::vector<T> const& values)
+            {
+                if (capacity_ == 0)
+                    return;
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                partition_cache& pc = partitions_[part];
+                if (!pc.valid_ || pc.version_ != version)
+                {
+                    // the partition was modified, all cached entries are
+                    // stale
+                    if (!pc.entries_.empty())
+                        ++stats_.invalidations_;
+
+                    pc.entries_.clear();
+                    pc.valid_ = true;
+                    pc.version_ = version;
+                }
+
+                for (std::size_t i = 0; i != keys.size(); ++i)
+                {
+                    if (pc.entries_.size() >= capacity_ &&
+                        pc.entries_.find(keys[i]) == pc.entries_.end())
+                    {
+                        pc.entries_.erase(pc.entries_.begin());
+                    }
+                    pc.entries_[keys[i]] = values[i];
+                }
+            }
+
+            // Apply the result of a write operation to the cache.
+            void update_written(size_type part,
+                std::pair<std::uint64_t, std::uint64_t> versions,
+                std::vector<Key> const& keys, std::vector<T> const& values)
+            {
+                if (capacity_ == 0)
+                    return;
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                partition_cache& pc = partitions_[part];
+                if (pc.valid_ && pc.version_ == versions.first &&
+                    versions.second - versions.first == keys.size())
+                {
+                    // this was the only modification of the partition, all
+                    // cached entries remain valid
+                    pc.version_ = versions.second;
+                    for (std::size_t i = 0; i != keys.size(); ++i)
+                    {
+                        auto it = pc.entries_.find(keys[i]);
+                        if (it != pc.entries_.end())
+                            it->second = values[i];
+                    }
+                }
+                else
+                {
+                    invalidate(pc);
+                }
+            }
+
+            void invalidate(size_type part)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                invalidate(partitions_[part]);
+            }
+
+            void invalidate(partition_cache& pc)
+            {
+                if (!pc.entries_.empty())
+                    ++stats_.invalidations_;
+
+                pc.entries_.clear();
+                pc.valid_ = false;
+            }
+
+            map_type const& map_;
+            std::size_t capacity_;
+
+            mutable mutex_type mtx_;
+            std::vector<partition_cache> partitions_;
+
+            statistics stats_;
+        };
+
+    public:
+        /// Create a new cache for the given unordered_map.
+        ///
+        /// \param m         The unordered_map to access. It has to outlive
+        ///                  the cache.
+        /// \param capacity  The maximum number of values cached for each
+        ///                  of the partitions. If this is zero, the accesses
+        ///                  are batched but no values are cached.
+        ///
+        explicit unordered_map_cache(map_type& m, std::size_t capacity = 1024)
+          : map_(m), state_(std::make_shared<shared_state>(m, capacity))
+        {}
+
+        /// Return the maximum number of values cached for each partition.
+        std::size_t capacity() const
+        {
+            return state_->capacity_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Asynchronously returns the elements with the given keys. Cached
+        /// values are returned without contacting the owning partitions,
+        /// all other keys are fetched with a single request per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the same order as the given keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys)
+        {
+            shared_state& state = *state_;
+            std::size_t num_partitions = state.partitions_.size();
+
+            std::vector<T> values(keys.size());
+
+            // positions and keys of the values which were not cached
+            std::vector<std::vector<std::size_t> > indices(num_partitions);
+            std::vector<std::vector<Key> > part_keys(num_partitions);
+
+            std::uint64_t hits = 0;
+            {
+                std::lock_guard<mutex_type> l(state.mtx_);
+                for (std::size_t i = 0; i != keys.size(); ++i)
+                {
+                    std::size_t part = map_.get_partition(keys[i]);
+
+                    partition_cache const& pc = state.partitions_[part];
+                    auto it = pc.entries_.find(keys[i]);
+                    if (it != pc.entries_.end())
+                    {
+                        values[i] = it->second;
+                        ++hits;
+                        if (!map_.is_local_partition(part))
+                            ++state.stats_.round_trips_saved_;
+                        continue;
+                    }
+
+                    indices[part].push_back(i);
+                    part_keys[part].push_back(keys[i]);
+                }
+            }
+
+            state.stats_.hits_ += hits;
+            state.stats_.misses_ += keys.size() - hits;
+
+            if (hits == keys.size())
+                return make_ready_future(std::move(values));
+
+            std::vector<size_type> parts;
+            std::vector<future<std::pair<std::uint64_t, std::vector<T> > > >
+                part_values;
+            for (std::size_t part = 0; part != num_partitions; ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                state.count_request(part, part_keys[part].size());
+
+                parts.push_back(part);
+                part_values.push_back(
+                    map_.get_versioned_values(part, part_keys[part]));
+            }
+
+            std::shared_ptr<shared_state> s = state_;
+            return dataflow(launch::sync,
+                [s](std::vector<future<std::pair<
+                        std::uint64_t, std::vector<T> > > > && part_values,
+                    std::vector<T> && values,
+                    std::vector<size_type> const& parts,
+                    std::vector<std::vector<std::size_t> > const& indices,
+                    std::vector<std::vector<Key> > const& part_keys)
+                -> std::vector<T>
+                {
+                    for (std::size_t i = 0; i != parts.size(); ++i)
+                    {
+                        size_type part = parts[i];
+                        std::pair<std::uint64_t, std::vector<T> > r =
+                            part_values[i].get();
+
+                        s->update(part, r.first, part_keys[part], r.second);
+
+                        std::vector<std::size_t> const& idx = indices[part];
+                        for (std::size_t j = 0; j != idx.size(); ++j)
+                            values[idx[j]] = std::move(r.second[j]);
+                    }
+                    return std::move(values);
+                },
+                std::move(part_values), std::move(values), std::move(parts),
+                std::move(indices), std::move(part_keys));
+        }
+
+        /// Returns the elements with the given keys. Cached values are
+        /// returned without contacting the owning partitions, all other keys
+        /// are fetched with a single request per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the same order as
+        ///         the given keys.
+        ///
+        std::vector<T>
+        get_values(launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return get_values(keys).get();
+        }
+
+        /// Returns the element with the given key, see \a get_values.
+        T get_value(launch::sync_policy, Key const& key)
+        {
+            return get_values(std::vector<Key>(1, key)).get()[0];
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys. A single request is sent to each of the involved
+        /// partitions. Cached values of the written keys are updated.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            shared_state& state = *state_;
+            std::size_t num_partitions = state.partitions_.size();
+
+            std::vector<std::vector<Key> > part_keys(num_partitions);
+            std::vector<std::vector<T> > part_vals(num_partitions);
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = map_.get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                part_vals[part].push_back(vals[i]);
+            }
+
+            std::vector<size_type> parts;
+            std::vector<future<std::pair<std::uint64_t, std::uint64_t> > >
+                part_versions;
+            for (std::size_t part = 0; part != num_partitions; ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                state.count_request(part, part_keys[part].size());
+
+                parts.push_back(part);
+                part_versions.push_back(map_.set_versioned_values(
+                    part, part_keys[part], part_vals[part]));
+            }
+
+            std::shared_ptr<shared_state> s = state_;
+            return dataflow(launch::sync,
+                [s](std::vector<future<std::pair<
+                        std::uint64_t, std::uint64_t> > > && part_versions,
+                    std::vector<size_type> const& parts,
+                    std::vector<std::vector<Key> > const& part_keys,
+                    std::vector<std::vector<T> > const& part_vals)
+                {
+                    for (std::size_t i = 0; i != parts.size(); ++i)
+                    {
+                        size_type part = parts[i];
+                        if (part_versions[i].has_exception())
+                        {
+                            // the partition might have been modified
+                            // partially
+                            s->invalidate(part);
+                            continue;
+                        }
+
+                        s->update_written(part, part_versions[i].get(),
+                            part_keys[part], part_vals[part]);
+                    }
+
+                    // propagate exceptions, if any
+                    for (auto& f : part_versions)
+                        f.get();
+                },
+                std::move(part_versions), std::move(parts),
+                std::move(part_keys), std::move(part_vals));
+        }
+
+        /// Copy the values \a vals to the elements with the given keys, see
+        /// \a set_values.
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Copy the value \a val to the element with the given key, see
+        /// \a set_values.
+        void set_value(launch::sync_policy, Key const& key, T const& val)
+        {
+            set_values(std::vector<Key>(1, key), std::vector<T>(1, val)).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Check whether the cached values are still current. This retrieves
+        /// the version of all partitions which have cached values (one
+        /// request per partition) and drops the cached values of all
+        /// partitions which have been modified since the values were read.
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> validate()
+        {
+            shared_state& state = *state_;
+
+            std::vector<std::pair<size_type, std::uint64_t> > cached;
+            {
+                std::lock_guard<mutex_type> l(state.mtx_);
+                for (size_type part = 0; part != state.partitions_.size();
+                     ++part)
+                {
+                    partition_cache const& pc = state.partitions_[part];
+                    if (pc.valid_ && !pc.entries_.empty())
+                        cached.push_back(std::make_pair(part, pc.version_));
+                }
+            }
+
+            std::vector<future<void> > part_futures;
+            part_futures.reserve(cached.size());
+            for (auto const& c : cached)
+            {
+                state.count_request(c.first, 1);
+
+                std::shared_ptr<shared_state> s = state_;
+                size_type part = c.first;
+                std::uint64_t version = c.second;
+
+                part_futures.push_back(
+                    map_.get_version(part).then(launch::sync,
+                        [s, part, version](future<std::uint64_t> && f)
+                        {
+                            std::uint64_t current = f.get();
+
+                            std::lock_guard<mutex_type> l(s->mtx_);
+                            partition_cache& pc = s->partitions_[part];
+                            if (pc.valid_ && pc.version_ == version &&
+                                current != version)
+                            {
+                                s->invalidate(pc);
+                            }
+                        }));
+            }
+
+            return wait_all_futures(std::move(part_futures));
+        }
+
+        /// \copydoc validate()
+        void validate(launch::sync_policy)
+        {
+            validate().get();
+        }
+
+        /// Drop all cached values.
+        void invalidate()
+        {
+            std::lock_guard<mutex_type> l(state_->mtx_);
+            for (partition_cache& pc : state_->partitions_)
+                state_->invalidate(pc);
+        }
+
+        /// Return the number of currently cached values.
+        std::size_t size() const
+        {
+            std::lock_guard<mutex_type> l(state_->mtx_);
+
+            std::size_t result = 0;
+            for (partition_cache const& pc : state_->partitions_)
+                result += pc.entries_.size();
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return the statistics collected by this cache.
+        ///
+        /// A remote round trip is saved for each key read or written with
+        /// a request to a remote partition which carried other keys as well,
+        /// and for each key of a remote partition which was served from the
+        /// cache.
+        unordered_map_cache_statistics get_statistics() const
+        {
+            statistics const& stats = state_->stats_;
+
+            unordered_map_cache_statistics result;
+            result.hits = stats.hits_;
+            result.misses = stats.misses_;
+            result.invalidations = stats.invalidations_;
+            result.round_trips = stats.round_trips_;
+            result.round_trips_saved = stats.round_trips_saved_;
+            return result;
+        }
+
+        /// Reset all statistics counters to zero.
+        void reset_statistics()
+        {
+            statistics& stats = state_->stats_;
+
+            stats.hits_ = 0;
+            stats.misses_ = 0;
+            stats.invalidations_ = 0;
+            stats.round_trips_ = 0;
+            stats.round_trips_saved_ = 0;
+        }
+
+    private:
+        static future<void> wait_all_futures(
+            std::vector<future<void> > && part_futures)
+        {
+            return dataflow(launch::sync,
+                [](std::vector<future<void> > && part_futures)
+                {
+                    for (future<void>& f : part_futures)
+                        f.get();
+                },
+                std::move(part_futures));
+        }
+
+    private:
+        map_type& map_;
+        std::shared_ptr<shared_state> state_;
+    };
+}
+
+#endif
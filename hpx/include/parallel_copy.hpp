@@ -9,6 +9,7 @@
 
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/container_algorithms/copy.hpp>
+#include <hpx/parallel/segmented_algorithms/copy.hpp>
 
 #endif
 
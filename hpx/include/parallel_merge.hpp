@@ -8,6 +8,7 @@
 
 #include <hpx/parallel/algorithms/merge.hpp>
 #include <hpx/parallel/container_algorithms/merge.hpp>
+#include <hpx/parallel/segmented_algorithms/merge.hpp>
 
 #endif
 
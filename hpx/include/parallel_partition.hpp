@@ -9,6 +9,7 @@
 
 #include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/container_algorithms/partition.hpp>
+#include <hpx/parallel/segmented_algorithms/partition.hpp>
 
 #endif
 
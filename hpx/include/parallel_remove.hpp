@@ -8,6 +8,7 @@
 
 #include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/container_algorithms/remove.hpp>
+#include <hpx/parallel/segmented_algorithms/remove.hpp>
 
 #endif
 
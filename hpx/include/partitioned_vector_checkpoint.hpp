@@ -0,0 +1,11 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARTITIONED_VECTOR_CHECKPOINT_OCT_18_2026_0522AM)
+#define HPX_PARTITIONED_VECTOR_CHECKPOINT_OCT_18_2026_0522AM
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
+
+#endif
@@ -7,6 +7,7 @@
 #define HPX_PARTITIONED_VECTOR_VIEW_AUG_03_2017_1157AM
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_view.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_local_view.hpp>
 
 #endif
@@ -7,6 +7,7 @@
 #define HPX_UNORDERED_MAP_NOV_11_2014_0857PM
 
 #include <hpx/components/containers/unordered/unordered_map.hpp>
+#include <hpx/components/containers/unordered/unordered_map_cache.hpp>
 
 #endif
 
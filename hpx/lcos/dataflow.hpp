@@ -36,10 +36,10 @@
 #include <hpx/util/always_void.hpp>
 #include <hpx/util/annotated_function.hpp>
 #include <hpx/util/deferred_call.hpp>
-#include <hpx/util/internal_allocator.hpp>
 #include <hpx/util/invoke_fused.hpp>
 #include <hpx/util/pack_traversal_async.hpp>
 #include <hpx/util/thread_description.hpp>
+#include <hpx/util/thread_local_caching_allocator.hpp>
 #include <hpx/util/tuple.hpp>
 
 #include <hpx/parallel/executors/execution.hpp>
@@ -532,12 +532,12 @@ namespace hpx
     auto dataflow(F && f, Ts &&... ts)
     ->  decltype(
             lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::call(
-                hpx::util::internal_allocator<>{}, std::forward<F>(f),
+                hpx::util::thread_local_caching_allocator<>{}, std::forward<F>(f),
                 std::forward<Ts>(ts)...
         ))
     {
         return lcos::detail::dataflow_dispatch<typename std::decay<F>::type>::
-            call(hpx::util::internal_allocator<>{}, std::forward<F>(f),
+            call(hpx::util::thread_local_caching_allocator<>{}, std::forward<F>(f),
                 std::forward<Ts>(ts)...);
     }
 
@@ -560,11 +560,11 @@ namespace hpx
     HPX_FORCEINLINE
     auto dataflow(T0 && t0, Ts &&... ts)
     ->  decltype(lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, std::forward<T0>(t0),
+            hpx::util::thread_local_caching_allocator<>{}, std::forward<T0>(t0),
             std::forward<Ts>(ts)...))
     {
         return lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, std::forward<T0>(t0),
+            hpx::util::thread_local_caching_allocator<>{}, std::forward<T0>(t0),
             std::forward<Ts>(ts)...);
     }
 
@@ -191,10 +191,19 @@ namespace detail
     {
         future_data_base()
           : state_(empty)
+          , on_completed_(nullptr)
+          , inline_node_()
+          , inline_node_used_(false)
+          , has_waiters_(false)
         {}
 
         future_data_base(init_no_addref no_addref)
-          : future_data_refcnt_base(no_addref), state_(empty)
+          : future_data_refcnt_base(no_addref)
+          , state_(empty)
+          , on_completed_(nullptr)
+          , inline_node_()
+          , inline_node_used_(false)
+          , has_waiters_(false)
         {}
 
         using future_data_refcnt_base::completed_callback_type;
@@ -274,6 +283,17 @@ namespace detail
 
         virtual std::exception_ptr get_exception_ptr() const = 0;
 
+    protected:
+        // Wake up all threads waiting for this future and invoke the
+        // registered continuations. This has to be called exactly once after
+        // the state has been changed to 'value' or 'exception'.
+        void notify_ready();
+
+        // Release the continuations which were registered but not invoked
+        // and allow for new continuations to be registered.
+        void reset_on_completed();
+
+    public:
         virtual std::string const& get_registered_name() const
         {
             HPX_THROW_EXCEPTION(invalid_status,
@@ -288,9 +308,28 @@ namespace detail
         }
 
     protected:
-        mutable mutex_type mtx_;
+        // The continuations registered while the future is not ready yet are
+        // kept in an intrusive lock-free stack. Once the future has become
+        // ready the stack is replaced by a marker which makes sure no further
+        // continuations are added, those are run right away instead. The
+        // first continuation is stored in place which avoids any allocation
+        // in the common case of a future with one continuation only.
+        struct continuation_node
+        {
+            completed_callback_type f_;
+            continuation_node* next_;
+        };
+
+        static continuation_node* ready_marker();
+
+        bool push_on_completed(completed_callback_type& data_sink);
+
+        mutable mutex_type mtx_;                    // protects waiting threads
         std::atomic<state> state_;                  // current state
-        completed_callback_vector_type on_completed_;
+        std::atomic<continuation_node*> on_completed_;
+        continuation_node inline_node_;
+        std::atomic<bool> inline_node_used_;
+        std::atomic<bool> has_waiters_;
         local::detail::condition_variable cond_;    // threads waiting in read
     };
 
@@ -404,47 +443,21 @@ namespace detail
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+            if (!state_.compare_exchange_strong(expected, value))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // resume waiting threads and invoke the continuations
+            this->notify_ready();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -460,47 +473,21 @@ namespace detail
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*)exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+            if (!state_.compare_exchange_strong(expected, exception))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // resume waiting threads and invoke the continuations
+            this->notify_ready();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -580,7 +567,7 @@ namespace detail
             default: break;
             }
 
-            on_completed_.clear();
+            this->reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -592,10 +579,8 @@ namespace detail
     protected:
         using base_type::mtx_;
         using base_type::state_;
-        using base_type::on_completed_;
 
     private:
-        using base_type::cond_;
         typename future_data_storage<Result>::type storage_;
     };
 
@@ -32,12 +32,12 @@
 #include <hpx/util/decay.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/identity.hpp>
-#include <hpx/util/internal_allocator.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/lazy_enable_if.hpp>
 #include <hpx/util/result_of.hpp>
 #include <hpx/util/serialize_exception.hpp>
 #include <hpx/util/steady_clock.hpp>
+#include <hpx/util/thread_local_caching_allocator.hpp>
 #include <hpx/util/void_guard.hpp>
 
 #if defined(HPX_HAVE_AWAIT)
@@ -438,7 +438,7 @@ namespace hpx { namespace lcos { namespace detail
 
             typename hpx::traits::detail::shared_state_ptr<result_type>::type p =
                 detail::make_continuation_alloc<continuation_result_type>(
-                    hpx::util::internal_allocator<>{},
+                    hpx::util::thread_local_caching_allocator<>{},
                     std::move(fut), std::forward<Policy_>(policy),
                     std::forward<F>(f));
             return hpx::traits::future_access<future<result_type> >::create(
@@ -1537,7 +1537,7 @@ namespace hpx { namespace lcos
     make_ready_future(Ts&&... ts)
     {
         return make_ready_future_alloc<T>(
-            hpx::util::internal_allocator<>{},
+            hpx::util::thread_local_caching_allocator<>{},
             std::forward<Ts>(ts)...);
     }
     ///////////////////////////////////////////////////////////////////////////
@@ -1557,7 +1557,7 @@ namespace hpx { namespace lcos
     {
         using result_type = typename hpx::util::decay_unwrap<T>::type;
         return make_ready_future_alloc<result_type>(
-            hpx::util::internal_allocator<>{},
+            hpx::util::thread_local_caching_allocator<>{},
             std::forward<T>(init));
     }
 
@@ -1629,7 +1629,7 @@ namespace hpx { namespace lcos
     HPX_FORCEINLINE future<void> make_ready_future()
     {
         return make_ready_future_alloc<void>(
-            hpx::util::internal_allocator<>{}, util::unused);
+            hpx::util::thread_local_caching_allocator<>{}, util::unused);
     }
 
     // Extension (see wg21.link/P0319)
@@ -11,6 +11,7 @@
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/no_mutex.hpp>
 #include <hpx/lcos/local/packaged_task.hpp>
+#include <hpx/lcos/local/promise.hpp>
 #include <hpx/lcos/local/receive_buffer.hpp>
 #include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/runtime/launch_policy.hpp>
@@ -18,18 +19,23 @@
 #include <hpx/util/assert_owns_lock.hpp>
 #include <hpx/util/atomic_count.hpp>
 #include <hpx/util/iterator_facade.hpp>
+#include <hpx/util/lockfree/bounded_mpmc_queue.hpp>
+#include <hpx/util/optional.hpp>
 #include <hpx/util/register_locks.hpp>
 #include <hpx/util/unlock_guard.hpp>
 #include <hpx/util/unused.hpp>
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <deque>
 #include <exception>
 #include <iterator>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace local
 {
@@ -502,6 +508,341 @@ namespace hpx { namespace lcos { namespace local
             bool closed_;
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Channel with a fixed capacity, values are stored in a lock-free ring
+        // buffer. Setting and getting values do not acquire any lock as long
+        // as the buffer is neither full nor empty. Otherwise the request is
+        // queued (under a lock) and the returned future becomes ready as soon
+        // as the value could be stored or retrieved, which suspends waiting
+        // HPX threads instead of spinning (back-pressure).
+        template <typename T>
+        class bounded_channel : public channel_impl_base<T>
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+
+        public:
+            HPX_NON_COPYABLE(bounded_channel);
+
+        public:
+            explicit bounded_channel(std::size_t capacity)
+              : queue_(capacity)
+              , capacity_(capacity)
+              , size_(0)
+              , waiting_getters_(0)
+              , waiting_setters_(0)
+              , closed_(false)
+            {
+                if (capacity == 0)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "hpx::lcos::local::bounded_channel",
+                        "the capacity of a bounded channel must not be zero");
+                }
+            }
+
+        protected:
+            hpx::future<T> get(std::size_t, bool blocking)
+            {
+                hpx::util::optional<T> val;
+                if (pop(val))
+                {
+                    // a waiting set operation might be able to proceed now
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiting_setters_.load(std::memory_order_relaxed) != 0)
+                        resume_waiting();
+
+                    return hpx::make_ready_future(std::move(*val));
+                }
+                return get_slow(blocking);
+            }
+
+            bool try_get(std::size_t, hpx::future<T>* f = nullptr)
+            {
+                if (closed_.load(std::memory_order_acquire) &&
+                    size_.load(std::memory_order_acquire) == 0 &&
+                    waiting_setters_.load(std::memory_order_acquire) == 0)
+                {
+                    return false;
+                }
+
+                if (f != nullptr)
+                    *f = get(std::size_t(-1), false);
+
+                return true;
+            }
+
+            hpx::future<void> set(std::size_t, T && t)
+            {
+                if (closed_.load(std::memory_order_acquire))
+                {
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                if (push(std::move(t)))
+                {
+                    // a waiting get operation might be able to proceed now
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiting_getters_.load(std::memory_order_relaxed) != 0)
+                        resume_waiting();
+
+                    return hpx::make_ready_future();
+                }
+                return set_slow(std::move(t));
+            }
+
+            std::size_t close(bool force_delete_entries = false)
+            {
+                std::deque<local::promise<T> > getters;
+                std::deque<std::pair<T, local::promise<void> > > setters;
+
+                {
+                    std::unique_lock<mutex_type> l(mtx_);
+                    if (closed_.load(std::memory_order_relaxed))
+                    {
+                        l.unlock();
+                        HPX_THROW_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::close",
+                            "attempting to close an already closed channel");
+                        return 0;
+                    }
+
+                    closed_.store(true, std::memory_order_release);
+
+                    // all pending get requests which can't be satisfied have
+                    // to be canceled at this point, pending set requests are
+                    // canceled only if requested
+                    std::swap(getters, getters_);
+                    waiting_getters_.fetch_sub(
+                        getters.size(), std::memory_order_relaxed);
+
+                    if (force_delete_entries)
+                    {
+                        std::swap(setters, setters_);
+                        waiting_setters_.fetch_sub(
+                            setters.size(), std::memory_order_relaxed);
+                    }
+                }
+
+                if (getters.empty() && setters.empty())
+                    return 0;
+
+                std::exception_ptr e = HPX_GET_EXCEPTION(
+                    hpx::future_cancelled, hpx::lightweight,
+                    "hpx::lcos::local::close",
+                    "canceled waiting on this entry");
+
+                for (auto& p : getters)
+                    p.set_exception(e);
+                for (auto& p : setters)
+                    p.second.set_exception(e);
+
+                return getters.size() + setters.size();
+            }
+
+        private:
+            hpx::future<T> get_slow(bool blocking)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                // announce this request before checking the buffer again, any
+                // concurrent set will either see it or store its value where
+                // it is found below
+                waiting_getters_.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                hpx::util::optional<T> val;
+                if (pop(val))
+                {
+                    waiting_getters_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiting_setters_.load(std::memory_order_relaxed) != 0)
+                        resume_waiting();
+
+                    return hpx::make_ready_future(std::move(*val));
+                }
+
+                if (closed_.load(std::memory_order_relaxed) && setters_.empty())
+                {
+                    waiting_getters_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and was closed"));
+                }
+
+                if (blocking && this->use_count() == 1)
+                {
+                    waiting_getters_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+                    return hpx::make_exceptional_future<T>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::get",
+                            "this channel is empty and is not accessible "
+                            "by any other thread causing a deadlock"));
+                }
+
+                getters_.emplace_back();
+                hpx::future<T> f = getters_.back().get_future();
+
+                // pending set requests might have been stored in between
+                if (!setters_.empty())
+                {
+                    l.unlock();
+                    resume_waiting();
+                }
+                return f;
+            }
+
+            hpx::future<void> set_slow(T && t)
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    l.unlock();
+                    return hpx::make_exceptional_future<void>(
+                        HPX_GET_EXCEPTION(hpx::invalid_status,
+                            "hpx::lcos::local::channel::set",
+                            "attempting to write to a closed channel"));
+                }
+
+                // announce this request before checking the buffer again, any
+                // concurrent get will either see it or leave the free slot
+                // which is found below
+                waiting_setters_.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (push(std::move(t)))
+                {
+                    waiting_setters_.fetch_sub(1, std::memory_order_relaxed);
+                    l.unlock();
+
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiting_getters_.load(std::memory_order_relaxed) != 0)
+                        resume_waiting();
+
+                    return hpx::make_ready_future();
+                }
+
+                setters_.emplace_back(std::move(t), local::promise<void>());
+                hpx::future<void> f = setters_.back().second.get_future();
+
+                // pending get requests might have been stored in between
+                if (!getters_.empty())
+                {
+                    l.unlock();
+                    resume_waiting();
+                }
+                return f;
+            }
+
+            // The ring buffer may be larger than the requested capacity, the
+            // number of stored values is limited separately. A successful
+            // reservation does not guarantee a free slot in the ring buffer:
+            // size_ is decremented as soon as any get completes while the
+            // slot another, still running get has claimed stays occupied. A
+            // failed push gives its reservation back, the caller then takes
+            // the slow path and is resumed once that get has finished.
+            bool push(T && t)
+            {
+                if (size_.fetch_add(1, std::memory_order_acq_rel) >= capacity_)
+                {
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                if (!queue_.push(std::move(t)))
+                {
+                    size_.fetch_sub(1, std::memory_order_relaxed);
+                    return false;
+                }
+                return true;
+            }
+
+            bool pop(hpx::util::optional<T>& val)
+            {
+                bool result = queue_.consume_one(
+                    [&val](T && item)
+                    {
+                        val.emplace(std::move(item));
+                    });
+
+                if (result)
+                    size_.fetch_sub(1, std::memory_order_release);
+                return result;
+            }
+
+            // Move the values of waiting set requests into the buffer and
+            // hand values from the buffer to waiting get requests for as long
+            // as any progress can be made. The corresponding futures are made
+            // ready after the lock has been released.
+            void resume_waiting()
+            {
+                std::vector<std::pair<local::promise<T>, T> > ready_getters;
+                std::vector<local::promise<void> > ready_setters;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    bool progress = true;
+                    while (progress)
+                    {
+                        progress = false;
+
+                        while (!setters_.empty() &&
+                            push(std::move(setters_.front().first)))
+                        {
+                            ready_setters.push_back(
+                                std::move(setters_.front().second));
+                            setters_.pop_front();
+                            waiting_setters_.fetch_sub(
+                                1, std::memory_order_relaxed);
+                            progress = true;
+                        }
+
+                        hpx::util::optional<T> val;
+                        while (!getters_.empty() && pop(val))
+                        {
+                            ready_getters.emplace_back(
+                                std::move(getters_.front()), std::move(*val));
+                            getters_.pop_front();
+                            waiting_getters_.fetch_sub(
+                                1, std::memory_order_relaxed);
+                            progress = true;
+                        }
+                    }
+                }
+
+                for (auto& p : ready_setters)
+                    p.set_value();
+                for (auto& p : ready_getters)
+                    p.first.set_value(std::move(p.second));
+            }
+
+        private:
+            boost::lockfree::bounded_mpmc_queue<T> queue_;
+            std::size_t const capacity_;
+            std::atomic<std::size_t> size_;
+
+            // the number of get and set requests currently waiting for the
+            // buffer to become non-empty or non-full, respectively
+            std::atomic<std::size_t> waiting_getters_;
+            std::atomic<std::size_t> waiting_setters_;
+
+            // waiting requests are accessed only while holding mtx_
+            mutable mutex_type mtx_;
+            std::deque<local::promise<T> > getters_;
+            std::deque<std::pair<T, local::promise<void> > > setters_;
+
+            std::atomic<bool> closed_;
+        };
+
         ///////////////////////////////////////////////////////////////////////
         template <typename T> class channel_base;
     }
@@ -509,6 +850,7 @@ namespace hpx { namespace lcos { namespace local
     ///////////////////////////////////////////////////////////////////////////
     template <typename T = void> class channel;
     template <typename T = void> class one_element_channel;
+    template <typename T = void> class bounded_channel;
     template <typename T = void> class receive_channel;
     template <typename T = void> class send_channel;
 
@@ -787,6 +1129,34 @@ namespace hpx { namespace lcos { namespace local
         using base_type::range;
     };
 
+    // channel with a bounded buffer of the given capacity, it holds at most
+    // 'capacity' values which were set but not retrieved yet (a capacity of
+    // one hands over a single value at a time)
+    template <typename T>
+    class bounded_channel : protected detail::channel_base<T>
+    {
+        typedef detail::channel_base<T> base_type;
+
+    private:
+        friend class channel_iterator<T>;
+        friend class receive_channel<T>;
+        friend class send_channel<T>;
+
+    public:
+        typedef T value_type;
+
+        explicit bounded_channel(std::size_t capacity)
+          : base_type(new detail::bounded_channel<T>(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     class receive_channel : protected detail::channel_base<T>
@@ -804,6 +1174,9 @@ namespace hpx { namespace lcos { namespace local
         receive_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        receive_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::get;
         using base_type::begin;
@@ -824,6 +1197,9 @@ namespace hpx { namespace lcos { namespace local
         send_channel(one_element_channel<T> const& c)
           : base_type(c.get_channel_impl())
         {}
+        send_channel(bounded_channel<T> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::set;
         using base_type::close;
@@ -1050,6 +1426,32 @@ namespace hpx { namespace lcos { namespace local
         using base_type::range;
     };
 
+    template <>
+    class bounded_channel<void> : protected detail::channel_base<void>
+    {
+        typedef detail::channel_base<void> base_type;
+
+    private:
+        friend class channel_iterator<void>;
+        friend class receive_channel<void>;
+        friend class send_channel<void>;
+
+    public:
+        typedef void value_type;
+
+        explicit bounded_channel(std::size_t capacity)
+          : base_type(
+                new detail::bounded_channel<util::unused_type>(capacity))
+        {}
+
+        using base_type::get;
+        using base_type::set;
+        using base_type::close;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::range;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <>
     class receive_channel<void> : protected detail::channel_base<void>
@@ -1067,6 +1469,9 @@ namespace hpx { namespace lcos { namespace local
         receive_channel(one_element_channel<void> const& c)
           : base_type(c.get_channel_impl())
         {}
+        receive_channel(bounded_channel<void> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::get;
         using base_type::begin;
@@ -1087,6 +1492,9 @@ namespace hpx { namespace lcos { namespace local
         send_channel(one_element_channel<void> const& c)
           : base_type(c.get_channel_impl())
         {}
+        send_channel(bounded_channel<void> const& c)
+          : base_type(c.get_channel_impl())
+        {}
 
         using base_type::set;
         using base_type::close;
@@ -490,6 +490,31 @@ namespace hpx { namespace parallel { inline namespace v1
                     std::move(f4));
             }
         };
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<FwdIter1, FwdIter2>
+        >::type
+        copy_if_(ExPolicy && policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 dest, Pred && pred, Proj && proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::copy_if<std::pair<FwdIter1, FwdIter2> >().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first, last, dest, std::forward<Pred>(pred),
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<SegIter, SegOutIter>
+        >::type
+        copy_if_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, Pred && pred, Proj && proj, std::true_type);
         /// \endcond
     }
 
@@ -592,13 +617,15 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_forward_iterator<FwdIter2>::value),
             "Requires at least forward iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef typename detail::iterators_are_segmented<
+                FwdIter1, FwdIter2
+            >::type is_segmented;
 
         return hpx::util::make_tagged_pair<tag::in, tag::out>(
-            detail::copy_if<std::pair<FwdIter1, FwdIter2> >().call(
-                std::forward<ExPolicy>(policy), is_seq(),
-                first, last, dest, std::forward<F>(f),
-                std::forward<Proj>(proj)));
+            detail::copy_if_(
+                std::forward<ExPolicy>(policy), first, last, dest,
+                std::forward<F>(f), std::forward<Proj>(proj),
+                is_segmented()));
     }
 }}}
 
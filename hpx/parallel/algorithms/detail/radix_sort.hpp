@@ -0,0 +1,411 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_OCT_18_2026_0315AM)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_OCT_18_2026_0315AM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/result_of.hpp>
+#include <hpx/traits/is_iterator.hpp>
+
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/executors/execution_parameters.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <boost/shared_array.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys onto unsigned integers whose natural order
+    // matches the order imposed by operator<() on the original keys.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key
+    {
+        static bool const value = false;
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && std::is_unsigned<T>::value
+        >::type>
+    {
+        static bool const value = true;
+        typedef T type;
+
+        static type call(T key)
+        {
+            return key;
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_integral<T>::value && std::is_signed<T>::value
+        >::type>
+    {
+        static bool const value = true;
+        typedef typename std::make_unsigned<T>::type type;
+
+        // flipping the sign bit moves negative values below positive ones
+        static type call(T key)
+        {
+            return static_cast<type>(key) ^
+                static_cast<type>(type(1) << (sizeof(type) * CHAR_BIT - 1));
+        }
+    };
+
+    template <typename T, typename U>
+    struct radix_sort_floating_key
+    {
+        static bool const value = true;
+        typedef U type;
+
+        // negative values have all bits inverted (larger magnitude sorts
+        // first), non-negative values only get the sign bit set
+        static type call(T key)
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(type));
+
+            type const sign_bit = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            sizeof(T) == sizeof(std::uint32_t)
+        >::type>
+      : radix_sort_floating_key<T, std::uint32_t>
+    {};
+
+    template <typename T>
+    struct radix_sort_key<T,
+        typename std::enable_if<
+            std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            sizeof(T) == sizeof(std::uint64_t)
+        >::type>
+      : radix_sort_floating_key<T, std::uint64_t>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only comparison objects known to implement operator<() can be replaced
+    // by a radix sort.
+    template <typename Compare, typename Key>
+    struct is_radix_sort_compare
+      : std::false_type
+    {};
+
+    template <typename Key>
+    struct is_radix_sort_compare<detail::less, Key>
+      : std::true_type
+    {};
+
+    template <typename Key>
+    struct is_radix_sort_compare<std::less<Key>, Key>
+      : std::true_type
+    {};
+
+    template <typename Key>
+    struct is_radix_sort_compare<std::less<void>, Key>
+      : std::true_type
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decide whether sorting [first, last) using the given comparison and
+    // projection can be done using a radix sort.
+    template <typename RandomIt, typename Compare, typename Proj,
+        typename Enable = void>
+    struct use_radix_sort
+      : std::false_type
+    {};
+
+    template <typename RandomIt, typename Compare, typename Proj>
+    struct use_radix_sort<RandomIt, Compare, Proj,
+        typename std::enable_if<
+            hpx::traits::is_random_access_iterator<RandomIt>::value
+        >::type>
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+        typedef typename hpx::util::decay<
+                typename hpx::util::invoke_result<
+                    typename hpx::util::decay<Proj>::type,
+                    typename std::iterator_traits<RandomIt>::reference
+                >::type
+            >::type key_type;
+
+        static bool const value =
+            radix_sort_key<key_type>::value &&
+            is_radix_sort_compare<
+                typename hpx::util::decay<Compare>::type, key_type
+            >::value &&
+            std::is_default_constructible<value_type>::value &&
+            std::is_move_assignable<value_type>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    static const std::size_t radix_sort_bits_per_digit = 8;
+    static const std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_bits_per_digit;
+
+    static const std::size_t radix_sort_min_chunk_size =
+        16 * radix_sort_buckets;
+
+    typedef std::array<std::size_t, radix_sort_buckets> radix_sort_histogram;
+
+    template <typename Key, typename Proj, typename Iter>
+    HPX_FORCEINLINE std::size_t radix_sort_digit(Proj const& proj, Iter it,
+        std::size_t shift)
+    {
+        return static_cast<std::size_t>(radix_sort_key<Key>::call(
+                hpx::util::invoke(proj, *it)) >> shift) &
+            (radix_sort_buckets - 1);
+    }
+
+    // Wait for all given futures and rethrow any exception as required by
+    // the execution policy.
+    template <typename ExPolicy, typename T>
+    void radix_sort_wait(std::vector<hpx::future<T> >& workitems)
+    {
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+    }
+
+    //-------------------------------------------------------------------------
+    //  function : radix_sort_pass
+    /// \brief Performs one stable counting sort pass on the digit starting at
+    ///        bit 'shift', moving all elements from src to dest. Every chunk
+    ///        of the input builds a private histogram first, the exclusive
+    ///        prefix sum over (digit, chunk) gives each chunk its private
+    ///        write positions in the scatter phase.
+    ///
+    /// \returns false if all elements share the same digit, in which case
+    ///          nothing was moved.
+    //-------------------------------------------------------------------------
+    template <typename ExPolicy, typename Key, typename Iter1, typename Iter2,
+        typename Proj>
+    bool radix_sort_pass(ExPolicy& policy, Iter1 src, Iter2 dest,
+        std::size_t count, std::size_t chunk_size, Proj const& proj,
+        std::size_t shift)
+    {
+        std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+        std::vector<radix_sort_histogram> histograms(num_chunks);
+
+        // histogram phase
+        {
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(num_chunks);
+
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t first = chunk * chunk_size;
+                std::size_t last = (std::min)(first + chunk_size, count);
+                radix_sort_histogram* histogram = &histograms[chunk];
+
+                workitems.push_back(execution::async_execute(
+                    policy.executor(),
+                    [src, first, last, histogram, &proj, shift]() -> void
+                    {
+                        histogram->fill(0);
+                        for (std::size_t i = first; i != last; ++i)
+                        {
+                            ++(*histogram)[radix_sort_digit<Key>(
+                                proj, src + i, shift)];
+                        }
+                    }));
+            }
+
+            radix_sort_wait<ExPolicy>(workitems);
+        }
+
+        // calculate the write offsets of each chunk for each digit
+        std::size_t offset = 0;
+        for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+        {
+            std::size_t total = 0;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                total += histograms[chunk][digit];
+
+            // skip this pass if all keys have the same digit
+            if (total == count)
+                return false;
+
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t n = histograms[chunk][digit];
+                histograms[chunk][digit] = offset;
+                offset += n;
+            }
+        }
+        HPX_ASSERT(offset == count);
+
+        // scatter phase
+        {
+            std::vector<hpx::future<void> > workitems;
+            workitems.reserve(num_chunks);
+
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t first = chunk * chunk_size;
+                std::size_t last = (std::min)(first + chunk_size, count);
+                radix_sort_histogram* offsets = &histograms[chunk];
+
+                workitems.push_back(execution::async_execute(
+                    policy.executor(),
+                    [src, dest, first, last, offsets, &proj, shift]() -> void
+                    {
+                        for (std::size_t i = first; i != last; ++i)
+                        {
+                            std::size_t& pos = (*offsets)[
+                                radix_sort_digit<Key>(proj, src + i, shift)];
+                            *(dest + pos++) = std::move(*(src + i));
+                        }
+                    }));
+            }
+
+            radix_sort_wait<ExPolicy>(workitems);
+        }
+
+        return true;
+    }
+
+    // move the elements back into the input sequence in parallel
+    template <typename ExPolicy, typename Iter1, typename Iter2>
+    void radix_sort_move(ExPolicy& policy, Iter1 src, Iter2 dest,
+        std::size_t count, std::size_t chunk_size)
+    {
+        std::vector<hpx::future<void> > workitems;
+        for (std::size_t first = 0; first < count; first += chunk_size)
+        {
+            std::size_t last = (std::min)(first + chunk_size, count);
+            workitems.push_back(execution::async_execute(
+                policy.executor(),
+                [src, dest, first, last]() -> void
+                {
+                    std::move(src + first, src + last, dest + first);
+                }));
+        }
+
+        radix_sort_wait<ExPolicy>(workitems);
+    }
+
+    //-------------------------------------------------------------------------
+    //  function : radix_sort
+    /// \brief Sorts [first, last) using a parallel LSD radix sort on the
+    ///        (projected) arithmetic key of each element, processing
+    ///        radix_sort_bits_per_digit bits per pass. Passes are skipped if
+    ///        all keys share the same digit.
+    //-------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    RandomIt radix_sort(ExPolicy& policy, RandomIt first, RandomIt last,
+        Proj const& proj, std::size_t chunk_size)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+        typedef typename hpx::util::decay<
+                decltype(hpx::util::invoke(proj, *first))
+            >::type key_type;
+        typedef typename radix_sort_key<key_type>::type unsigned_key_type;
+
+        std::size_t const count = last - first;
+
+        // the buffer is default initialized only, for arithmetic types this
+        // does not touch the memory
+        boost::shared_array<value_type> buffer(new value_type[count]);
+
+        bool in_buffer = false;
+        for (std::size_t shift = 0;
+             shift < sizeof(unsigned_key_type) * CHAR_BIT;
+             shift += radix_sort_bits_per_digit)
+        {
+            bool moved = in_buffer ?
+                radix_sort_pass<ExPolicy, key_type>(policy, buffer.get(),
+                    first, count, chunk_size, proj, shift) :
+                radix_sort_pass<ExPolicy, key_type>(policy, first,
+                    buffer.get(), count, chunk_size, proj, shift);
+
+            if (moved)
+                in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+            radix_sort_move(policy, buffer.get(), first, count, chunk_size);
+
+        return last;
+    }
+
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    hpx::future<RandomIt>
+    parallel_radix_sort_async(ExPolicy && policy, RandomIt first,
+        RandomIt last, Proj && proj)
+    {
+        typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+        typedef typename hpx::util::decay<Proj>::type proj_type;
+
+        std::size_t const count = last - first;
+
+        // honor the chunk size requested by the executor parameters, by
+        // default create four chunks per core, however chunks should not get
+        // too small to amortize the per-chunk histograms
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+        std::size_t chunk_size = execution::get_chunk_size(
+            policy.parameters(), policy.executor(), []{ return 0; },
+            cores, count);
+        if (chunk_size == 0)
+            chunk_size = (count + 4 * cores - 1) / (4 * cores);
+        chunk_size = (std::max)(chunk_size, radix_sort_min_chunk_size);
+
+        return execution::async_execute(
+            policy.executor(),
+            std::bind(
+                [first, last, chunk_size](
+                    policy_type& policy, proj_type& proj) -> RandomIt
+                {
+                    return radix_sort(policy, first, last, proj, chunk_size);
+                },
+                std::forward<ExPolicy>(policy), std::forward<Proj>(proj)));
+    }
+
+    /// \endcond
+}}}}
+
+#endif
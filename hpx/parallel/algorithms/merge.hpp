@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/tagged_tuple.hpp>
@@ -353,6 +354,37 @@ namespace hpx { namespace parallel { inline namespace v1
                 }
             }
         };
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<RandIter1, RandIter2, RandIter3>
+        >::type
+        merge_(ExPolicy && policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest,
+            Comp && comp, Proj1 && proj1, Proj2 && proj2, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+            typedef hpx::util::tuple<RandIter1, RandIter2, RandIter3>
+                result_type;
+
+            return detail::merge<result_type>().call(
+                std::forward<ExPolicy>(policy), is_seq(),
+                first1, last1, first2, last2, dest,
+                std::forward<Comp>(comp),
+                std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<SegIter1, SegIter2, SegIter3>
+        >::type
+        merge_(ExPolicy && policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, SegIter3 dest,
+            Comp && comp, Proj1 && proj1, Proj2 && proj2, std::true_type);
         /// \endcond
     }
 
@@ -489,16 +521,19 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_random_access_iterator<RandIter3>::value),
             "Requires at least random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
-        typedef hpx::util::tuple<RandIter1, RandIter2, RandIter3> result_type;
+        typedef std::integral_constant<bool,
+                hpx::traits::is_segmented_iterator<RandIter1>::value &&
+                hpx::traits::is_segmented_iterator<RandIter2>::value &&
+                hpx::traits::is_segmented_iterator<RandIter3>::value
+            > is_segmented;
 
         return hpx::util::make_tagged_tuple<tag::in1, tag::in2, tag::out>(
-            detail::merge<result_type>().call(
-                std::forward<ExPolicy>(policy), is_seq(),
+            detail::merge_(
+                std::forward<ExPolicy>(policy),
                 first1, last1, first2, last2, dest,
                 std::forward<Comp>(comp),
                 std::forward<Proj1>(proj1),
-                std::forward<Proj2>(proj2)));
+                std::forward<Proj2>(proj2), is_segmented()));
     }
 
     /////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,301 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_OCT_18_2026_0308AM)
+#define HPX_PARALLEL_ALGORITHM_NTH_ELEMENT_OCT_18_2026_0308AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        //---------------------------------------------------------------------
+        //  function : nth_element_helper
+        /// \brief Quickselect based on parallel partitioning. Every step
+        ///        partitions the remaining range around a median-of-three
+        ///        pivot into [< pivot), [== pivot) and [> pivot) and
+        ///        continues with the part containing nth only. Once the
+        ///        remaining range gets smaller than chunk_size it is handled
+        ///        by std::nth_element.
+        //---------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void nth_element_helper(ExPolicy && policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare const& comp,
+            std::size_t chunk_size)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            while (nth != last && std::size_t(last - first) > chunk_size)
+            {
+                //---------------------- pivot select ------------------------
+                RandomIt it_a = first;
+                RandomIt it_b = first + ((last - first) >> 1);
+                RandomIt it_c = last - 1;
+
+                if (comp(*it_b, *it_a))
+                    std::swap(it_a, it_b);
+                if (comp(*it_c, *it_b))
+                {
+                    it_b = it_c;
+                    if (comp(*it_b, *it_a))
+                        it_b = it_a;
+                }
+
+                value_type const pivot = *it_b;
+
+                // [first, boundary) holds all elements less than the pivot
+                RandomIt boundary = partition_helper::call(policy, first, last,
+                    [&comp, &pivot](value_type const& val) -> bool
+                    {
+                        return comp(val, pivot);
+                    },
+                    util::projection_identity());
+
+                if (nth < boundary)
+                {
+                    last = boundary;
+                    continue;
+                }
+
+                // [boundary, equal_last) holds all elements equal to the
+                // pivot, this range is never empty as it contains the pivot
+                RandomIt equal_last = partition_helper::call(policy,
+                    boundary, last,
+                    [&comp, &pivot](value_type const& val) -> bool
+                    {
+                        return !comp(pivot, val);
+                    },
+                    util::projection_identity());
+                HPX_ASSERT(boundary != equal_last);
+
+                if (nth < equal_last)
+                    return;
+
+                first = equal_last;
+            }
+
+            std::nth_element(first, nth, last, comp);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_nth_element(ExPolicy && policy, RandomIt first, RandomIt nth,
+            RandomIt last, Compare && comp)
+        {
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+            typedef typename hpx::util::decay<Compare>::type compare_type;
+
+            std::size_t chunk_size = sort_chunk_size(policy, last - first);
+
+            return execution::async_execute(
+                policy.executor(),
+                std::bind(
+                    [first, nth, last, chunk_size](
+                        policy_type& policy, compare_type& comp) -> RandomIt
+                    {
+                        try {
+                            nth_element_helper(policy, first, nth, last, comp,
+                                chunk_size);
+                            return last;
+                        }
+                        catch (...) {
+                            util::detail::handle_local_exceptions<
+                                    policy_type
+                                >::call(std::current_exception());
+                        }
+
+                        // Not reachable.
+                        HPX_ASSERT(false);
+                        return last;
+                    },
+                    std::forward<ExPolicy>(policy),
+                    std::forward<Compare>(comp)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // nth_element
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt nth, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+
+                typedef util::compare_projected<
+                        typename hpx::util::decay<Compare>::type,
+                        typename hpx::util::decay<Proj>::type
+                    > compare_type;
+
+                if (first == last || nth == last)
+                    return algorithm_result::get(std::move(last));
+
+                try {
+                    return algorithm_result::get(
+                        parallel_nth_element(
+                            std::forward<ExPolicy>(policy), first, nth, last,
+                            compare_type(std::forward<Compare>(comp),
+                                std::forward<Proj>(proj))));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would
+    /// occur in that position if [first, last) were sorted, and all elements
+    /// before \a nth are less than or equal to the elements after it.
+    /// If \a nth == \a last the function has no effect.
+    ///
+    /// \note   Complexity: O(N) applications of the predicate on average,
+    ///                     where N = std::distance(first, last).
+    ///
+    /// The parallel versions use a quickselect scheme in which each
+    /// partitioning step is performed in parallel.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the element which will be placed at its
+    ///                     sorted position.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    nth_element(ExPolicy && policy, RandomIt first, RandomIt nth,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/tagged_pair.hpp>
 #include <hpx/util/unused.hpp>
@@ -206,6 +207,27 @@ namespace hpx { namespace parallel { inline namespace v1
                     std::move(f4));
             }
         };
+
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        remove_if_(ExPolicy && policy, FwdIter first, FwdIter last,
+            Pred && pred, Proj && proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::remove_if<FwdIter>().call(
+                    std::forward<ExPolicy>(policy), is_seq(),
+                    first, last, std::forward<Pred>(pred),
+                    std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        remove_if_(ExPolicy && policy, SegIter first, SegIter last,
+            Pred && pred, Proj && proj, std::true_type);
         /// \endcond
     }
 
@@ -294,16 +316,42 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_forward_iterator<FwdIter>::value),
             "Required at least forward iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
 
-        return detail::remove_if<FwdIter>().call(
-                std::forward<ExPolicy>(policy), is_seq(),
-                first, last, std::forward<Pred>(pred),
-                std::forward<Proj>(proj));
+        return detail::remove_if_(
+                std::forward<ExPolicy>(policy), first, last,
+                std::forward<Pred>(pred), std::forward<Proj>(proj),
+                is_segmented());
     }
 
     /////////////////////////////////////////////////////////////////////////////
     // remove
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // serializable predicate, allows for remove to be used with
+        // segmented iterators
+        template <typename T>
+        struct remove_equal_to
+        {
+            T value_;
+
+            template <typename U>
+            bool operator()(U const& a) const
+            {
+                return value_ == a;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & value_;
+            }
+        };
+        /// \endcond
+    }
+
     /// Removes all elements satisfying specific criteria from the range
     /// [first, last) and returns a past-the-end iterator for the new
     /// end of the range. This version removes all elements that are
@@ -367,15 +415,9 @@ namespace hpx { namespace parallel { inline namespace v1
     remove(ExPolicy && policy, FwdIter first, FwdIter last,
         T const& value, Proj && proj = Proj())
     {
-        typedef typename std::iterator_traits<FwdIter>::value_type Type;
-
         // Just utilize existing parallel remove_if.
         return remove_if(std::forward<ExPolicy>(policy),
-                first, last,
-                [value](Type const& a) -> bool
-                {
-                    return value == a;
-                },
+                first, last, detail::remove_equal_to<T>{value},
                 std::forward<Proj>(proj));
     }
 }}}
@@ -13,12 +13,14 @@
 #include <hpx/dataflow.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/exception_list.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
@@ -169,23 +171,15 @@ namespace hpx { namespace parallel { inline namespace v1
         }
 
         //------------------------------------------------------------------------
-        //  function : parallel_sort_async
+        //  function : sort_chunk_size
         //------------------------------------------------------------------------
-        /// @param [in] first : iterator to the first element to sort
-        /// @param [in] last : iterator to the next element after the last
-        /// @param [in] comp : object for to compare
-        /// @exception
-        /// @return
-        /// @remarks
-        template <typename ExPolicy, typename RandomIt, typename Compare>
-        hpx::future<RandomIt>
-        parallel_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
-            Compare comp)
+        /// Calculate the number of elements a single task should sort
+        /// sequentially, taking into account the executor parameters of the
+        /// given execution policy. The result is never smaller than
+        /// sort_limit_per_task.
+        template <typename ExPolicy>
+        std::size_t sort_chunk_size(ExPolicy && policy, std::size_t count)
         {
-            // number of elements to sort
-            std::size_t count = last - first;
-
-            // figure out the chunk size to use
             std::size_t const cores = execution::processing_units_count(
                 policy.executor(), policy.parameters());
 
@@ -208,6 +202,29 @@ namespace hpx { namespace parallel { inline namespace v1
             // we should not get smaller than our sort_limit_per_task
             chunk_size = (std::max)(chunk_size, sort_limit_per_task);
 
+            return chunk_size;
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_sort_async
+        //------------------------------------------------------------------------
+        /// @param [in] first : iterator to the first element to sort
+        /// @param [in] last : iterator to the next element after the last
+        /// @param [in] comp : object for to compare
+        /// @exception
+        /// @return
+        /// @remarks
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare comp)
+        {
+            // number of elements to sort
+            std::size_t count = last - first;
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, count);
+
             std::ptrdiff_t N = last - first;
             HPX_ASSERT(N >= 0);
 
@@ -236,6 +253,42 @@ namespace hpx { namespace parallel { inline namespace v1
               : sort::algorithm("sort")
             {}
 
+        private:
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt>
+            parallel_sort_dispatch(ExPolicy && policy, RandomIt first,
+                RandomIt last, Compare && comp, Proj && proj, std::false_type)
+            {
+                return parallel_sort_async(std::forward<ExPolicy>(policy),
+                    first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)
+                    ));
+            }
+
+            // arithmetic keys compared using operator<() are sorted using a
+            // radix sort as long as the range is large enough to be split
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static hpx::future<RandomIt>
+            parallel_sort_dispatch(ExPolicy && policy, RandomIt first,
+                RandomIt last, Compare && comp, Proj && proj, std::true_type)
+            {
+                if (std::size_t(last - first) < sort_limit_per_task)
+                {
+                    return parallel_sort_dispatch(
+                        std::forward<ExPolicy>(policy), first, last,
+                        std::forward<Compare>(comp), std::forward<Proj>(proj),
+                        std::false_type());
+                }
+
+                return parallel_radix_sort_async(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Proj>(proj));
+            }
+
+        public:
+
             template <typename ExPolicy, typename Compare, typename Proj>
             static RandomIt
             sequential(ExPolicy, RandomIt first, RandomIt last,
@@ -260,16 +313,17 @@ namespace hpx { namespace parallel { inline namespace v1
                     ExPolicy, RandomIt
                 > algorithm_result;
 
+                typedef std::integral_constant<bool,
+                        use_radix_sort<RandomIt, Compare, Proj>::value
+                    > radix_sort_tag;
+
                 try {
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(
-                        parallel_sort_async(std::forward<ExPolicy>(policy),
-                            first, last,
-                            util::compare_projected<Compare, Proj>(
-                                std::forward<Compare>(comp),
-                                std::forward<Proj>(proj)
-                            )));
+                        parallel_sort_dispatch(std::forward<ExPolicy>(policy),
+                            first, last, std::forward<Compare>(comp),
+                            std::forward<Proj>(proj), radix_sort_tag()));
                 }
                 catch (...) {
                     return algorithm_result::get(
@@ -278,6 +332,26 @@ namespace hpx { namespace parallel { inline namespace v1
                 }
             }
         };
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return detail::sort<RandomIt>().call(
+                std::forward<ExPolicy>(policy), is_seq(), first, last,
+                std::forward<Compare>(comp), std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy && policy, SegIter first, SegIter last,
+            Compare && comp, Proj && proj, std::true_type);
         /// \endcond
     }
 
@@ -296,6 +370,11 @@ namespace hpx { namespace parallel { inline namespace v1
     /// pointing to an element of the sequence, and
     /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
     ///
+    /// If the (projected) elements are of an integral or floating point type
+    /// and \a comp is either \a std::less or the default comparison, the
+    /// parallel versions sort large sequences using a radix sort performing
+    /// O(N) operations instead.
+    ///
     /// \tparam ExPolicy    The type of the execution policy to use (deduced).
     ///                     It describes the manner in which the execution
     ///                     of the algorithm may be parallelized and the manner
@@ -368,11 +447,12 @@ namespace hpx { namespace parallel { inline namespace v1
             (hpx::traits::is_random_access_iterator<RandomIt>::value),
             "Requires a random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<RandomIt> is_segmented;
 
-        return detail::sort<RandomIt>().call(
-            std::forward<ExPolicy>(policy), is_seq(), first, last,
-            std::forward<Compare>(comp), std::forward<Proj>(proj));
+        return detail::sort_(
+            std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}
 
@@ -0,0 +1,374 @@
+//  Copyright (c) 2015 John Biddiscombe
+//  Copyright (c) 2015-2017 Hartmut Kaiser
+//  Copyright (c) 2015 Francisco Jose Tapia
+//  Copyright (c) 2018 Taeguk Kwon
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_OCT_18_2026_0308AM)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_OCT_18_2026_0308AM
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/exception_list.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/executors/execution_parameters.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The merge steps read their input through std::move_iterator. This
+        // projection makes sure the comparison function always sees a const
+        // lvalue, even if it takes its arguments by value.
+        struct stable_sort_projection
+        {
+            template <typename T>
+            HPX_FORCEINLINE T const& operator()(T const& val) const
+            {
+                return val;
+            }
+        };
+
+        //---------------------------------------------------------------------
+        //  function : stable_sort_thread
+        /// \brief Sorts [first, last) by recursively splitting the range in
+        ///        halves, sorting both halves concurrently and merging them
+        ///        in parallel. The two halves are sorted into the opposite
+        ///        sequence (ping-pong buffering), so every level performs
+        ///        exactly one merge pass over the data.
+        ///
+        /// \param into_dest : if true the sorted elements are placed into
+        ///                    the sequence starting at dest, otherwise they
+        ///                    are left in [first, last)
+        //---------------------------------------------------------------------
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        hpx::future<void> stable_sort_thread(ExPolicy policy,
+            Iter1 first, Iter1 last, Iter2 dest, Compare comp,
+            std::size_t chunk_size, bool into_dest)
+        {
+            std::ptrdiff_t N = last - first;
+            if (std::size_t(N) <= chunk_size)
+            {
+                return execution::async_execute(
+                    policy.executor(),
+                    [first, last, dest, into_dest, HPX_CAPTURE_MOVE(comp)]()
+                    -> void
+                    {
+                        std::stable_sort(first, last, comp);
+                        if (into_dest)
+                            std::move(first, last, dest);
+                    });
+            }
+
+            //----------------------------------------------------------------
+            //                     split
+            //----------------------------------------------------------------
+            Iter1 mid = first + (N >> 1);
+            Iter2 dest_mid = dest + (N >> 1);
+            Iter2 dest_last = dest + N;
+
+            // spawn tasks for each sub section, the sorted halves end up in
+            // the sequence we will merge from
+            hpx::future<void> left = execution::async_execute(
+                policy.executor(),
+                &stable_sort_thread<ExPolicy, Iter1, Iter2, Compare>,
+                policy, first, mid, dest, comp, chunk_size, !into_dest);
+
+            hpx::future<void> right = execution::async_execute(
+                policy.executor(),
+                &stable_sort_thread<ExPolicy, Iter1, Iter2, Compare>,
+                policy, mid, last, dest_mid, comp, chunk_size, !into_dest);
+
+            return hpx::dataflow(
+                [policy, first, mid, last, dest, dest_mid, dest_last,
+                    comp, into_dest](
+                    hpx::future<void> && left, hpx::future<void> && right)
+                -> void
+                {
+                    if (left.has_exception() || right.has_exception())
+                    {
+                        std::list<std::exception_ptr> errors;
+                        if (left.has_exception())
+                            errors.push_back(left.get_exception_ptr());
+                        if (right.has_exception())
+                            errors.push_back(right.get_exception_ptr());
+
+                        throw exception_list(std::move(errors));
+                    }
+
+                    // lower_bound_helper makes the merge stable: elements of
+                    // the left half precede equivalent ones of the right half
+                    if (into_dest)
+                    {
+                        parallel_merge_helper(policy,
+                            std::make_move_iterator(first),
+                            std::make_move_iterator(mid),
+                            std::make_move_iterator(mid),
+                            std::make_move_iterator(last),
+                            dest, comp, stable_sort_projection(),
+                            stable_sort_projection(), false,
+                            lower_bound_helper());
+                    }
+                    else
+                    {
+                        parallel_merge_helper(policy,
+                            std::make_move_iterator(dest),
+                            std::make_move_iterator(dest_mid),
+                            std::make_move_iterator(dest_mid),
+                            std::make_move_iterator(dest_last),
+                            first, comp, stable_sort_projection(),
+                            stable_sort_projection(), false,
+                            lower_bound_helper());
+                    }
+                },
+                std::move(left), std::move(right));
+        }
+
+        //---------------------------------------------------------------------
+        //  function : parallel_stable_sort_async
+        //---------------------------------------------------------------------
+        /// @param [in] first : iterator to the first element to sort
+        /// @param [in] last : iterator to the next element after the last
+        /// @param [in] comp : object for to compare
+        /// @exception
+        /// @return
+        /// @remarks
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        parallel_stable_sort_async(ExPolicy && policy, RandomIt first,
+            RandomIt last, Compare comp)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+            typedef typename std::vector<value_type>::iterator buffer_iterator;
+            typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+
+            // number of elements to sort
+            std::size_t count = last - first;
+
+            // figure out the chunk size to use
+            std::size_t chunk_size = sort_chunk_size(policy, count);
+
+            if (count < chunk_size)
+            {
+                std::stable_sort(first, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+                return hpx::make_ready_future(last);
+
+            // The elements are moved into a temporary buffer which is then
+            // sorted back into [first, last). This avoids requiring the
+            // value_type to be default constructible.
+            std::shared_ptr<std::vector<value_type> > buffer =
+                std::make_shared<std::vector<value_type> >(
+                    std::make_move_iterator(first),
+                    std::make_move_iterator(last));
+
+            hpx::future<void> f = execution::async_execute(policy.executor(),
+                &stable_sort_thread<policy_type, buffer_iterator, RandomIt,
+                    Compare>,
+                std::forward<ExPolicy>(policy), buffer->begin(), buffer->end(),
+                first, comp, chunk_size, true);
+
+            return f.then(
+                [last, buffer](hpx::future<void> && f) -> RandomIt
+                {
+                    f.get();        // rethrow exceptions
+                    return last;
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+
+                typedef util::compare_projected<
+                        typename hpx::util::decay<Compare>::type,
+                        typename hpx::util::decay<Proj>::type
+                    > compare_type;
+
+                try {
+                    // call the sort routine and return the right type,
+                    // depending on execution policy
+                    return algorithm_result::get(
+                        parallel_stable_sort_async(
+                            std::forward<ExPolicy>(policy), first, last,
+                            compare_type(std::forward<Compare>(comp),
+                                std::forward<Proj>(proj))));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// relative order of equal elements is preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// The parallel versions sort chunks of the input concurrently and
+    /// merge them pairwise in parallel. They allocate a temporary buffer
+    /// large enough to hold all elements of the input sequence.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy && policy, RandomIt first, RandomIt last,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
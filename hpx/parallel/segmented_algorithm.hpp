@@ -9,10 +9,16 @@
 #include <hpx/config.hpp>
 #include <hpx/parallel/algorithm.hpp>
 
+#include <hpx/parallel/segmented_algorithms/copy.hpp>
 #include <hpx/parallel/segmented_algorithms/count.hpp>
 #include <hpx/parallel/segmented_algorithms/for_each.hpp>
 #include <hpx/parallel/segmented_algorithms/generate.hpp>
+#include <hpx/parallel/segmented_algorithms/merge.hpp>
 #include <hpx/parallel/segmented_algorithms/minmax.hpp>
+#include <hpx/parallel/segmented_algorithms/partition.hpp>
+#include <hpx/parallel/segmented_algorithms/remove.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/unique.hpp>
 
 #endif
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_COPY_IF_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_COPY_IF_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/count.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_copy_if
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The matching elements are counted in all source segments first.
+        // Every destination segment then fetches the matching elements it
+        // receives from each of the source segments.
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred, typename Proj>
+        std::pair<SegIter, SegOutIter> segmented_copy_if(
+            ExPolicy const& policy, SegIter first, SegIter last,
+            SegOutIter dest, Pred const& pred, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef typename std::iterator_traits<SegIter>::difference_type
+                difference_type;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type> > ranges =
+                get_segment_ranges(first, last);
+
+            std::vector<hpx::future<difference_type> > counted;
+            counted.reserve(ranges.size());
+            for (auto const& r : ranges)
+            {
+                counted.push_back(dispatch_async(r.id_,
+                    detail::count_if<difference_type>(), policy, is_seq(),
+                    r.first_, std::next(r.first_, r.size_), pred, proj));
+            }
+            wait_segments<ExPolicy>(counted);
+
+            // offsets of the matching elements of all sources
+            std::vector<std::size_t> offsets(ranges.size() + 1, 0);
+            for (std::size_t s = 0; s != ranges.size(); ++s)
+            {
+                offsets[s + 1] = offsets[s] + std::size_t(counted[s].get());
+            }
+
+            SegOutIter dest_last = std::next(dest, offsets.back());
+
+            std::vector<segment_destination<
+                    local_output_iterator_type, local_iterator_type
+                > > destinations;
+
+            std::size_t offset = 0;
+            for (auto const& d : get_segment_ranges(dest, dest_last))
+            {
+                segment_destination<
+                        local_output_iterator_type, local_iterator_type
+                    > dest_segment(d, d.size_);
+
+                for (std::size_t s = 0; s != ranges.size(); ++s)
+                {
+                    std::size_t lo = (std::max)(offset, offsets[s]);
+                    std::size_t hi = (std::min)(offset + d.size_,
+                        offsets[s + 1]);
+                    if (lo >= hi)
+                        continue;
+
+                    segment_range<local_iterator_type> const& r = ranges[s];
+                    dest_segment.slices1_.push_back(
+                        segment_slice<local_iterator_type>{r.id_, r.first_,
+                            std::next(r.first_, r.size_), lo - offsets[s],
+                            hi - lo});
+                }
+
+                destinations.push_back(std::move(dest_segment));
+                offset += d.size_;
+            }
+
+            run_exchange<value_type>(policy, destinations,
+                exchange_matching<Pred, Proj>{pred, proj}, exchange_concat(),
+                false);
+
+            return std::make_pair(last, dest_last);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<SegIter, SegOutIter>
+        >::type
+        copy_if_(ExPolicy && policy, SegIter first, SegIter last,
+            SegOutIter dest, Pred && pred, Proj && proj, std::true_type)
+        {
+            typedef exchange_policy<ExPolicy> policy_type;
+            typedef typename hpx::util::decay<Pred>::type pred_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+            typedef std::pair<SegIter, SegOutIter> result_type;
+
+            typename policy_type::type p = policy_type::get();
+            pred_type pr(std::forward<Pred>(pred));
+            proj_type pj(std::forward<Proj>(proj));
+
+            return exchange_result<ExPolicy, result_type>(
+                [p, first, last, dest, pr, pj]() -> result_type
+                {
+                    return segmented_copy_if(p, first, last, dest, pr, pj);
+                });
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename Pred, typename Proj>
+        typename util::detail::algorithm_result<
+            ExPolicy, std::pair<FwdIter1, FwdIter2>
+        >::type
+        copy_if_(ExPolicy && policy, FwdIter1 first, FwdIter1 last,
+            FwdIter2 dest, Pred && pred, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,945 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHMS_EXCHANGE_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHMS_EXCHANGE_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/barrier.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The algorithms which reorder the elements of a segmented range (sort,
+// remove_if, unique, partition, copy_if, merge) are implemented as a bulk
+// exchange: every destination segment fetches the (contiguous) slices of
+// the source segments it needs with one request per source segment,
+// combines them locally and moves the result into place. Algorithms
+// operating in place synchronize all destinations using a barrier before
+// anything is overwritten.
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A contiguous part of a segmented range stored in a single segment
+    template <typename LocalIter>
+    struct segment_range
+    {
+        id_type id_;
+        LocalIter first_;
+        std::size_t size_;
+    };
+
+    // Split the range [first, last) into the parts stored in the segments
+    // it spans. Empty parts are skipped.
+    template <typename SegIter>
+    std::vector<segment_range<
+        typename hpx::traits::segmented_iterator_traits<
+            SegIter
+        >::local_iterator> >
+    get_segment_ranges(SegIter first, SegIter last)
+    {
+        typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+        typedef typename traits::segment_iterator segment_iterator;
+        typedef typename traits::local_iterator local_iterator_type;
+
+        std::vector<segment_range<local_iterator_type> > ranges;
+
+        auto add_range =
+            [&ranges](segment_iterator const& sit,
+                local_iterator_type beg, local_iterator_type end)
+            {
+                std::size_t size = std::distance(beg, end);
+                if (size != 0)
+                {
+                    ranges.push_back(segment_range<local_iterator_type>{
+                        traits::get_id(sit), beg, size});
+                }
+            };
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            add_range(sit, traits::local(first), traits::local(last));
+        }
+        else
+        {
+            // handle the remaining part of the first partition
+            add_range(sit, traits::local(first), traits::end(sit));
+
+            // handle all of the full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                add_range(sit, traits::begin(sit), traits::end(sit));
+            }
+
+            // handle the beginning of the last partition
+            add_range(sit, traits::begin(sit), traits::local(last));
+        }
+
+        return ranges;
+    }
+
+    // Return the global offsets of the given ranges (plus the overall size
+    // as the last element)
+    template <typename LocalIter>
+    std::vector<std::size_t> get_segment_offsets(
+        std::vector<segment_range<LocalIter> > const& ranges)
+    {
+        std::vector<std::size_t> offsets;
+        offsets.reserve(ranges.size() + 1);
+
+        std::size_t offset = 0;
+        for (segment_range<LocalIter> const& r : ranges)
+        {
+            offsets.push_back(offset);
+            offset += r.size_;
+        }
+        offsets.push_back(offset);
+
+        return offsets;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The policy used for the operations executed on the segments. Task
+    // policies are turned into their synchronous counterparts as the
+    // segmented algorithms themselves run asynchronously in this case.
+    template <typename ExPolicy>
+    struct exchange_policy
+    {
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        typedef typename std::conditional<
+                is_seq::value,
+                execution::sequenced_policy, execution::parallel_policy
+            >::type type;
+
+        static type get()
+        {
+            return type();
+        }
+    };
+
+    // Invoke the given function either synchronously or, for task
+    // policies, asynchronously on a new HPX thread.
+    template <typename ExPolicy, typename R, typename F>
+    typename util::detail::algorithm_result<ExPolicy, R>::type
+    exchange_result(F && f, std::false_type)
+    {
+        return util::detail::algorithm_result<ExPolicy, R>::get(f());
+    }
+
+    template <typename ExPolicy, typename R, typename F>
+    typename util::detail::algorithm_result<ExPolicy, R>::type
+    exchange_result(F && f, std::true_type)
+    {
+        return util::detail::algorithm_result<ExPolicy, R>::get(
+            hpx::async(std::forward<F>(f)));
+    }
+
+    template <typename ExPolicy, typename R, typename F>
+    typename util::detail::algorithm_result<ExPolicy, R>::type
+    exchange_result(F && f)
+    {
+        typedef execution::is_async_execution_policy<ExPolicy> is_async;
+        return exchange_result<ExPolicy, R>(std::forward<F>(f), is_async());
+    }
+
+    // Wait for all of the given futures and rethrow any remote exceptions
+    template <typename ExPolicy, typename T>
+    void wait_segments(std::vector<hpx::future<T> > const& segments)
+    {
+        hpx::wait_all(segments);
+
+        std::list<std::exception_ptr> errors;
+        parallel::util::detail::handle_remote_exceptions<
+                ExPolicy
+            >::call(segments, errors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The part of a source segment fetched by a destination. The first
+    // skip_ elements accepted by the filter are ignored, the following
+    // count_ elements are fetched.
+    template <typename LocalIter>
+    struct segment_slice
+    {
+        id_type id_;
+        LocalIter first_;
+        LocalIter last_;
+        std::size_t skip_;
+        std::size_t count_;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & id_ & first_ & last_ & skip_ & count_;
+        }
+    };
+
+    template <typename LocalIter>
+    segment_slice<LocalIter> make_segment_slice(
+        segment_range<LocalIter> const& r, std::size_t first, std::size_t last)
+    {
+        HPX_ASSERT(first <= last && last <= r.size_);
+        return segment_slice<LocalIter>{r.id_,
+            std::next(r.first_, first), std::next(r.first_, last),
+            0, last - first};
+    }
+
+    // filters selecting the elements of a slice
+    struct exchange_all
+    {
+        template <typename T>
+        bool operator()(T const&) const
+        {
+            return true;
+        }
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+    };
+
+    template <typename Pred, typename Proj>
+    struct exchange_matching
+    {
+        Pred pred_;
+        Proj proj_;
+
+        template <typename T>
+        bool operator()(T const& t) const
+        {
+            return hpx::util::invoke(pred_, hpx::util::invoke(proj_, t));
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & pred_ & proj_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy the elements of a slice which are accepted by the filter
+    template <typename T>
+    struct segment_fetch
+      : public detail::algorithm<segment_fetch<T>, std::vector<T> >
+    {
+        segment_fetch()
+          : segment_fetch::algorithm("segment_fetch")
+        {}
+
+        template <typename ExPolicy, typename InIter, typename Filter>
+        static std::vector<T>
+        sequential(ExPolicy, InIter first, InIter last, std::size_t skip,
+            std::size_t count, Filter const& filter)
+        {
+            std::vector<T> result;
+            result.reserve(count);
+
+            for (/**/; first != last && result.size() != count; ++first)
+            {
+                if (!filter(*first))
+                    continue;
+
+                if (skip != 0)
+                {
+                    --skip;
+                    continue;
+                }
+
+                result.push_back(*first);
+            }
+
+            HPX_ASSERT(result.size() == count);
+            return result;
+        }
+
+        template <typename ExPolicy, typename InIter, typename Filter>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::vector<T>
+        >::type
+        parallel(ExPolicy && policy, InIter first, InIter last,
+            std::size_t skip, std::size_t count, Filter const& filter)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, std::vector<T>
+                >::get(sequential(policy, first, last, skip, count, filter));
+        }
+    };
+
+    // Fetch all given slices (concurrently) and concatenate the results
+    template <typename T, typename LocalIter, typename Filter>
+    std::vector<T> fetch_segment_slices(
+        std::vector<segment_slice<LocalIter> > const& slices,
+        Filter const& filter)
+    {
+        std::vector<hpx::future<std::vector<T> > > fetched;
+        fetched.reserve(slices.size());
+
+        std::size_t count = 0;
+        for (segment_slice<LocalIter> const& s : slices)
+        {
+            fetched.push_back(dispatch_async(s.id_, segment_fetch<T>(),
+                execution::seq, std::true_type(), s.first_, s.last_,
+                s.skip_, s.count_, filter));
+            count += s.count_;
+        }
+
+        wait_segments<execution::sequenced_policy>(fetched);
+
+        std::vector<T> result;
+        result.reserve(count);
+        for (hpx::future<std::vector<T> >& f : fetched)
+        {
+            std::vector<T> data = f.get();
+            result.insert(result.end(), std::make_move_iterator(data.begin()),
+                std::make_move_iterator(data.end()));
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combining the data fetched by a destination
+    struct exchange_concat
+    {
+        template <typename ExPolicy, typename T>
+        std::vector<T> operator()(ExPolicy, std::vector<T> && first,
+            std::vector<T> && second) const
+        {
+            if (first.empty())
+                return std::move(second);
+
+            first.insert(first.end(), std::make_move_iterator(second.begin()),
+                std::make_move_iterator(second.end()));
+            return std::move(first);
+        }
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+    };
+
+    template <typename Comp, typename Proj>
+    struct exchange_sort
+    {
+        Comp comp_;
+        Proj proj_;
+
+        template <typename ExPolicy, typename T>
+        std::vector<T> operator()(ExPolicy policy, std::vector<T> && first,
+            std::vector<T> && second) const
+        {
+            typedef typename std::vector<T>::iterator iterator;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<T> data = exchange_concat()(
+                policy, std::move(first), std::move(second));
+
+            detail::sort<iterator>().call(std::move(policy), is_seq(),
+                data.begin(), data.end(), comp_, proj_);
+            return data;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & comp_ & proj_;
+        }
+    };
+
+    template <typename Comp, typename Proj1, typename Proj2>
+    struct exchange_merge
+    {
+        Comp comp_;
+        Proj1 proj1_;
+        Proj2 proj2_;
+
+        template <typename ExPolicy, typename T>
+        std::vector<T> operator()(ExPolicy, std::vector<T> && first,
+            std::vector<T> && second) const
+        {
+            std::vector<T> data(first.size() + second.size());
+            detail::sequential_merge(
+                std::make_move_iterator(first.begin()),
+                std::make_move_iterator(first.end()),
+                std::make_move_iterator(second.begin()),
+                std::make_move_iterator(second.end()),
+                data.begin(), comp_, proj1_, proj2_);
+            return data;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & comp_ & proj1_ & proj2_;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Synchronizes all destinations of an in-place exchange, no destination
+    // may overwrite its elements before all destinations have fetched
+    // their data.
+    struct exchange_barrier
+    {
+        std::string name_;
+        std::size_t num_;
+        std::size_t rank_;
+
+        void wait() const
+        {
+            if (num_ > 1)
+            {
+                hpx::lcos::barrier b(name_, num_, rank_);
+                b.wait();
+            }
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & name_ & num_ & rank_;
+        }
+    };
+
+    inline std::string get_exchange_barrier_name()
+    {
+        static std::atomic<std::size_t> count(0);
+        return "/hpx/parallel/segmented_exchange/" +
+            std::to_string(hpx::get_locality_id()) + "/" +
+            std::to_string(++count);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Fetch the slices required by a destination, combine them and move
+    // count elements (starting at skip) of the result into place.
+    template <typename T>
+    struct segment_assemble
+      : public detail::algorithm<segment_assemble<T>, std::size_t>
+    {
+        segment_assemble()
+          : segment_assemble::algorithm("segment_assemble")
+        {}
+
+        template <typename ExPolicy, typename OutIter, typename InIter1,
+            typename InIter2, typename Filter, typename Combine>
+        static std::size_t
+        sequential(ExPolicy && policy, OutIter dest, std::size_t count,
+            std::vector<segment_slice<InIter1> > const& slices1,
+            std::vector<segment_slice<InIter2> > const& slices2,
+            std::size_t skip, Filter const& filter, Combine const& combine,
+            exchange_barrier const& barrier)
+        {
+            std::vector<T> data;
+            std::exception_ptr error;
+
+            try {
+                data = combine(policy,
+                    fetch_segment_slices<T>(slices1, filter),
+                    fetch_segment_slices<T>(slices2, filter));
+                HPX_ASSERT(skip + count <= data.size());
+            }
+            catch (...) {
+                // all destinations have to enter the barrier
+                error = std::current_exception();
+            }
+
+            barrier.wait();
+
+            if (error)
+                std::rethrow_exception(error);
+
+            std::move(data.begin() + skip, data.begin() + skip + count, dest);
+            return count;
+        }
+
+        template <typename ExPolicy, typename OutIter, typename InIter1,
+            typename InIter2, typename Filter, typename Combine>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::size_t
+        >::type
+        parallel(ExPolicy && policy, OutIter dest, std::size_t count,
+            std::vector<segment_slice<InIter1> > const& slices1,
+            std::vector<segment_slice<InIter2> > const& slices2,
+            std::size_t skip, Filter const& filter, Combine const& combine,
+            exchange_barrier const& barrier)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, std::size_t
+                >::get(sequential(policy, dest, count, slices1, slices2,
+                    skip, filter, combine, barrier));
+        }
+    };
+
+    // The data a single destination segment assembles
+    template <typename OutIter, typename InIter1 = OutIter,
+        typename InIter2 = InIter1>
+    struct segment_destination
+    {
+        segment_destination(segment_range<OutIter> const& range,
+                std::size_t count = 0, std::size_t skip = 0)
+          : range_(range), count_(count), skip_(skip)
+        {}
+
+        segment_range<OutIter> range_;
+        std::size_t count_;
+        std::size_t skip_;
+        std::vector<segment_slice<InIter1> > slices1_;
+        std::vector<segment_slice<InIter2> > slices2_;
+    };
+
+    // Run the exchange described by the given destinations. If the
+    // exchange is done in place all destinations are synchronized before
+    // any data is overwritten.
+    template <typename T, typename ExPolicy, typename OutIter,
+        typename InIter1, typename InIter2, typename Filter,
+        typename Combine>
+    void run_exchange(ExPolicy const& policy,
+        std::vector<segment_destination<OutIter, InIter1, InIter2> > const&
+            destinations,
+        Filter const& filter, Combine const& combine, bool in_place)
+    {
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        std::size_t num = 0;
+        for (auto const& d : destinations)
+        {
+            if (d.count_ != 0)
+                ++num;
+        }
+
+        std::string name;
+        if (in_place && num > 1)
+            name = get_exchange_barrier_name();
+
+        std::vector<hpx::future<std::size_t> > segments;
+        segments.reserve(num);
+
+        std::size_t rank = 0;
+        for (auto const& d : destinations)
+        {
+            if (d.count_ == 0)
+                continue;
+
+            exchange_barrier barrier{name, name.empty() ? 1 : num, rank++};
+            segments.push_back(dispatch_async(d.range_.id_,
+                segment_assemble<T>(), policy, is_seq(), d.range_.first_,
+                d.count_, d.slices1_, d.slices2_, d.skip_, filter, combine,
+                barrier));
+        }
+
+        wait_segments<ExPolicy>(segments);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A sample drawn from a (sorted) segment. Samples are ordered by their
+    // value first and by their segment and their position in it second,
+    // this way runs of equivalent elements are divided between several
+    // classes instead of ending up in a single one.
+    template <typename T>
+    struct exchange_sample
+    {
+        T value_;
+        std::size_t segment_;
+        std::size_t index_;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & value_ & segment_ & index_;
+        }
+    };
+
+    // Sort the given samples by (value, segment, index)
+    template <typename T, typename Comp, typename Proj>
+    void sort_samples(std::vector<exchange_sample<T> >& samples,
+        Comp const& comp, Proj const& proj)
+    {
+        std::sort(samples.begin(), samples.end(),
+            [&](exchange_sample<T> const& lhs, exchange_sample<T> const& rhs)
+            {
+                if (hpx::util::invoke(comp, hpx::util::invoke(proj, lhs.value_),
+                        hpx::util::invoke(proj, rhs.value_)))
+                {
+                    return true;
+                }
+                if (hpx::util::invoke(comp, hpx::util::invoke(proj, rhs.value_),
+                        hpx::util::invoke(proj, lhs.value_)))
+                {
+                    return false;
+                }
+                if (lhs.segment_ != rhs.segment_)
+                    return lhs.segment_ < rhs.segment_;
+                return lhs.index_ < rhs.index_;
+            });
+    }
+
+    // Return the number of elements of the (sorted) range which are ordered
+    // before or at each of the given splitters. Elements equivalent to a
+    // splitter are ordered by their segment and their position in it.
+    struct segment_class_bounds
+      : public detail::algorithm<
+            segment_class_bounds, std::vector<std::size_t> >
+    {
+        segment_class_bounds()
+          : segment_class_bounds::algorithm("segment_class_bounds")
+        {}
+
+        template <typename ExPolicy, typename InIter, typename T,
+            typename Comp, typename ProjS, typename Proj>
+        static std::vector<std::size_t>
+        sequential(ExPolicy, InIter first, InIter last,
+            std::vector<exchange_sample<T> > const& splitters,
+            std::size_t segment, Comp && comp, ProjS && projs, Proj && proj)
+        {
+            typedef typename std::iterator_traits<InIter>::value_type
+                value_type;
+
+            std::vector<std::size_t> bounds;
+            bounds.reserve(splitters.size());
+
+            // the bounds are monotonic, each search may start at the
+            // previous bound
+            InIter it = first;
+            for (exchange_sample<T> const& s : splitters)
+            {
+                InIter lo = std::lower_bound(it, last, s.value_,
+                    [&](value_type const& lhs, T const& rhs)
+                    {
+                        return hpx::util::invoke(comp,
+                            hpx::util::invoke(proj, lhs),
+                            hpx::util::invoke(projs, rhs));
+                    });
+                InIter hi = std::upper_bound(lo, last, s.value_,
+                    [&](T const& lhs, value_type const& rhs)
+                    {
+                        return hpx::util::invoke(comp,
+                            hpx::util::invoke(projs, lhs),
+                            hpx::util::invoke(proj, rhs));
+                    });
+
+                if (segment < s.segment_)
+                {
+                    it = hi;
+                }
+                else if (segment > s.segment_)
+                {
+                    it = lo;
+                }
+                else
+                {
+                    std::size_t pos = s.index_ + 1;
+                    std::size_t lo_pos = std::distance(first, lo);
+                    std::size_t hi_pos = std::distance(first, hi);
+                    it = std::next(first,
+                        (std::min)((std::max)(pos, lo_pos), hi_pos));
+                }
+                bounds.push_back(std::distance(first, it));
+            }
+            return bounds;
+        }
+
+        template <typename ExPolicy, typename InIter, typename T,
+            typename Comp, typename ProjS, typename Proj>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::vector<std::size_t>
+        >::type
+        parallel(ExPolicy && policy, InIter first, InIter last,
+            std::vector<exchange_sample<T> > const& splitters,
+            std::size_t segment, Comp && comp, ProjS && projs, Proj && proj)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, std::vector<std::size_t>
+                >::get(sequential(policy, first, last, splitters, segment,
+                    std::forward<Comp>(comp), std::forward<ProjS>(projs),
+                    std::forward<Proj>(proj)));
+        }
+    };
+
+    // Select num regularly spaced elements of the (sorted) range, the
+    // range being the given segment
+    template <typename T, typename InIter>
+    std::vector<exchange_sample<T> > get_regular_samples(InIter first,
+        InIter last, std::size_t num, std::size_t segment)
+    {
+        std::size_t size = std::distance(first, last);
+        num = (std::min)(num, size);
+
+        std::vector<exchange_sample<T> > samples;
+        samples.reserve(num);
+        for (std::size_t i = 0; i != num; ++i)
+        {
+            std::size_t index = ((2 * i + 1) * size) / (2 * num);
+            samples.push_back(exchange_sample<T>{
+                *std::next(first, index), segment, index});
+        }
+        return samples;
+    }
+
+    // Return regularly spaced samples of a (sorted) segment
+    template <typename T>
+    struct segment_sample
+      : public detail::algorithm<segment_sample<T>,
+            std::vector<exchange_sample<T> > >
+    {
+        segment_sample()
+          : segment_sample::algorithm("segment_sample")
+        {}
+
+        template <typename ExPolicy, typename InIter>
+        static std::vector<exchange_sample<T> >
+        sequential(ExPolicy, InIter first, InIter last, std::size_t num,
+            std::size_t segment)
+        {
+            return get_regular_samples<T>(first, last, num, segment);
+        }
+
+        template <typename ExPolicy, typename InIter>
+        static typename util::detail::algorithm_result<
+            ExPolicy, std::vector<exchange_sample<T> >
+        >::type
+        parallel(ExPolicy && policy, InIter first, InIter last,
+            std::size_t num, std::size_t segment)
+        {
+            return util::detail::algorithm_result<
+                    ExPolicy, std::vector<exchange_sample<T> >
+                >::get(sequential(policy, first, last, num, segment));
+        }
+    };
+
+    // Concatenate the samples drawn from all segments
+    template <typename T>
+    std::vector<exchange_sample<T> > collect_samples(
+        std::vector<hpx::future<std::vector<exchange_sample<T> > > >& sampled)
+    {
+        std::vector<exchange_sample<T> > samples;
+        for (auto& f : sampled)
+        {
+            std::vector<exchange_sample<T> > s = f.get();
+            samples.insert(samples.end(), std::make_move_iterator(s.begin()),
+                std::make_move_iterator(s.end()));
+        }
+        return samples;
+    }
+
+    // number of classes the elements are divided into per destination
+    // segment, more classes reduce the amount of data fetched by the
+    // destinations in excess of what they keep
+    static const std::size_t exchange_classes_per_segment = 4;
+
+    // Select num - 1 splitters from the given (sorted) samples
+    template <typename T>
+    std::vector<exchange_sample<T> > get_splitters(
+        std::vector<exchange_sample<T> > const& samples, std::size_t num)
+    {
+        std::vector<exchange_sample<T> > splitters;
+        if (num <= 1 || samples.empty())
+            return splitters;
+
+        splitters.reserve(num - 1);
+        for (std::size_t i = 1; i != num; ++i)
+        {
+            splitters.push_back(samples[(i * samples.size()) / num]);
+        }
+        return splitters;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements of the source segments are divided into classes, each
+    // class being stored contiguously in every source. As the classes are
+    // separated by (value, segment, index) equivalent elements may be
+    // spread over several classes, which keeps the classes balanced. The
+    // destinations fetch all classes overlapping with their range, combine
+    // them and keep the part corresponding to their position.
+    //
+    // bounds[s] holds the num_classes - 1 positions separating the classes
+    // in source s.
+    template <typename OutIter, typename InIter1, typename InIter2>
+    void add_class_slices(
+        std::vector<segment_destination<OutIter, InIter1, InIter2> >&
+            destinations,
+        std::vector<segment_range<InIter1> > const& sources1,
+        std::vector<std::vector<std::size_t> > const& bounds1,
+        std::vector<segment_range<InIter2> > const& sources2,
+        std::vector<std::vector<std::size_t> > const& bounds2,
+        std::size_t num_classes)
+    {
+        auto get_bound =
+            [num_classes](std::vector<std::size_t> const& b,
+                std::size_t size, std::size_t j) -> std::size_t
+            {
+                if (j == 0)
+                    return 0;
+                if (j == num_classes)
+                    return size;
+                return b[j - 1];
+            };
+
+        // global offsets of all classes
+        std::vector<std::size_t> offsets(num_classes + 1, 0);
+        for (std::size_t j = 0; j != num_classes; ++j)
+        {
+            std::size_t size = 0;
+            for (std::size_t s = 0; s != sources1.size(); ++s)
+            {
+                size += get_bound(bounds1[s], sources1[s].size_, j + 1) -
+                    get_bound(bounds1[s], sources1[s].size_, j);
+            }
+            for (std::size_t s = 0; s != sources2.size(); ++s)
+            {
+                size += get_bound(bounds2[s], sources2[s].size_, j + 1) -
+                    get_bound(bounds2[s], sources2[s].size_, j);
+            }
+            offsets[j + 1] = offsets[j] + size;
+        }
+
+        std::size_t offset = 0;
+        for (auto& d : destinations)
+        {
+            d.count_ = d.range_.size_;
+            if (d.count_ == 0)
+                continue;
+
+            // the classes overlapping with [offset, offset + count)
+            std::size_t jlo = std::distance(offsets.begin(),
+                std::upper_bound(offsets.begin(), offsets.end(), offset)) - 1;
+            std::size_t jhi = std::distance(offsets.begin(),
+                std::lower_bound(offsets.begin(), offsets.end(),
+                    offset + d.count_));
+
+            d.skip_ = offset - offsets[jlo];
+
+            for (std::size_t s = 0; s != sources1.size(); ++s)
+            {
+                std::size_t first =
+                    get_bound(bounds1[s], sources1[s].size_, jlo);
+                std::size_t last =
+                    get_bound(bounds1[s], sources1[s].size_, jhi);
+                if (first != last)
+                {
+                    d.slices1_.push_back(
+                        make_segment_slice(sources1[s], first, last));
+                }
+            }
+            for (std::size_t s = 0; s != sources2.size(); ++s)
+            {
+                std::size_t first =
+                    get_bound(bounds2[s], sources2[s].size_, jlo);
+                std::size_t last =
+                    get_bound(bounds2[s], sources2[s].size_, jhi);
+                if (first != last)
+                {
+                    d.slices2_.push_back(
+                        make_segment_slice(sources2[s], first, last));
+                }
+            }
+
+            offset += d.count_;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The kept elements of each source segment s are stored at the positions
+    // [first[s], last[s]) relative to the beginning of the segment. They are
+    // assigned in order to the positions starting at base of the
+    // concatenated destinations.
+    template <typename OutIter, typename InIter>
+    std::size_t add_compacted_slices(
+        std::vector<segment_destination<OutIter, InIter> >& destinations,
+        std::vector<segment_range<InIter> > const& sources,
+        std::vector<std::size_t> const& first,
+        std::vector<std::size_t> const& last, std::size_t base = 0)
+    {
+        // offsets of the kept elements of all sources
+        std::vector<std::size_t> offsets(sources.size() + 1, 0);
+        for (std::size_t s = 0; s != sources.size(); ++s)
+        {
+            offsets[s + 1] = offsets[s] + (last[s] - first[s]);
+        }
+
+        std::size_t total = offsets.back();
+        std::size_t offset = 0;
+        for (auto& d : destinations)
+        {
+            std::size_t lo = (std::max)(offset, base) - base;
+            std::size_t hi =
+                (std::min)(offset + d.range_.size_, base + total);
+            offset += d.range_.size_;
+
+            if (hi <= base || lo >= hi - base)
+                continue;
+
+            hi -= base;
+            d.count_ += hi - lo;
+            for (std::size_t s = 0; s != sources.size(); ++s)
+            {
+                std::size_t slo = (std::max)(lo, offsets[s]);
+                std::size_t shi = (std::min)(hi, offsets[s + 1]);
+                if (slo >= shi)
+                    continue;
+
+                std::size_t pos = first[s] + slo - offsets[s];
+                d.slices1_.push_back(make_segment_slice(
+                    sources[s], pos, pos + (shi - slo)));
+            }
+        }
+        return total;
+    }
+
+    // Destinations which would receive their own elements at the same
+    // positions do not take part in the exchange.
+    template <typename Iter>
+    void remove_unchanged_destinations(
+        std::vector<segment_destination<Iter, Iter> >& destinations)
+    {
+        for (auto& d : destinations)
+        {
+            if (d.slices1_.size() == 1 && d.slices2_.empty() &&
+                d.slices1_[0].id_ == d.range_.id_ &&
+                d.slices1_[0].first_ == d.range_.first_)
+            {
+                d.slices1_.clear();
+                d.count_ = 0;
+            }
+        }
+    }
+    /// \endcond
+}}}}
+
+#endif
@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_MERGE_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_MERGE_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_merge
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Both (sorted) input ranges are divided into classes based on
+        // splitters sampled from their segments. Every destination segment
+        // fetches the classes overlapping with its position in the result
+        // from both ranges and merges them.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegIter3, typename Comp, typename Proj1, typename Proj2>
+        hpx::util::tuple<SegIter1, SegIter2, SegIter3> segmented_merge(
+            ExPolicy const& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, SegIter3 dest,
+            Comp const& comp, Proj1 const& proj1, Proj2 const& proj2)
+        {
+            typedef typename hpx::traits::segmented_iterator_traits<
+                    SegIter1
+                >::local_iterator local_iterator_type1;
+            typedef typename hpx::traits::segmented_iterator_traits<
+                    SegIter2
+                >::local_iterator local_iterator_type2;
+            typedef typename hpx::traits::segmented_iterator_traits<
+                    SegIter3
+                >::local_iterator local_iterator_type3;
+            typedef typename std::iterator_traits<SegIter1>::value_type
+                value_type;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            static_assert(std::is_same<value_type,
+                    typename std::iterator_traits<SegIter2>::value_type
+                >::value,
+                "Requires input ranges with the same value type.");
+
+            std::vector<segment_range<local_iterator_type1> > ranges1 =
+                get_segment_ranges(first1, last1);
+            std::vector<segment_range<local_iterator_type2> > ranges2 =
+                get_segment_ranges(first2, last2);
+
+            std::size_t count = std::distance(first1, last1) +
+                std::distance(first2, last2);
+            SegIter3 dest_last = std::next(dest, count);
+
+            std::vector<segment_range<local_iterator_type3> > dest_ranges =
+                get_segment_ranges(dest, dest_last);
+            if (dest_ranges.empty())
+                return hpx::util::make_tuple(last1, last2, dest_last);
+
+            // sample both ranges
+            std::size_t num_classes =
+                exchange_classes_per_segment * dest_ranges.size();
+
+            // the segments of the second range are numbered after the ones
+            // of the first range, equivalent elements of the first range are
+            // thus ordered before the ones of the second range
+            std::size_t num_segments1 = ranges1.size();
+
+            std::vector<hpx::future<std::vector<
+                exchange_sample<value_type> > > > sampled;
+            sampled.reserve(ranges1.size() + ranges2.size());
+            for (std::size_t s = 0; s != ranges1.size(); ++s)
+            {
+                auto const& r = ranges1[s];
+                sampled.push_back(dispatch_async(r.id_,
+                    segment_sample<value_type>(), policy, is_seq(),
+                    r.first_, std::next(r.first_, r.size_), num_classes, s));
+            }
+            for (std::size_t s = 0; s != ranges2.size(); ++s)
+            {
+                auto const& r = ranges2[s];
+                sampled.push_back(dispatch_async(r.id_,
+                    segment_sample<value_type>(), policy, is_seq(),
+                    r.first_, std::next(r.first_, r.size_), num_classes,
+                    num_segments1 + s));
+            }
+            wait_segments<ExPolicy>(sampled);
+
+            std::vector<exchange_sample<value_type> > samples =
+                collect_samples(sampled);
+            sort_samples(samples, comp, proj1);
+
+            std::vector<exchange_sample<value_type> > splitters =
+                get_splitters(samples, num_classes);
+
+            // determine the classes in all segments
+            std::vector<hpx::future<std::vector<std::size_t> > > bounded1;
+            bounded1.reserve(ranges1.size());
+            for (std::size_t s = 0; s != ranges1.size(); ++s)
+            {
+                auto const& r = ranges1[s];
+                bounded1.push_back(dispatch_async(r.id_,
+                    segment_class_bounds(), policy, is_seq(), r.first_,
+                    std::next(r.first_, r.size_), splitters, s, comp, proj1,
+                    proj1));
+            }
+
+            std::vector<hpx::future<std::vector<std::size_t> > > bounded2;
+            bounded2.reserve(ranges2.size());
+            for (std::size_t s = 0; s != ranges2.size(); ++s)
+            {
+                auto const& r = ranges2[s];
+                bounded2.push_back(dispatch_async(r.id_,
+                    segment_class_bounds(), policy, is_seq(), r.first_,
+                    std::next(r.first_, r.size_), splitters,
+                    num_segments1 + s, comp, proj1, proj2));
+            }
+            wait_segments<ExPolicy>(bounded1);
+            wait_segments<ExPolicy>(bounded2);
+
+            std::vector<std::vector<std::size_t> > bounds1;
+            bounds1.reserve(ranges1.size());
+            for (auto& f : bounded1)
+                bounds1.push_back(f.get());
+
+            std::vector<std::vector<std::size_t> > bounds2;
+            bounds2.reserve(ranges2.size());
+            for (auto& f : bounded2)
+                bounds2.push_back(f.get());
+
+            // move all elements into place
+            std::vector<segment_destination<local_iterator_type3,
+                local_iterator_type1, local_iterator_type2> > destinations(
+                    dest_ranges.begin(), dest_ranges.end());
+
+            add_class_slices(destinations, ranges1, bounds1, ranges2,
+                bounds2, splitters.size() + 1);
+
+            run_exchange<value_type>(policy, destinations, exchange_all(),
+                exchange_merge<Comp, Proj1, Proj2>{comp, proj1, proj2},
+                false);
+
+            return hpx::util::make_tuple(last1, last2, dest_last);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<SegIter1, SegIter2, SegIter3>
+        >::type
+        merge_(ExPolicy && policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, SegIter3 dest,
+            Comp && comp, Proj1 && proj1, Proj2 && proj2, std::true_type)
+        {
+            typedef exchange_policy<ExPolicy> policy_type;
+            typedef typename hpx::util::decay<Comp>::type comp_type;
+            typedef typename hpx::util::decay<Proj1>::type proj1_type;
+            typedef typename hpx::util::decay<Proj2>::type proj2_type;
+            typedef hpx::util::tuple<SegIter1, SegIter2, SegIter3>
+                result_type;
+
+            typename policy_type::type p = policy_type::get();
+            comp_type c(std::forward<Comp>(comp));
+            proj1_type pj1(std::forward<Proj1>(proj1));
+            proj2_type pj2(std::forward<Proj2>(proj2));
+
+            return exchange_result<ExPolicy, result_type>(
+                [p, first1, last1, first2, last2, dest, c, pj1, pj2]()
+                ->  result_type
+                {
+                    return segmented_merge(p, first1, last1, first2, last2,
+                        dest, c, pj1, pj2);
+                });
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<
+            ExPolicy, hpx::util::tuple<RandIter1, RandIter2, RandIter3>
+        >::type
+        merge_(ExPolicy && policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest,
+            Comp && comp, Proj1 && proj1, Proj2 && proj2, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_PARTITION_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_PARTITION_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_partition
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // partition a segment locally and return the number of elements
+        // satisfying the predicate
+        struct segment_partition
+          : public detail::algorithm<segment_partition, std::size_t>
+        {
+            segment_partition()
+              : segment_partition::algorithm("segment_partition")
+            {}
+
+            template <typename ExPolicy, typename FwdIter, typename Pred,
+                typename Proj>
+            static std::size_t
+            sequential(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred, Proj && proj)
+            {
+                typedef execution::is_sequenced_execution_policy<ExPolicy>
+                    is_seq;
+
+                return std::distance(first, detail::partition<FwdIter>().call(
+                    std::move(policy), is_seq(), first, last,
+                    std::forward<Pred>(pred), std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Pred,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, std::size_t
+            >::type
+            parallel(ExPolicy && policy, FwdIter first, FwdIter last,
+                Pred && pred, Proj && proj)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, std::size_t
+                    >::get(sequential(policy, first, last,
+                        std::forward<Pred>(pred), std::forward<Proj>(proj)));
+            }
+        };
+
+        // All segments are partitioned locally, the elements satisfying the
+        // predicate are then moved to the beginning of the range (in the
+        // order of the segments), followed by the remaining elements.
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        SegIter segmented_partition(ExPolicy const& policy, SegIter first,
+            SegIter last, Pred const& pred, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type> > ranges =
+                get_segment_ranges(first, last);
+
+            std::vector<hpx::future<std::size_t> > partitioned;
+            partitioned.reserve(ranges.size());
+            for (auto const& r : ranges)
+            {
+                partitioned.push_back(dispatch_async(r.id_,
+                    segment_partition(), policy, is_seq(), r.first_,
+                    std::next(r.first_, r.size_), pred, proj));
+            }
+            wait_segments<ExPolicy>(partitioned);
+
+            std::vector<std::size_t> boundaries;
+            std::vector<std::size_t> sizes;
+            boundaries.reserve(ranges.size());
+            sizes.reserve(ranges.size());
+            for (std::size_t s = 0; s != ranges.size(); ++s)
+            {
+                boundaries.push_back(partitioned[s].get());
+                sizes.push_back(ranges[s].size_);
+            }
+
+            std::vector<segment_destination<local_iterator_type> >
+                destinations(ranges.begin(), ranges.end());
+
+            std::size_t count = add_compacted_slices(destinations, ranges,
+                std::vector<std::size_t>(ranges.size(), 0), boundaries);
+            add_compacted_slices(destinations, ranges, boundaries, sizes,
+                count);
+            remove_unchanged_destinations(destinations);
+
+            run_exchange<value_type>(policy, destinations, exchange_all(),
+                exchange_concat(), true);
+
+            return std::next(first, count);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        partition_(ExPolicy && policy, SegIter first, SegIter last,
+            Pred && pred, Proj && proj, std::true_type)
+        {
+            typedef exchange_policy<ExPolicy> policy_type;
+            typedef typename hpx::util::decay<Pred>::type pred_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            typename policy_type::type p = policy_type::get();
+            pred_type pr(std::forward<Pred>(pred));
+            proj_type pj(std::forward<Proj>(proj));
+
+            return exchange_result<ExPolicy, SegIter>(
+                [p, first, last, pr, pj]() -> SegIter
+                {
+                    return segmented_partition(p, first, last, pr, pj);
+                });
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        partition_(ExPolicy && policy, FwdIter first, FwdIter last,
+            Pred && pred, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -0,0 +1,203 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // sort a segment locally and return regularly spaced samples
+        template <typename T>
+        struct segment_sort_sample
+          : public detail::algorithm<segment_sort_sample<T>,
+                std::vector<exchange_sample<T> > >
+        {
+            segment_sort_sample()
+              : segment_sort_sample::algorithm("segment_sort_sample")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Comp,
+                typename Proj>
+            static std::vector<exchange_sample<T> >
+            sequential(ExPolicy policy, RandomIt first, RandomIt last,
+                std::size_t num_samples, std::size_t segment, Comp && comp,
+                Proj && proj)
+            {
+                typedef execution::is_sequenced_execution_policy<ExPolicy>
+                    is_seq;
+
+                detail::sort<RandomIt>().call(std::move(policy), is_seq(),
+                    first, last, std::forward<Comp>(comp),
+                    std::forward<Proj>(proj));
+
+                return get_regular_samples<T>(
+                    first, last, num_samples, segment);
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Comp,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, std::vector<exchange_sample<T> >
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                std::size_t num_samples, std::size_t segment, Comp && comp,
+                Proj && proj)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, std::vector<exchange_sample<T> >
+                    >::get(sequential(policy, first, last, num_samples,
+                        segment, std::forward<Comp>(comp),
+                        std::forward<Proj>(proj)));
+            }
+        };
+
+        // The segments are sorted locally, the samples drawn from all of them
+        // define the classes the elements are divided into. Every segment
+        // then fetches the classes overlapping with its position in the
+        // result and sorts them.
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        SegIter segmented_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Comp const& comp, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type> > ranges =
+                get_segment_ranges(first, last);
+
+            if (ranges.size() <= 1)
+            {
+                for (auto const& r : ranges)
+                {
+                    dispatch(r.id_, segment_sort_sample<value_type>(), policy,
+                        is_seq(), r.first_, std::next(r.first_, r.size_),
+                        std::size_t(0), std::size_t(0), comp, proj);
+                }
+                return last;
+            }
+
+            // sort all segments locally and collect samples
+            std::size_t num_classes =
+                exchange_classes_per_segment * ranges.size();
+
+            std::vector<hpx::future<std::vector<
+                exchange_sample<value_type> > > > sampled;
+            sampled.reserve(ranges.size());
+            for (std::size_t s = 0; s != ranges.size(); ++s)
+            {
+                auto const& r = ranges[s];
+                sampled.push_back(dispatch_async(r.id_,
+                    segment_sort_sample<value_type>(), policy, is_seq(),
+                    r.first_, std::next(r.first_, r.size_), num_classes, s,
+                    comp, proj));
+            }
+            wait_segments<ExPolicy>(sampled);
+
+            std::vector<exchange_sample<value_type> > samples =
+                collect_samples(sampled);
+            sort_samples(samples, comp, proj);
+
+            std::vector<exchange_sample<value_type> > splitters =
+                get_splitters(samples, num_classes);
+
+            // determine the classes in all segments
+            std::vector<hpx::future<std::vector<std::size_t> > > bounded;
+            bounded.reserve(ranges.size());
+            for (std::size_t s = 0; s != ranges.size(); ++s)
+            {
+                auto const& r = ranges[s];
+                bounded.push_back(dispatch_async(r.id_,
+                    segment_class_bounds(), policy, is_seq(), r.first_,
+                    std::next(r.first_, r.size_), splitters, s, comp, proj,
+                    proj));
+            }
+            wait_segments<ExPolicy>(bounded);
+
+            std::vector<std::vector<std::size_t> > bounds;
+            bounds.reserve(ranges.size());
+            for (auto& f : bounded)
+                bounds.push_back(f.get());
+
+            // move all elements into place
+            std::vector<segment_destination<local_iterator_type,
+                local_iterator_type> > destinations(ranges.begin(),
+                    ranges.end());
+
+            add_class_slices(destinations, ranges, bounds,
+                std::vector<segment_range<local_iterator_type> >(),
+                std::vector<std::vector<std::size_t> >(),
+                splitters.size() + 1);
+
+            run_exchange<value_type>(policy, destinations, exchange_all(),
+                exchange_sort<Comp, Proj>{comp, proj}, true);
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Comp,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        sort_(ExPolicy && policy, SegIter first, SegIter last,
+            Comp && comp, Proj && proj, std::true_type)
+        {
+            typedef exchange_policy<ExPolicy> policy_type;
+            typedef typename hpx::util::decay<Comp>::type comp_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            typename policy_type::type p = policy_type::get();
+            comp_type c(std::forward<Comp>(comp));
+            proj_type pr(std::forward<Proj>(proj));
+
+            return exchange_result<ExPolicy, SegIter>(
+                [p, first, last, c, pr]() -> SegIter
+                {
+                    return segmented_sort(p, first, last, c, pr);
+                });
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Comp,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy && policy, RandomIt first, RandomIt last,
+            Comp && comp, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
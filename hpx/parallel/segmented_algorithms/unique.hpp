@@ -0,0 +1,192 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_UNIQUE_OCT_18_2026_0607AM)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_UNIQUE_OCT_18_2026_0607AM
+
+#include <hpx/config.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_unique
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // the number of elements kept in a segment and the first and last of
+        // those
+        template <typename T>
+        struct segment_unique_result
+        {
+            std::size_t count_;
+            T first_;
+            T last_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & count_ & first_ & last_;
+            }
+        };
+
+        // remove the consecutive duplicates of a (non-empty) segment locally
+        template <typename T>
+        struct segment_unique
+          : public detail::algorithm<
+                segment_unique<T>, segment_unique_result<T> >
+        {
+            segment_unique()
+              : segment_unique::algorithm("segment_unique")
+            {}
+
+            template <typename ExPolicy, typename FwdIter, typename Pred,
+                typename Proj>
+            static segment_unique_result<T>
+            sequential(ExPolicy policy, FwdIter first, FwdIter last,
+                Pred && pred, Proj && proj)
+            {
+                typedef execution::is_sequenced_execution_policy<ExPolicy>
+                    is_seq;
+
+                std::size_t count = std::distance(first,
+                    detail::unique<FwdIter>().call(std::move(policy),
+                        is_seq(), first, last, std::forward<Pred>(pred),
+                        std::forward<Proj>(proj)));
+
+                HPX_ASSERT(count != 0);
+                return segment_unique_result<T>{
+                    count, *first, *std::next(first, count - 1)};
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Pred,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, segment_unique_result<T>
+            >::type
+            parallel(ExPolicy && policy, FwdIter first, FwdIter last,
+                Pred && pred, Proj && proj)
+            {
+                return util::detail::algorithm_result<
+                        ExPolicy, segment_unique_result<T>
+                    >::get(sequential(policy, first, last,
+                        std::forward<Pred>(pred), std::forward<Proj>(proj)));
+            }
+        };
+
+        // The consecutive duplicates are removed from all segments locally.
+        // The first element kept in a segment is dropped as well if it is
+        // equivalent to the last element kept in the preceding segment. The
+        // remaining elements are then moved to their final position.
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        SegIter segmented_unique(ExPolicy const& policy, SegIter first,
+            SegIter last, Pred const& pred, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type> > ranges =
+                get_segment_ranges(first, last);
+
+            std::vector<hpx::future<segment_unique_result<value_type> > >
+                segments;
+            segments.reserve(ranges.size());
+            for (auto const& r : ranges)
+            {
+                segments.push_back(dispatch_async(r.id_,
+                    segment_unique<value_type>(), policy, is_seq(),
+                    r.first_, std::next(r.first_, r.size_), pred, proj));
+            }
+            wait_segments<ExPolicy>(segments);
+
+            std::vector<segment_unique_result<value_type> > results;
+            results.reserve(ranges.size());
+            for (auto& f : segments)
+                results.push_back(f.get());
+
+            std::vector<std::size_t> drop(ranges.size(), 0);
+            std::vector<std::size_t> kept(ranges.size(), 0);
+            for (std::size_t s = 0; s != ranges.size(); ++s)
+            {
+                kept[s] = results[s].count_;
+                if (s != 0 &&
+                    hpx::util::invoke(pred,
+                        hpx::util::invoke(proj, results[s - 1].last_),
+                        hpx::util::invoke(proj, results[s].first_)))
+                {
+                    drop[s] = 1;
+                }
+            }
+
+            std::vector<segment_destination<local_iterator_type> >
+                destinations(ranges.begin(), ranges.end());
+
+            std::size_t count =
+                add_compacted_slices(destinations, ranges, drop, kept);
+            remove_unchanged_destinations(destinations);
+
+            run_exchange<value_type>(policy, destinations, exchange_all(),
+                exchange_concat(), true);
+
+            return std::next(first, count);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        unique_(ExPolicy && policy, SegIter first, SegIter last,
+            Pred && pred, Proj && proj, std::true_type)
+        {
+            typedef exchange_policy<ExPolicy> policy_type;
+            typedef typename hpx::util::decay<Pred>::type pred_type;
+            typedef typename hpx::util::decay<Proj>::type proj_type;
+
+            typename policy_type::type p = policy_type::get();
+            pred_type pr(std::forward<Pred>(pred));
+            proj_type pj(std::forward<Proj>(proj));
+
+            return exchange_result<ExPolicy, SegIter>(
+                [p, first, last, pr, pj]() -> SegIter
+                {
+                    return segmented_unique(p, first, last, pr, pj);
+                });
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        unique_(ExPolicy && policy, FwdIter first, FwdIter last,
+            Pred && pred, Proj && proj, std::false_type);
+
+        /// \endcond
+    }
+}}}
+
+#endif
@@ -26,6 +26,10 @@ namespace hpx { namespace performance_counters { namespace parcels
           , num_parcels_(0)
           , raw_bytes_(0)
           , buffer_allocate_time_(0)
+          , serialization_threads_(0)
+          , compression_time_(0)
+          , uncompressed_bytes_(0)
+          , compressed_bytes_(0)
         {}
 
         std::size_t bytes_;           ///< number of bytes on tyhe wire for this parcel
@@ -40,6 +44,14 @@ namespace hpx { namespace performance_counters { namespace parcels
                                    ///< this parcel (uncompressed)
 
         std::int64_t buffer_allocate_time_; ///< The time spent for allocating buffers
+        std::size_t serialization_threads_; ///< The number of threads which
+                                   ///< took part in serializing this message
+        std::int64_t compression_time_;     ///< The time spent for compressing
+                                   ///< this message (if it was filtered)
+        std::size_t uncompressed_bytes_;    ///< number of bytes handed to the
+                                   ///< filter of this message
+        std::size_t compressed_bytes_;      ///< number of bytes produced by the
+                                   ///< filter of this message
     };
 }}}
 
@@ -36,6 +36,10 @@ namespace hpx { namespace performance_counters { namespace parcels
                 num_messages_(0),
                 overall_raw_bytes_(0),
                 buffer_allocate_time_(0),
+                serialization_threads_(0),
+                compression_time_(0),
+                uncompressed_bytes_(0),
+                compressed_bytes_(0),
                 acc_mtx()
             {}
 
@@ -48,6 +52,9 @@ namespace hpx { namespace performance_counters { namespace parcels
             std::int64_t total_time(bool reset);
             std::int64_t total_serialization_time(bool reset);
             std::int64_t total_buffer_allocate_time(bool reset);
+            std::int64_t total_serialization_threads(bool reset);
+            std::int64_t total_compression_time(bool reset);
+            std::int64_t compression_ratio(bool reset);
 
         private:
             std::int64_t overall_bytes_;
@@ -58,6 +65,11 @@ namespace hpx { namespace performance_counters { namespace parcels
             std::int64_t overall_raw_bytes_;
 
             std::int64_t buffer_allocate_time_;
+            std::int64_t serialization_threads_;
+
+            std::int64_t compression_time_;
+            std::int64_t uncompressed_bytes_;
+            std::int64_t compressed_bytes_;
 
             // Create mutex for accumulator functions.
             mutable mutex_type acc_mtx;
@@ -75,6 +87,10 @@ namespace hpx { namespace performance_counters { namespace parcels
             overall_raw_bytes_ += x.raw_bytes_;
             ++num_messages_;
             buffer_allocate_time_ += x.buffer_allocate_time_;
+            serialization_threads_ += x.serialization_threads_;
+            compression_time_ += x.compression_time_;
+            uncompressed_bytes_ += x.uncompressed_bytes_;
+            compressed_bytes_ += x.compressed_bytes_;
         }
 
         template <typename Mutex>
@@ -127,6 +143,39 @@ namespace hpx { namespace performance_counters { namespace parcels
             std::lock_guard<mutex_type> l(acc_mtx);
             return util::get_and_reset_value(buffer_allocate_time_, reset);
         }
+
+        template <typename Mutex>
+        inline std::int64_t
+        gatherer<Mutex>::total_serialization_threads(bool reset)
+        {
+            std::lock_guard<mutex_type> l(acc_mtx);
+            return util::get_and_reset_value(serialization_threads_, reset);
+        }
+
+        template <typename Mutex>
+        inline std::int64_t
+        gatherer<Mutex>::total_compression_time(bool reset)
+        {
+            std::lock_guard<mutex_type> l(acc_mtx);
+            return util::get_and_reset_value(compression_time_, reset);
+        }
+
+        // ratio of the uncompressed to the compressed amount of data of all
+        // filtered messages (in units of 0.01)
+        template <typename Mutex>
+        inline std::int64_t gatherer<Mutex>::compression_ratio(bool reset)
+        {
+            std::lock_guard<mutex_type> l(acc_mtx);
+
+            std::int64_t uncompressed =
+                util::get_and_reset_value(uncompressed_bytes_, reset);
+            std::int64_t compressed =
+                util::get_and_reset_value(compressed_bytes_, reset);
+
+            if (compressed == 0)
+                return 0;
+            return (uncompressed * 100) / compressed;
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
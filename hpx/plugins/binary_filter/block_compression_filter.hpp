@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_ACTION_BLOCK_COMPRESSION_FILTER_HPP)
+#define HPX_ACTION_BLOCK_COMPRESSION_FILTER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Decides whether the data of a message is worth being compressed. Data
+    // smaller than the threshold is not compressed at all, compressed data
+    // is used only if it is smaller than the original by at least the given
+    // ratio.
+    struct compression_policy
+    {
+        compression_policy()
+          : threshold_(0), min_ratio_(1.0)
+        {}
+
+        compression_policy(std::size_t threshold, double min_ratio)
+          : threshold_(threshold), min_ratio_(min_ratio)
+        {}
+
+        // Read the settings from the given configuration section, i.e.
+        // [hpx.plugins.<name>].
+        static compression_policy from_config(std::string const& section)
+        {
+            return compression_policy(
+                util::safe_lexical_cast<std::size_t>(
+                    get_config_entry(section + ".threshold", "0"), 0),
+                util::safe_lexical_cast<double>(
+                    get_config_entry(section + ".min_ratio", "1.0"), 1.0));
+        }
+
+        bool should_compress(std::size_t size) const
+        {
+            return size != 0 && size >= threshold_;
+        }
+
+        bool accept(std::size_t size, std::size_t compressed_size) const
+        {
+            return compressed_size != 0 &&
+                double(size) >= min_ratio_ * double(compressed_size);
+        }
+
+        std::size_t threshold_;
+        double min_ratio_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Base class for filters which collect all data of a message and
+    // compress it in one go. The first byte of the filtered data tells
+    // whether the remaining data was compressed or is stored as is.
+    class block_compression_filter : public serialization::binary_filter
+    {
+        enum block_type : char
+        {
+            block_stored = 0,
+            block_compressed = 1
+        };
+
+    public:
+        explicit block_compression_filter(bool compress,
+                compression_policy const& policy = compression_policy())
+          : policy_(policy), data_(nullptr), size_(0), current_(0),
+            compress_(compress)
+        {}
+
+        void set_max_length(std::size_t size) override
+        {
+            buffer_.reserve(size);
+        }
+
+        void save(void const* src, std::size_t src_count) override
+        {
+            char const* src_begin = static_cast<char const*>(src);
+            buffer_.insert(buffer_.end(), src_begin, src_begin + src_count);
+        }
+
+        bool flush(void* dst, std::size_t dst_count,
+            std::size_t& written) override
+        {
+            std::size_t const size = buffer_.size();
+            bool const try_compress = compress_ && policy_.should_compress(size);
+
+            // make sure we have enough memory for either outcome
+            std::size_t needed = 1 + (try_compress ?
+                (std::max)(max_compressed_length(size), size) : size);
+            if (needed > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            char* dst_begin = static_cast<char*>(dst);
+            if (try_compress)
+            {
+                std::size_t compressed_size = compress(
+                    buffer_.data(), size, dst_begin + 1, dst_count - 1);
+                if (policy_.accept(size, compressed_size))
+                {
+                    dst_begin[0] = block_compressed;
+                    written = compressed_size + 1;
+                    return true;
+                }
+            }
+
+            dst_begin[0] = block_stored;
+            if (size != 0)
+                std::memcpy(dst_begin + 1, buffer_.data(), size);
+            written = size + 1;
+            return true;
+        }
+
+        std::size_t init_data(char const* buffer, std::size_t size,
+            std::size_t buffer_size) override
+        {
+            if (size == 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "block_compression_filter::init_data",
+                    "archive data bstream is too short");
+                return 0;
+            }
+
+            current_ = 0;
+            if (buffer[0] == block_stored)
+            {
+                // refer to the received data directly
+                data_ = buffer + 1;
+                size_ = size - 1;
+            }
+            else
+            {
+                buffer_.resize(buffer_size);
+                size_ = decompress(
+                    buffer + 1, size - 1, buffer_.data(), buffer_.size());
+                data_ = buffer_.data();
+            }
+            return buffer_size;
+        }
+
+        void load(void* dst, std::size_t dst_count) override
+        {
+            if (current_ + dst_count > size_)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "block_compression_filter::load",
+                    "archive data bstream is too short");
+                return;
+            }
+
+            std::memcpy(dst, data_ + current_, dst_count);
+            current_ += dst_count;
+        }
+
+    protected:
+        // Return the maximal size of the compressed representation of the
+        // given amount of data.
+        virtual std::size_t max_compressed_length(std::size_t size) const = 0;
+
+        // Compress the data, returns the compressed size (zero on failure).
+        virtual std::size_t compress(char const* src, std::size_t src_count,
+            char* dst, std::size_t dst_count) = 0;
+
+        // Decompress the data, returns the decompressed size. Throws on
+        // failure.
+        virtual std::size_t decompress(char const* src, std::size_t src_count,
+            char* dst, std::size_t dst_count) = 0;
+
+    private:
+        compression_policy policy_;
+
+        std::vector<char> buffer_;
+        char const* data_;
+        std::size_t size_;
+        std::size_t current_;
+        bool compress_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
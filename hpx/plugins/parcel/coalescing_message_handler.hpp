@@ -60,6 +60,8 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_parcels_per_message_limit(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t>
             get_time_between_parcels_histogram(bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -78,6 +80,10 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+        void update_latency_budget();
+
+        void adapt_parameters(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +96,17 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // In adaptive mode num_coalesced_parcels_ and interval_ are derived
+        // from the observed times between parcels such that the oldest
+        // parcel in a message does not wait for longer than the latency
+        // budget, the configured number of parcels becomes an upper limit.
+        bool adaptive_;
+        std::size_t latency_budget_;
+        std::size_t max_coalesced_parcels_;
+        std::int64_t average_gap_;
+        std::int64_t average_gap_deviation_;
+        std::size_t parcels_since_adapt_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
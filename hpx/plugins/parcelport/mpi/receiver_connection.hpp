@@ -13,6 +13,7 @@
 #include <hpx/plugins/parcelport/mpi/header.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
@@ -40,7 +41,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
 
         typedef std::vector<char>
             data_type;
-        typedef parcel_buffer<data_type, data_type> buffer_type;
+        typedef parcel_buffer<data_type, receive_buffer> buffer_type;
 
     public:
         receiver_connection(
@@ -163,7 +164,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace mpi
                 std::size_t idx = chunks_idx_++;
                 std::size_t chunk_size = buffer_.transmission_chunks_[idx].second;
 
-                data_type & c = buffer_.chunks_[idx];
+                receive_buffer & c = buffer_.chunks_[idx];
                 c.resize(chunk_size);
                 {
                     util::mpi_environment::scoped_lock l;
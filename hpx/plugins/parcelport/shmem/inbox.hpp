@@ -0,0 +1,382 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_INBOX_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_INBOX_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/format.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+
+// The rings live in memory shared between processes, the atomics used to
+// synchronize them must not rely on process local locks.
+#if ATOMIC_INT_LOCK_FREE != 2 || ATOMIC_LLONG_LOCK_FREE != 2
+#error "The shared memory parcelport requires lock-free 32 and 64 bit atomics"
+#endif
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // All records are aligned to (and their sizes are multiples of) the size
+    // of a cache line.
+    HPX_CONSTEXPR_OR_CONST std::size_t record_alignment = 64;
+
+    inline std::size_t align_record(std::size_t size)
+    {
+        return (size + record_alignment - 1) & ~(record_alignment - 1);
+    }
+
+    // Payload data inside of a record is aligned to 16 bytes.
+    inline std::size_t align_payload(std::size_t size)
+    {
+        return (size + 15) & ~std::size_t(15);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Name of the inbound segment of the given process.
+    inline std::string inbox_name(std::int32_t pid)
+    {
+        return hpx::util::format("/hpx.shmem.{}", pid);
+    }
+
+    // Name of a segment holding a single message which is too large to be
+    // passed through a ring.
+    inline std::string overflow_name(std::int32_t pid, std::uint64_t id)
+    {
+        return hpx::util::format("/hpx.shmem.{}.{}", pid, id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every message starts with this header, the header is followed by
+    // the transmission chunks, the serialized data, and all zero-copy chunks.
+    struct message_header
+    {
+        enum message_type : std::uint32_t
+        {
+            message_data = 1,       // the message is stored in the ring
+            message_padding = 2,    // skip to the beginning of the ring
+            message_overflow = 3    // the message is stored in its own segment
+        };
+
+        std::uint64_t size_;                // overall size of the record
+        std::uint32_t type_;
+        std::uint32_t num_transmission_chunks_;
+        std::uint32_t num_chunks_first_;    // zero-copy chunks
+        std::uint32_t num_chunks_second_;   // non-zero-copy chunks
+        std::uint64_t data_size_;           // size of the serialized data
+        std::uint64_t numbytes_;            // size of the decompressed data
+        std::uint64_t overflow_id_;         // id of the overflow segment
+        std::uint64_t reserved_[2];
+    };
+
+    static_assert(sizeof(message_header) == record_alignment,
+        "message_header must occupy exactly one record unit");
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Control block of a single producer/single consumer ring.
+    struct ring_header
+    {
+        // process id of the producer, zero if the ring is unclaimed
+        alignas(record_alignment) std::atomic<std::int32_t> owner_;
+
+        // producer and consumer positions, both are only ever incremented
+        alignas(record_alignment) std::atomic<std::uint64_t> head_;
+        alignas(record_alignment) std::atomic<std::uint64_t> tail_;
+    };
+
+    // Control block of the inbound segment of a locality.
+    struct inbox_header
+    {
+        static HPX_CONSTEXPR_OR_CONST std::uint64_t magic = 0x6870782d73686d31ULL;
+
+        std::uint64_t magic_;
+        std::uint64_t num_rings_;
+        std::uint64_t ring_size_;
+
+        // incremented by producers to wake up a sleeping consumer
+        alignas(record_alignment) std::atomic<std::uint32_t> doorbell_;
+        std::atomic<std::uint32_t> sleeping_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // View of one ring of an inbox. Producers reserve contiguous space for a
+    // record, fill it, and publish it by committing. The consumer peeks at
+    // the oldest record and releases it once it has been processed.
+    class ring
+    {
+    public:
+        ring()
+          : header_(nullptr), data_(nullptr), capacity_(0)
+        {}
+
+        ring(ring_header* header, char* data, std::size_t capacity)
+          : header_(header), data_(data), capacity_(capacity)
+        {}
+
+        std::size_t capacity() const
+        {
+            return capacity_;
+        }
+
+        ring_header& header() const
+        {
+            return *header_;
+        }
+
+        // Producer: return the address of size contiguous bytes or nullptr
+        // if the ring is too full.
+        char* reserve(std::size_t size)
+        {
+            HPX_ASSERT(size % record_alignment == 0 && size <= capacity_);
+
+            std::uint64_t head = header_->head_.load(std::memory_order_relaxed);
+            std::uint64_t tail = header_->tail_.load(std::memory_order_acquire);
+
+            std::size_t offset = std::size_t(head % capacity_);
+            std::size_t padding =
+                (offset + size > capacity_) ? capacity_ - offset : 0;
+
+            if (head + padding + size - tail > capacity_)
+                return nullptr;
+
+            if (padding != 0)
+            {
+                // let the consumer skip the remainder of the ring
+                message_header* h = ::new (data_ + offset) message_header();
+                h->size_ = padding;
+                h->type_ = message_header::message_padding;
+
+                header_->head_.store(head + padding, std::memory_order_release);
+                offset = 0;
+            }
+
+            return data_ + offset;
+        }
+
+        // Producer: publish the record previously reserved.
+        void commit(std::size_t size)
+        {
+            std::uint64_t head = header_->head_.load(std::memory_order_relaxed);
+            header_->head_.store(head + size, std::memory_order_release);
+        }
+
+        // Consumer: return the oldest record, if any.
+        message_header const* peek()
+        {
+            for (;;)
+            {
+                std::uint64_t tail =
+                    header_->tail_.load(std::memory_order_relaxed);
+                if (tail == header_->head_.load(std::memory_order_acquire))
+                    return nullptr;
+
+                message_header const* h = reinterpret_cast<
+                    message_header const*>(data_ + tail % capacity_);
+                if (h->type_ != message_header::message_padding)
+                    return h;
+
+                release(h->size_);
+            }
+        }
+
+        // Consumer: make the space of the oldest record available again.
+        void release(std::size_t size)
+        {
+            std::uint64_t tail = header_->tail_.load(std::memory_order_relaxed);
+            header_->tail_.store(tail + size, std::memory_order_release);
+        }
+
+        bool empty() const
+        {
+            return header_->tail_.load(std::memory_order_relaxed) ==
+                header_->head_.load(std::memory_order_acquire);
+        }
+
+    private:
+        ring_header* header_;
+        char* data_;
+        std::size_t capacity_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The inbound segment of a locality holds one ring per sending process.
+    class inbox
+    {
+        static std::size_t rings_offset()
+        {
+            return align_record(sizeof(inbox_header));
+        }
+
+        static std::size_t ring_stride(std::size_t ring_size)
+        {
+            return align_record(sizeof(ring_header)) + ring_size;
+        }
+
+    public:
+        inbox() = default;
+
+        // Create the inbound segment of this process.
+        static inbox create(std::string const& name, std::size_t num_rings,
+            std::size_t ring_size)
+        {
+            ring_size = align_record(ring_size);
+
+            inbox ib;
+            ib.segment_ = segment::create(name,
+                rings_offset() + num_rings * ring_stride(ring_size));
+
+            inbox_header* h = ::new (ib.segment_.data()) inbox_header();
+            h->num_rings_ = num_rings;
+            h->ring_size_ = ring_size;
+            h->doorbell_.store(0, std::memory_order_relaxed);
+            h->sleeping_.store(0, std::memory_order_relaxed);
+
+            for (std::size_t i = 0; i != num_rings; ++i)
+            {
+                ring_header* r = ::new (ib.segment_.data() + rings_offset() +
+                    i * ring_stride(ring_size)) ring_header();
+                r->owner_.store(0, std::memory_order_relaxed);
+                r->head_.store(0, std::memory_order_relaxed);
+                r->tail_.store(0, std::memory_order_relaxed);
+            }
+
+            // make the segment known as being valid only after it has been
+            // fully initialized
+            std::atomic_thread_fence(std::memory_order_release);
+            h->magic_ = inbox_header::magic;
+
+            return ib;
+        }
+
+        // Map the inbound segment of another process.
+        static inbox open(std::string const& name)
+        {
+            inbox ib;
+            ib.segment_ = segment::open(name);
+
+            inbox_header const& h = ib.header();
+            if (ib.segment_.size() < rings_offset() ||
+                h.magic_ != inbox_header::magic ||
+                ib.segment_.size() <
+                    rings_offset() + h.num_rings_ * ring_stride(h.ring_size_))
+            {
+                HPX_THROW_EXCEPTION(network_error, "shmem::inbox::open",
+                    hpx::util::format(
+                        "shared memory segment {} is not a valid inbox",
+                        name));
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            return ib;
+        }
+
+        explicit operator bool() const
+        {
+            return bool(segment_);
+        }
+
+        std::string const& name() const
+        {
+            return segment_.name();
+        }
+
+        std::size_t num_rings() const
+        {
+            return std::size_t(header().num_rings_);
+        }
+
+        ring get_ring(std::size_t i) const
+        {
+            HPX_ASSERT(i < num_rings());
+
+            std::size_t ring_size = std::size_t(header().ring_size_);
+            char* base = segment_.data() + rings_offset() +
+                i * ring_stride(ring_size);
+
+            return ring(reinterpret_cast<ring_header*>(base),
+                base + align_record(sizeof(ring_header)), ring_size);
+        }
+
+        // Claim a ring for the given producer process, returns the index of
+        // the ring or -1 if all rings are in use.
+        std::ptrdiff_t claim_ring(std::int32_t pid)
+        {
+            for (std::size_t i = 0; i != num_rings(); ++i)
+            {
+                std::atomic<std::int32_t>& owner = get_ring(i).header().owner_;
+
+                std::int32_t expected = 0;
+                if (owner.compare_exchange_strong(expected, pid) ||
+                    expected == pid)
+                {
+                    return std::ptrdiff_t(i);
+                }
+            }
+            return -1;
+        }
+
+        // Producer: wake up the consumer if it went to sleep.
+        void notify()
+        {
+            inbox_header& h = header();
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (h.sleeping_.load(std::memory_order_relaxed) != 0)
+            {
+                h.doorbell_.fetch_add(1, std::memory_order_release);
+                futex_wake(h.doorbell_);
+            }
+        }
+
+        // Consumer: wake up all waiting threads unconditionally.
+        void notify_all()
+        {
+            inbox_header& h = header();
+            h.doorbell_.fetch_add(1, std::memory_order_release);
+            futex_wake(h.doorbell_);
+        }
+
+        // Consumer: sleep until a producer notifies us, unless has_work
+        // reports that there is something to do already.
+        template <typename F>
+        void wait(F && has_work, std::chrono::microseconds timeout)
+        {
+            inbox_header& h = header();
+
+            std::uint32_t doorbell =
+                h.doorbell_.load(std::memory_order_acquire);
+            h.sleeping_.fetch_add(1, std::memory_order_seq_cst);
+
+            if (!has_work())
+                futex_wait(h.doorbell_, doorbell, timeout);
+
+            h.sleeping_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+    private:
+        inbox_header& header() const
+        {
+            return *reinterpret_cast<inbox_header*>(segment_.data());
+        }
+
+        segment segment_;
+    };
+}}}}
+
+#endif
+
+#endif
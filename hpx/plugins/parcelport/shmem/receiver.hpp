@@ -0,0 +1,230 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Non-owning view of a message (or a zero-copy chunk of it) residing in
+    // shared memory. Parcels are de-serialized directly from the ring.
+    class data_view
+    {
+    public:
+        typedef std::allocator<char> allocator_type;
+
+        explicit data_view(allocator_type const& = allocator_type())
+          : data_(nullptr), size_(0)
+        {}
+
+        data_view(char const* data, std::size_t size)
+          : data_(data), size_(size)
+        {}
+
+        char const& operator[](std::size_t i) const
+        {
+            return data_[i];
+        }
+
+        char const* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        void clear()
+        {
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+    private:
+        char const* data_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+        typedef parcel_buffer<data_view, data_view> buffer_type;
+
+        // maximal number of messages handled from one ring at a time
+        static HPX_CONSTEXPR_OR_CONST std::size_t max_messages = 16;
+
+        receiver(Parcelport & pp)
+          : pp_(pp)
+        {}
+
+        void run(std::size_t num_rings, std::size_t ring_size)
+        {
+            inbox_ = inbox::create(
+                inbox_name(get_process_id()), num_rings, ring_size);
+            ring_mtxs_.reset(new mutex_type[num_rings]);
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            if (!inbox_)
+                return false;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != inbox_.num_rings(); ++i)
+            {
+                ring r = inbox_.get_ring(i);
+                if (r.empty())
+                    continue;
+
+                // every ring is drained by one thread at a time only
+                std::unique_lock<mutex_type> l(ring_mtxs_[i], std::try_to_lock);
+                if (!l)
+                    continue;
+
+                std::int32_t owner =
+                    r.header().owner_.load(std::memory_order_relaxed);
+
+                for (std::size_t n = 0; n != max_messages; ++n)
+                {
+                    message_header const* h = r.peek();
+                    if (h == nullptr)
+                        break;
+
+                    std::size_t size = std::size_t(h->size_);
+                    if (h->type_ == message_header::message_overflow)
+                    {
+                        segment s = segment::open(
+                            overflow_name(owner, h->overflow_id_));
+                        s.unlink();
+
+                        // the ring space can be reused right away
+                        r.release(size);
+                        decode(reinterpret_cast<message_header const*>(
+                            s.data()), num_thread);
+                    }
+                    else
+                    {
+                        decode(h, num_thread);
+                        r.release(size);
+                    }
+                    has_work = true;
+                }
+            }
+            return has_work;
+        }
+
+        bool has_work() const
+        {
+            if (!inbox_)
+                return false;
+
+            for (std::size_t i = 0; i != inbox_.num_rings(); ++i)
+            {
+                if (!inbox_.get_ring(i).empty())
+                    return true;
+            }
+            return false;
+        }
+
+        // Block until a sender signals new messages or the timeout expires,
+        // a zero timeout waits indefinitely.
+        void wait(std::chrono::microseconds timeout)
+        {
+            inbox_.wait([this]() { return has_work(); }, timeout);
+        }
+
+        void notify_all()
+        {
+            if (inbox_)
+                inbox_.notify_all();
+        }
+
+    private:
+        void decode(message_header const* h, std::size_t num_thread)
+        {
+            HPX_ASSERT(h->type_ == message_header::message_data);
+
+            util::high_resolution_timer timer;
+
+            buffer_type buffer;
+
+            performance_counters::parcels::data_point& data =
+                buffer.data_point_;
+            data.time_ = timer.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(h->numbytes_);
+
+            char const* p = reinterpret_cast<char const*>(h) +
+                sizeof(message_header);
+
+            std::size_t size = h->num_transmission_chunks_ *
+                sizeof(buffer_type::transmission_chunk_type);
+            buffer.transmission_chunks_.resize(h->num_transmission_chunks_);
+            if (size != 0)
+            {
+                std::memcpy(static_cast<void*>(
+                    buffer.transmission_chunks_.data()), p, size);
+            }
+            p += align_payload(size);
+
+            buffer.data_ = data_view(p, std::size_t(h->data_size_));
+            buffer.size_ = h->data_size_;
+            buffer.data_size_ = h->numbytes_;
+            buffer.num_chunks_ = buffer_type::count_chunks_type(
+                h->num_chunks_first_, h->num_chunks_second_);
+            p += align_payload(std::size_t(h->data_size_));
+
+            // the zero-copy chunks follow the data, they are referred to
+            // in place as well
+            buffer.chunks_.reserve(h->num_chunks_first_);
+            for (std::size_t i = 0; i != h->num_chunks_first_; ++i)
+            {
+                std::size_t chunk_size = static_cast<std::size_t>(
+                    static_cast<std::uint64_t>(
+                        buffer.transmission_chunks_[i].second));
+                buffer.chunks_.emplace_back(p, chunk_size);
+                p += align_payload(chunk_size);
+            }
+
+            data.time_ = timer.elapsed_nanoseconds() - data.time_;
+
+            decode_parcels(pp_, std::move(buffer), num_thread);
+        }
+
+        Parcelport & pp_;
+
+        inbox inbox_;
+        std::unique_ptr<mutex_type[]> ring_mtxs_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SEGMENT_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/error_code.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A named POSIX shared memory segment mapped into the address space of
+    // this process. The creator of a segment removes its name from the system
+    // on destruction (unless it was unlinked explicitly before).
+    class HPX_EXPORT segment
+    {
+    public:
+        segment() noexcept;
+        ~segment();
+
+        segment(segment && rhs) noexcept;
+        segment& operator=(segment && rhs) noexcept;
+
+        segment(segment const&) = delete;
+        segment& operator=(segment const&) = delete;
+
+        // Create a new segment of the given size, an existing stale segment
+        // of the same name is replaced.
+        static segment create(std::string const& name, std::size_t size,
+            error_code& ec = throws);
+
+        // Map an existing segment in its entirety.
+        static segment open(std::string const& name, error_code& ec = throws);
+
+        // Remove the name of the segment from the system, the mapping stays
+        // valid until this object is destroyed. This may be called by any
+        // process which has mapped the segment.
+        void unlink();
+
+        // Hand the responsibility of removing the segment's name to some
+        // other process.
+        void release_ownership() noexcept
+        {
+            owner_ = false;
+        }
+
+        char* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void reset() noexcept;
+
+        std::string name_;
+        char* data_;
+        std::size_t size_;
+        bool owner_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Block while the given (process-shared) word has the expected value,
+    // returns after a wake-up, a spurious wake-up, or after the timeout
+    // expired. A zero timeout waits indefinitely.
+    HPX_EXPORT void futex_wait(std::atomic<std::uint32_t>& word,
+        std::uint32_t expected,
+        std::chrono::microseconds timeout = std::chrono::microseconds(0));
+
+    // Wake up all processes waiting on the given word.
+    HPX_EXPORT void futex_wake(std::atomic<std::uint32_t>& word);
+
+    // Identify the host this process is running on, processes on the same
+    // host (and boot) return the same value.
+    HPX_EXPORT std::uint64_t get_host_id();
+
+    // Return the id of the current process.
+    HPX_EXPORT std::int32_t get_process_id();
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        typedef
+            sender_connection
+            connection_type;
+        typedef std::shared_ptr<connection_type> connection_ptr;
+        typedef std::deque<connection_ptr> connection_list;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        connection_ptr create_connection(
+            locality const& dest, parcelset::parcelport* pp)
+        {
+            return std::make_shared<connection_type>(
+                this, dest, get_outbox(dest), pp);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        // Retry the connections which found the ring of their destination
+        // to be full.
+        void send_messages(
+            connection_ptr connection
+        )
+        {
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            if(connection)
+            {
+                send_messages(std::move(connection));
+                return true;
+            }
+            return false;
+        }
+
+        bool has_pending()
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            return !connections_.empty();
+        }
+
+    private:
+        std::shared_ptr<outbox> get_outbox(locality const& dest)
+        {
+            std::unique_lock<mutex_type> l(outboxes_mtx_);
+
+            auto it = outboxes_.find(dest);
+            if (it == outboxes_.end())
+            {
+                // mapping the segment of the destination may throw
+                std::shared_ptr<outbox> ob = std::make_shared<outbox>(dest);
+                it = outboxes_.emplace(dest, std::move(ob)).first;
+            }
+            return it->second;
+        }
+
+        mutex_type connections_mtx_;
+        connection_list connections_;
+
+        mutex_type outboxes_mtx_;
+        std::map<locality, std::shared_ptr<outbox> > outboxes_;
+    };
+}}}}
+
+#endif
+
+#endif
@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/inbox.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The ring this process writes to in the inbound segment of a destination,
+    // shared by all connections to that destination.
+    struct outbox
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        explicit outbox(locality const& dest)
+          : inbox_(inbox::open(inbox_name(dest.pid())))
+        {
+            std::ptrdiff_t idx = inbox_.claim_ring(get_process_id());
+            if (idx < 0)
+            {
+                HPX_THROW_EXCEPTION(network_error, "shmem::outbox::outbox",
+                    hpx::util::format(
+                        "all rings of the shared memory segment of locality "
+                        "{} are in use, increase hpx.parcel.shmem.max_peers",
+                        dest));
+            }
+            ring_ = inbox_.get_ring(std::size_t(idx));
+        }
+
+        mutex_type mtx_;
+        inbox inbox_;
+        ring ring_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+    public:
+        sender_connection(
+            sender_type * s
+          , locality const& dst
+          , std::shared_ptr<outbox> const& ob
+          , parcelset::parcelport* pp
+        )
+          : sender_(s)
+          , outbox_(ob)
+          , record_size_(0)
+          , overflow_id_(0)
+          , pp_(pp)
+          , there_(parcelset::locality(dst))
+        {
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            buffer_.data_point_.time_ = util::high_resolution_clock::now();
+
+            record_size_ = align_record(payload_size());
+            overflow_id_ = 0;
+
+            // Messages which would occupy more than half of the ring are
+            // passed in a segment of their own, only a reference to this
+            // segment is sent through the ring.
+            if (record_size_ > outbox_->ring_.capacity() / 2)
+            {
+                static std::atomic<std::uint64_t> next_overflow_id(0);
+                overflow_id_ = ++next_overflow_id;
+
+                segment s = segment::create(
+                    overflow_name(get_process_id(), overflow_id_),
+                    record_size_);
+                write_record(s.data());
+
+                // the receiver removes the segment once it has mapped it
+                s.release_ownership();
+
+                record_size_ = sizeof(message_header);
+            }
+
+            handler_ = std::forward<Handler>(handler);
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Copy the message into the ring, returns false if the ring is full.
+        bool send()
+        {
+            {
+                std::unique_lock<outbox::mutex_type> l(outbox_->mtx_);
+
+                char* p = outbox_->ring_.reserve(record_size_);
+                if (p == nullptr)
+                    return false;
+
+                if (overflow_id_ != 0)
+                {
+                    message_header* h = ::new (p) message_header();
+                    h->size_ = record_size_;
+                    h->type_ = message_header::message_overflow;
+                    h->overflow_id_ = overflow_id_;
+                }
+                else
+                {
+                    write_record(p);
+                }
+
+                outbox_->ring_.commit(record_size_);
+            }
+
+            outbox_->inbox_.notify();
+            return done();
+        }
+
+        bool done()
+        {
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                util::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+
+            return true;
+        }
+
+    private:
+        // Size of the message: header, transmission chunks, serialized data,
+        // and all zero-copy chunks.
+        std::size_t payload_size() const
+        {
+            std::size_t size = sizeof(message_header);
+            size += align_payload(buffer_.transmission_chunks_.size() *
+                sizeof(parcel_buffer_type::transmission_chunk_type));
+            size += align_payload(buffer_.data_.size());
+
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                    size += align_payload(c.size_);
+            }
+            return size;
+        }
+
+        // The zero-copy chunks are copied straight from the memory they
+        // refer to, the receiver decodes the message in place.
+        void write_record(char* p) const
+        {
+            message_header* h = ::new (p) message_header();
+            h->size_ = align_record(payload_size());
+            h->type_ = message_header::message_data;
+            h->num_transmission_chunks_ =
+                std::uint32_t(buffer_.transmission_chunks_.size());
+            h->num_chunks_first_ = buffer_.num_chunks_.first;
+            h->num_chunks_second_ = buffer_.num_chunks_.second;
+            h->data_size_ = buffer_.data_.size();
+            h->numbytes_ = buffer_.data_size_;
+            p += sizeof(message_header);
+
+            std::size_t size = buffer_.transmission_chunks_.size() *
+                sizeof(parcel_buffer_type::transmission_chunk_type);
+            if (size != 0)
+                std::memcpy(p, buffer_.transmission_chunks_.data(), size);
+            p += align_payload(size);
+
+            std::memcpy(p, buffer_.data_.data(), buffer_.data_.size());
+            p += align_payload(buffer_.data_.size());
+
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type_pointer)
+                {
+                    std::memcpy(p, c.data_.cpos_, c.size_);
+                    p += align_payload(c.size_);
+                }
+            }
+        }
+
+    public:
+        sender_type * sender_;
+        std::shared_ptr<outbox> outbox_;
+        std::size_t record_size_;
+        std::uint64_t overflow_id_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
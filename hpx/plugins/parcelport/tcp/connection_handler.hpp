@@ -15,6 +15,7 @@
 #if defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/config/asio.hpp>
 
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
@@ -46,7 +47,11 @@ namespace hpx { namespace parcelset
     {
         typedef policies::tcp::sender connection_type;
         typedef std::true_type  send_early_parcel;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        typedef std::true_type  do_background_work;
+#else
         typedef std::false_type do_background_work;
+#endif
         typedef std::false_type send_immediate_parcels;
 
         static const char * type()
@@ -110,12 +115,26 @@ namespace hpx { namespace parcelset
 
             parcelset::locality create_locality() const;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            /// Make progress on the operations submitted to the io_uring,
+            /// invoked by the scheduler while the runtime is up and running.
+            bool background_work(std::size_t num_thread);
+#endif
+
         private:
             void handle_accept(boost::system::error_code const & e,
                 std::shared_ptr<receiver> receiver_conn);
             void handle_read_completion(boost::system::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            void io_service_work(std::size_t k);
+
+            /// Submission and completion queues replacing the asio reactor
+            /// for all established connections, empty if not available.
+            std::unique_ptr<io_uring_queue> uring_;
+#endif
+
             /// Acceptor used to listen for incoming connections.
             boost::asio::ip::tcp::acceptor* acceptor_;
 
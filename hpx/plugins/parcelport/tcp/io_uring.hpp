@@ -0,0 +1,191 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_TCP_IO_URING_HPP
+#define HPX_PARCELSET_POLICIES_TCP_IO_URING_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP) && \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <boost/system/error_code.hpp>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    class io_uring_queue;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A vectored send or receive on a socket. The operation is resubmitted
+    // until all buffers have been transferred, the handler is invoked once
+    // afterwards (or as soon as an error occurred).
+    class HPX_EXPORT io_uring_operation
+    {
+    public:
+        typedef util::unique_function_nonser<
+            void(boost::system::error_code const&, std::size_t)
+        > handler_type;
+
+        io_uring_operation()
+          : queue_(nullptr), fd_(-1), write_(false), first_(0),
+            transferred_(0)
+        {}
+
+        io_uring_operation(io_uring_operation const&) = delete;
+        io_uring_operation& operator=(io_uring_operation const&) = delete;
+
+        template <typename Buffers>
+        void async_write(io_uring_queue& queue, int fd,
+            Buffers const& buffers, handler_type && handler)
+        {
+            start(queue, fd, true, buffers, std::move(handler));
+        }
+
+        template <typename Buffers>
+        void async_read(io_uring_queue& queue, int fd,
+            Buffers const& buffers, handler_type && handler)
+        {
+            start(queue, fd, false, buffers, std::move(handler));
+        }
+
+        // Called by the queue for every completion of this operation.
+        void complete(int result);
+
+    private:
+        template <typename Buffers>
+        void start(io_uring_queue& queue, int fd, bool write,
+            Buffers const& buffers, handler_type && handler)
+        {
+            HPX_ASSERT(!handler_);
+
+            iov_.clear();
+            for (auto const& b : buffers)
+            {
+                if (b.size() != 0)
+                {
+                    iov_.push_back(iovec{
+                        const_cast<void*>(static_cast<void const*>(b.data())),
+                        b.size()});
+                }
+            }
+
+            queue_ = &queue;
+            fd_ = fd;
+            write_ = write;
+            first_ = 0;
+            transferred_ = 0;
+            handler_ = std::move(handler);
+
+            submit();
+        }
+
+        void submit();
+
+        io_uring_queue* queue_;
+        int fd_;
+        bool write_;
+
+        std::vector<iovec> iov_;
+        std::size_t first_;             // first iovec not transferred yet
+        std::size_t transferred_;
+        msghdr msg_;
+
+        handler_type handler_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Submission and completion queues shared by all connections of the
+    // parcelport. Submissions are batched, they are passed to the kernel
+    // together with reaping the completions from the background work of the
+    // HPX scheduler.
+    class HPX_EXPORT io_uring_queue
+    {
+    public:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        // Return an empty pointer if the kernel does not support io_uring
+        // (or its use is not permitted), the parcelport falls back to asio
+        // in this case.
+        static std::unique_ptr<io_uring_queue> create(unsigned entries);
+
+        ~io_uring_queue();
+
+        io_uring_queue(io_uring_queue const&) = delete;
+        io_uring_queue& operator=(io_uring_queue const&) = delete;
+
+        void sendmsg(int fd, msghdr const* msg, io_uring_operation* op);
+        void recvmsg(int fd, msghdr* msg, io_uring_operation* op);
+
+        // Submit all pending operations and dispatch the available
+        // completions, returns whether any work was done.
+        bool poll();
+
+        std::size_t in_flight() const
+        {
+            return in_flight_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        io_uring_queue();
+
+        bool init(unsigned entries);
+        void push(std::uint8_t opcode, int fd, void const* msg,
+            std::uint32_t msg_flags, io_uring_operation* op);
+        bool submit_locked();
+        bool reap();
+
+        int fd_;
+
+        void* sq_ring_;
+        std::size_t sq_ring_size_;
+        void* cq_ring_;
+        std::size_t cq_ring_size_;
+        io_uring_sqe* sqes_;
+        std::size_t sqes_size_;
+
+        unsigned* sq_head_;
+        unsigned* sq_tail_;
+        unsigned* sq_mask_;
+        unsigned* sq_flags_;
+        unsigned* sq_array_;
+        unsigned sq_entries_;
+
+        unsigned* cq_head_;
+        unsigned* cq_tail_;
+        unsigned* cq_mask_;
+        io_uring_cqe* cqes_;
+
+        mutex_type sq_mtx_;
+        unsigned unsubmitted_;
+
+        mutex_type cq_mtx_;
+        std::atomic<std::size_t> in_flight_;
+    };
+}}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+
+#endif
@@ -19,8 +19,10 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
@@ -46,7 +48,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
     class connection_handler;
 
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, std::vector<char>, receive_buffer>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
@@ -59,6 +61,9 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(nullptr)
+#endif
         {}
 
         ~receiver()
@@ -69,6 +74,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         /// Get the socket associated with the parcelport_connection.
         boost::asio::ip::tcp::socket& socket() { return socket_; }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        /// Perform all reads and writes through the given io_uring instead
+        /// of the io_service this connection was created with.
+        void use_io_uring(io_uring_queue* uring)
+        {
+            uring_ = uring;
+        }
+#endif
+
         /// Asynchronously read a data structure from the socket.
         template <typename Handler>
         void async_read(Handler handler)
@@ -112,7 +126,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         std::size_t, Handler)
                     = &receiver::handle_read_header<Handler>;
 
-                boost::asio::async_read(socket_, buffers,
+                do_async_read(buffers,
                     util::bind(f, shared_from_this(),
                         boost::asio::placeholders::error,
                         boost::asio::placeholders::bytes_transferred,
@@ -122,16 +136,27 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         void shutdown()
         {
-            std::lock_guard<mutex_type> lk(mtx_);
-            // gracefully and portably shutdown the socket
-            boost::system::error_code ec;
-            if (socket_.is_open()) {
-                socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
-                socket_.close(ec);    // close the socket to give it back to the OS
+            {
+                std::lock_guard<mutex_type> lk(mtx_);
+                // gracefully and portably shutdown the socket
+                boost::system::error_code ec;
+                if (socket_.is_open()) {
+                    socket_.shutdown(
+                        boost::asio::ip::tcp::socket::shutdown_both, ec);
+                    // close the socket to give it back to the OS
+                    socket_.close(ec);
+                }
             }
 
+            // the completion handlers acquire the lock, don't hold on to it
+            // while waiting for them
             while(operation_in_flight_ != 0)
             {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+                // nobody else might be reaping completions at this point
+                if (uring_ != nullptr)
+                    uring_->poll();
+#endif
                 if(threads::get_self_ptr())
                     hpx::this_thread::suspend(hpx::threads::pending,
                         "tcp::reveiver::shutdown");
@@ -139,6 +164,35 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         }
 
     private:
+        template <typename Buffers, typename F>
+        void do_async_read(Buffers const& buffers, F && f)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                // all buffers are received by a single request
+                operation_.async_read(*uring_, socket_.native_handle(),
+                    buffers, std::forward<F>(f));
+                return;
+            }
+#endif
+            boost::asio::async_read(socket_, buffers, std::forward<F>(f));
+        }
+
+        template <typename Buffers, typename F>
+        void do_async_write(Buffers const& buffers, F && f)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                operation_.async_write(*uring_, socket_.native_handle(),
+                    buffers, std::forward<F>(f));
+                return;
+            }
+#endif
+            boost::asio::async_write(socket_, buffers, std::forward<F>(f));
+        }
+
         /// Handle a completed read of the message size from the
         /// message header.
         template <typename Handler>
@@ -226,7 +280,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    do_async_read(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -285,7 +339,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    do_async_read(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -330,8 +384,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             boost::asio::error::not_connected));
                         return;
                     }
-                    boost::asio::async_write(socket_,
-                        boost::asio::buffer(&ack_, sizeof(ack_)),
+                    do_async_write(boost::asio::buffer(&ack_, sizeof(ack_)),
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -371,6 +424,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_queue* uring_;
+        io_uring_operation operation_;
+#endif
     };
 }}}}
 
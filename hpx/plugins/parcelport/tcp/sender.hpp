@@ -16,6 +16,7 @@
 #include <hpx/config/asio.hpp>
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -59,8 +60,20 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+          , uring_(nullptr)
+#endif
+        {
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        /// Perform all reads and writes through the given io_uring instead
+        /// of the io_service this connection was created with.
+        void use_io_uring(io_uring_queue* uring)
         {
+            uring_ = uring;
         }
+#endif
 
         ~sender()
         {
@@ -165,6 +178,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                // all buffers are passed to the kernel in a single request
+                operation_.async_write(*uring_, socket_.native_handle(),
+                    buffers, util::bind(f, shared_from_this(), _1, _2));
+                return;
+            }
+#endif
             boost::asio::async_write(socket_, buffers,
                 util::bind(f, shared_from_this(), _1, _2));
         }
@@ -230,6 +252,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 = &sender::handle_read_ack;
 
             using util::placeholders::_1;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (uring_ != nullptr)
+            {
+                operation_.async_read(*uring_, socket_.native_handle(),
+                    boost::asio::buffer(&ack_, sizeof(ack_)),
+                    util::bind(f, shared_from_this(), _1));
+                return;
+            }
+#endif
             boost::asio::async_read(socket_,
                 boost::asio::buffer(&ack_, sizeof(ack_)),
                 util::bind(f, shared_from_this(), _1));
@@ -275,6 +306,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 , std::shared_ptr<sender>
                 )
         > postprocess_handler_;
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_queue* uring_;
+        io_uring_operation operation_;
+#endif
     };
 }}}}
 
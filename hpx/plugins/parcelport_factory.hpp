@@ -104,6 +104,9 @@ namespace hpx { namespace plugins
                 "async_serialization = ${HPX_PARCEL_" + name_uc +
                     "_ASYNC_SERIALIZATION:"
                     "$[hpx.parcel.async_serialization]}",
+                "parallel_encoding_threshold = ${HPX_PARCEL_" + name_uc +
+                    "_PARALLEL_ENCODING_THRESHOLD:"
+                    "$[hpx.parcel.parallel_encoding_threshold]}",
                 "priority = ${HPX_PARCEL_" + name_uc +
                     "_PRIORITY:" + traits::plugin_config_data<Parcelport>::priority()
                                  + "}"
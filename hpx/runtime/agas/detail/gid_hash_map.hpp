@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_RUNTIME_AGAS_DETAIL_GID_HASH_MAP_OCT_18_2026_0402AM)
+#define HPX_RUNTIME_AGAS_DETAIL_GID_HASH_MAP_OCT_18_2026_0402AM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Open-addressing hash map (linear probing with backward shift deletion)
+    // from GIDs to values of type T. The invalid GID is used to mark empty
+    // slots and must not be used as a key. The map is not thread-safe.
+    template <typename T>
+    class gid_hash_map
+    {
+        struct slot
+        {
+            slot()
+              : key_(naming::invalid_gid)
+              , value_()
+            {}
+
+            naming::gid_type key_;
+            T value_;
+        };
+
+        static std::size_t hash(naming::gid_type const& key)
+        {
+            // std::hash<gid_type> maps consecutive GIDs to consecutive values,
+            // mix all bits to avoid long probing sequences
+            std::uint64_t x = std::hash<naming::gid_type>()(key);
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            return std::size_t(x);
+        }
+
+    public:
+        explicit gid_hash_map(std::size_t initial_capacity = 16)
+          : size_(0)
+        {
+            std::size_t capacity = 16;
+            while (capacity < initial_capacity)
+                capacity <<= 1;
+            slots_.resize(capacity);
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+        T* find(naming::gid_type const& key)
+        {
+            HPX_ASSERT(key != naming::invalid_gid);
+
+            std::size_t const mask = slots_.size() - 1;
+            for (std::size_t i = hash(key) & mask; /**/; i = (i + 1) & mask)
+            {
+                slot& s = slots_[i];
+                if (s.key_ == key)
+                    return &s.value_;
+                if (s.key_ == naming::invalid_gid)
+                    return nullptr;
+            }
+        }
+
+        // Insert the given value if the key is not mapped yet. Returns the
+        // mapped value and whether the insertion took place.
+        template <typename U>
+        std::pair<T*, bool> insert(naming::gid_type const& key, U && value)
+        {
+            HPX_ASSERT(key != naming::invalid_gid);
+
+            // keep the load factor below 3/4
+            if (4 * (size_ + 1) > 3 * slots_.size())
+                rehash(2 * slots_.size());
+
+            std::size_t const mask = slots_.size() - 1;
+            for (std::size_t i = hash(key) & mask; /**/; i = (i + 1) & mask)
+            {
+                slot& s = slots_[i];
+                if (s.key_ == key)
+                    return std::make_pair(&s.value_, false);
+
+                if (s.key_ == naming::invalid_gid)
+                {
+                    s.key_ = key;
+                    s.value_ = std::forward<U>(value);
+                    ++size_;
+                    return std::make_pair(&s.value_, true);
+                }
+            }
+        }
+
+        bool erase(naming::gid_type const& key)
+        {
+            HPX_ASSERT(key != naming::invalid_gid);
+
+            std::size_t const mask = slots_.size() - 1;
+            std::size_t i = hash(key) & mask;
+            for (/**/; /**/; i = (i + 1) & mask)
+            {
+                if (slots_[i].key_ == key)
+                    break;
+                if (slots_[i].key_ == naming::invalid_gid)
+                    return false;
+            }
+
+            // move subsequent entries of the probing sequence into the gap
+            // unless they are located at their home position already
+            for (std::size_t j = (i + 1) & mask; /**/; j = (j + 1) & mask)
+            {
+                slot& s = slots_[j];
+                if (s.key_ == naming::invalid_gid)
+                    break;
+
+                std::size_t home = hash(s.key_) & mask;
+                bool const in_between = (i <= j) ?
+                    (i < home && home <= j) : (i < home || home <= j);
+                if (!in_between)
+                {
+                    slots_[i] = std::move(s);
+                    i = j;
+                }
+            }
+
+            slots_[i] = slot();
+            --size_;
+            return true;
+        }
+
+    private:
+        void rehash(std::size_t capacity)
+        {
+            std::vector<slot> slots(capacity);
+            std::swap(slots_, slots);
+
+            std::size_t const mask = capacity - 1;
+            for (slot& old : slots)
+            {
+                if (old.key_ == naming::invalid_gid)
+                    continue;
+
+                std::size_t i = hash(old.key_) & mask;
+                while (slots_[i].key_ != naming::invalid_gid)
+                    i = (i + 1) & mask;
+
+                slots_[i] = std::move(old);
+            }
+        }
+
+        std::vector<slot> slots_;
+        std::size_t size_;
+    };
+}}}
+
+#endif
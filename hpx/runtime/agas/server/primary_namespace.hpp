@@ -14,6 +14,7 @@
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/lcos/local/condition_variable.hpp>
 #include <hpx/runtime/agas_fwd.hpp>
+#include <hpx/runtime/agas/detail/gid_hash_map.hpp>
 #include <hpx/runtime/agas/gva.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/util/internal_allocator.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -128,12 +130,38 @@ struct HPX_EXPORT primary_namespace
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
+    // The bindings of single GIDs and the credit counts are spread over
+    // independently locked shards selected by a hash of the (stripped) GID.
+    // The number of shards has to be a power of two.
+    static constexpr std::size_t num_shards = 64;
+
+    struct shard
+    {
+        shard()
+          : mtx_()
+          , gvas_()
+          , refcnts_()
+        {}
+
+        mutex_type mtx_;
+        detail::gid_hash_map<gva_table_data_type> gvas_;
+        detail::gid_hash_map<std::int64_t> refcnts_;
+    };
+    std::array<shard, num_shards> shards_;
+
+    shard& get_shard(naming::gid_type const& id);
+
+    // Bindings covering more than one GID are kept in an ordered table to be
+    // able to find the range a GID belongs to. A shard mutex may be held
+    // while acquiring ranges_mutex_, but not the other way around.
+    mutex_type ranges_mutex_;
+    gva_table_type gva_ranges_;
+    std::atomic<std::size_t> num_ranges_;
+
+    // protects the table of objects being migrated, this mutex may be held
+    // while acquiring any of the other mutexes
     mutex_type mutex_;
 
-    gva_table_type gvas_;
-    refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
             hpx::util::tuple<bool, std::size_t, lcos::local::detail::condition_variable>
@@ -221,14 +249,10 @@ struct HPX_EXPORT primary_namespace
     counter_data counter_data_;
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit counts of all GIDs in the given range.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         );
 #endif
@@ -242,6 +266,7 @@ struct HPX_EXPORT primary_namespace
   public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
+      , num_ranges_(0)
       , mutex_()
       , instance_name_()
       , next_id_(naming::invalid_gid)
@@ -312,10 +337,18 @@ struct HPX_EXPORT primary_namespace
     naming::gid_type statistics_counter(std::string const& name);
 
   private:
-    resolved_type resolve_gid_locked(
+    resolved_type resolve_gid_impl(
+        naming::gid_type const& gid
+      , error_code& ec
+        );
+
+    bool rebind_gid_locked(
         std::unique_lock<mutex_type>& l
+      , gva_table_data_type& data
+      , gva const& g
+      , naming::gid_type const& id
       , naming::gid_type const& gid
-      , error_code& ec
+      , naming::gid_type const& locality
         );
 
     void increment(
@@ -343,8 +376,7 @@ struct HPX_EXPORT primary_namespace
         std::list<free_entry, free_entry_allocator_type>;
 
     void resolve_free_list(
-        std::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+        std::list<naming::gid_type> const& free_list
       , free_entry_list_type& free_entry_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
@@ -17,6 +18,7 @@
 #include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/util/assert.hpp>
 
+#include <mutex>
 #include <type_traits>
 
 namespace hpx { namespace components { namespace server
@@ -44,12 +46,29 @@ namespace hpx { namespace components { namespace server
         {}
 
         /// Retrieve the configuration data.
-        ConfigData get() const { return data_; }
+        ConfigData get() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return data_;
+        }
+
+        /// Replace the configuration data, all subsequent calls to get()
+        /// return the new data.
+        void set(ConfigData const& data)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            data_ = data;
+        }
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             distributed_metadata_base, get);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            distributed_metadata_base, set);
 
     private:
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        mutable mutex_type mtx_;
         ConfigData data_;
     };
 }}}
@@ -71,6 +90,10 @@ namespace hpx { namespace components { namespace server
         ::hpx::components::server::distributed_metadata_base<config>::        \
             get_action,                                                       \
         HPX_PP_CAT(__distributed_metadata_get_action_, name));                \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        ::hpx::components::server::distributed_metadata_base<config>::        \
+            set_action,                                                       \
+        HPX_PP_CAT(__distributed_metadata_set_action_, name));                \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         ::hpx::lcos::base_lco_with_value<config>::set_value_action,           \
         HPX_PP_CAT(__set_value_distributed_metadata_config_data_, name))      \
@@ -93,6 +116,10 @@ namespace hpx { namespace components { namespace server
         ::hpx::components::server::distributed_metadata_base<config>::        \
             get_action,                                                       \
         HPX_PP_CAT(__distributed_metadata_get_action_, name));                \
+    HPX_REGISTER_ACTION(                                                      \
+        ::hpx::components::server::distributed_metadata_base<config>::        \
+            set_action,                                                       \
+        HPX_PP_CAT(__distributed_metadata_set_action_, name));                \
     HPX_REGISTER_ACTION(                                                      \
         ::hpx::lcos::base_lco_with_value<config>::set_value_action,           \
         HPX_PP_CAT(__set_value_distributed_metadata_config_data_, name))      \
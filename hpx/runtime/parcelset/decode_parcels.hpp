@@ -15,6 +15,7 @@
 #include <hpx/runtime/naming/resolver_client.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/detail/parcel_route_handler.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/util/assert.hpp>
@@ -28,7 +29,9 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -102,6 +105,54 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the owners of the memory of the zero-copy chunks, indexed the
+    // same way as the chunks returned from decode_chunks. This is possible
+    // only if the parcelport has received the chunks into receive_buffers.
+    template <typename Buffer>
+    std::vector<std::shared_ptr<char> > decode_chunk_owners(
+        Buffer &, std::size_t, std::false_type)
+    {
+        return std::vector<std::shared_ptr<char> >();
+    }
+
+    template <typename Buffer>
+    std::vector<std::shared_ptr<char> > decode_chunk_owners(
+        Buffer & buffer, std::size_t num_chunks, std::true_type)
+    {
+        std::vector<std::shared_ptr<char> > owners;
+
+        std::size_t num_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first));
+
+        if (num_zero_copy_chunks != 0 && num_chunks != 0)
+        {
+            owners.resize(num_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                std::size_t first = static_cast<std::size_t>(
+                    static_cast<std::uint64_t>(
+                        buffer.transmission_chunks_[i].first));
+                owners[first] = buffer.chunks_[i].shared_data();
+            }
+        }
+
+        return owners;
+    }
+
+    template <typename Buffer>
+    std::vector<std::shared_ptr<char> > decode_chunk_owners(
+        Buffer & buffer, std::size_t num_chunks)
+    {
+        typedef typename std::is_same<
+                typename std::decay<decltype(buffer.chunks_[0])>::type,
+                receive_buffer
+            >::type has_owners;
+
+        return decode_chunk_owners(buffer, num_chunks, has_owners());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -125,10 +176,15 @@ namespace hpx { namespace parcelset
                     buffer.data_point_;
 
                 {
+                    // allow de-serialized data to take over the memory
+                    // of the zero-copy chunks
+                    std::vector<std::shared_ptr<char> > chunk_owners(
+                        decode_chunk_owners(buffer, chunks.size()));
+
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, &chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -0,0 +1,70 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_DETAIL_ENCODE_SEGMENTS_HPP
+#define HPX_PARCELSET_DETAIL_ENCODE_SEGMENTS_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/runtime/serialization/serialization_chunk.hpp>
+#include <hpx/util/function.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace hpx { namespace serialization
+{
+    struct output_archive;
+}}
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Serialize the parcels [first, last) into the given archive.
+    HPX_EXPORT void serialize_parcels(parcelport& pp,
+        serialization::output_archive& archive, parcel const* ps,
+        std::size_t first, std::size_t last);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A contiguous range of the parcels of a message which is serialized
+    // into an archive of its own. The data and the chunks are gathered into
+    // the message afterwards, the archive header is not transmitted.
+    struct encoded_segment
+    {
+        encoded_segment(std::size_t first, std::size_t last)
+          : first_(first), last_(last), header_size_(0), bytes_written_(0),
+            tracks_pointers_(false)
+        {}
+
+        std::size_t first_;
+        std::size_t last_;
+
+        std::size_t header_size_;
+        std::size_t bytes_written_;     // including the header
+
+        // positions of tracked pointers are relative to the segment, they
+        // might collide with the ones used by other segments
+        bool tracks_pointers_;
+
+        std::vector<char> data_;
+        std::vector<serialization::serialization_chunk> chunks_;
+    };
+
+    // Split the given parcels into segments of at least 'threshold'
+    // (estimated) bytes each. Returns an empty list if the parcels should
+    // be serialized sequentially.
+    HPX_EXPORT std::vector<encoded_segment> plan_segments(
+        parcel const* ps, std::size_t num_parcels, std::size_t threshold);
+
+    // Serialize all segments but the first concurrently on additional HPX
+    // threads while the calling thread invokes 'encode_first' and then
+    // helps with the remaining segments. Returns the number of threads
+    // which took part in serializing the segments.
+    HPX_EXPORT std::size_t encode_segments(parcelport& pp, parcel const* ps,
+        std::vector<encoded_segment>& segments, int archive_flags,
+        util::function_nonser<void()> const& encode_first);
+}}}
+
+#endif
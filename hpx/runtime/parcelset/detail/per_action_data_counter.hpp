@@ -44,6 +44,14 @@ namespace hpx { namespace parcelset { namespace detail
         std::int64_t total_bytes(
             std::string const& action, bool reset);
 
+        // the total time compression took (nanoseconds)
+        std::int64_t total_compression_time(
+            std::string const& action, bool reset);
+
+        // ratio of uncompressed to compressed data (in units of 0.01)
+        std::int64_t compression_ratio(
+            std::string const& action, bool reset);
+
     private:
         typedef std::unordered_map<
                 std::string, performance_counters::parcels::gatherer_nolock,
@@ -14,6 +14,7 @@
 #include <hpx/exception.hpp>
 #include <hpx/exception_info.hpp>
 #include <hpx/runtime/actions/basic_action.hpp>
+#include <hpx/runtime/parcelset/detail/encode_segments.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
 #include <hpx/runtime/parcelset/parcel_buffer.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
@@ -29,6 +30,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <memory>
 #include <string>
@@ -76,6 +78,28 @@ namespace hpx
                 return result;
             }
 
+            // record the statistics of compressing a message, the filter is
+            // selected by the action of the first parcel
+            template <typename Buffer>
+            void add_compression_data(parcelport& pp, parcel const& p,
+                Buffer& buffer, std::int64_t compression_time,
+                std::size_t arg_size)
+            {
+                performance_counters::parcels::data_point& data =
+                    buffer.data_point_;
+                data.compression_time_ = compression_time;
+                data.uncompressed_bytes_ = arg_size;
+                data.compressed_bytes_ = buffer.data_.size();
+
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                performance_counters::parcels::data_point action_data;
+                action_data.compression_time_ = data.compression_time_;
+                action_data.uncompressed_bytes_ = data.uncompressed_bytes_;
+                action_data.compressed_bytes_ = data.compressed_bytes_;
+                pp.add_sent_data(p.get_action()->get_action_name(), action_data);
+#endif
+            }
+
             template <typename Buffer>
             void encode_finalize(Buffer & buffer, std::size_t arg_size)
             {
@@ -127,6 +151,126 @@ namespace hpx
             }
         }
 
+        namespace detail
+        {
+            ///////////////////////////////////////////////////////////////////
+            // Append the data and the chunks of a separately serialized
+            // segment to the message, returns the number of bytes added.
+            template <typename Buffer>
+            std::size_t append_segment(Buffer& buffer,
+                encoded_segment const& segment)
+            {
+                std::size_t const header_size = segment.header_size_;
+                std::size_t const base = buffer.data_.size();
+
+                std::size_t size = segment.data_.size() - header_size;
+                if (size != 0)
+                {
+                    buffer.data_.resize(base + size);
+                    std::memcpy(&buffer.data_[base],
+                        segment.data_.data() + header_size, size);
+                }
+
+                for (serialization::serialization_chunk const& c :
+                    segment.chunks_)
+                {
+                    if (c.type_ != serialization::chunk_type_index)
+                    {
+                        buffer.chunks_.push_back(c);
+                        continue;
+                    }
+
+                    // the archive header of the segment is dropped
+                    std::size_t index = c.data_.index_;
+                    std::size_t chunk_size = c.size_;
+                    if (index < header_size)
+                    {
+                        HPX_ASSERT(index + chunk_size >= header_size);
+                        chunk_size -= header_size - index;
+                        index = header_size;
+                    }
+                    if (chunk_size == 0)
+                        continue;
+
+                    index = index - header_size + base;
+
+                    // merge with the preceding chunk, if possible, to end up
+                    // with the same chunks as for sequential serialization
+                    if (!buffer.chunks_.empty())
+                    {
+                        serialization::serialization_chunk& last =
+                            buffer.chunks_.back();
+                        if (last.type_ == serialization::chunk_type_index &&
+                            last.data_.index_ + last.size_ == index)
+                        {
+                            last.size_ += chunk_size;
+                            continue;
+                        }
+                    }
+                    buffer.chunks_.push_back(
+                        serialization::create_index_chunk(index, chunk_size));
+                }
+
+                return segment.bytes_written_ - header_size;
+            }
+
+            // Serialize the given segments of the message concurrently and
+            // gather them into the buffer. Returns false (leaving the buffer
+            // empty) if the message has to be serialized sequentially.
+            template <typename Buffer>
+            bool encode_concurrently(parcelport& pp, parcel const* ps,
+                std::size_t num_parcels, Buffer& buffer, int archive_flags,
+                std::vector<encoded_segment>& segments,
+                std::size_t& arg_size, std::size_t& serialization_threads)
+            {
+                std::size_t size = 0;
+                bool tracks_pointers = false;
+                {
+                    serialization::output_archive archive(
+                        buffer.data_, archive_flags, &buffer.chunks_);
+
+                    archive << num_parcels; //-V128
+
+                    // the first segment is serialized directly into the
+                    // message by the calling thread
+                    serialization_threads = encode_segments(pp, ps,
+                        segments, archive_flags,
+                        [&]()
+                        {
+                            serialize_parcels(pp, archive, ps,
+                                segments[0].first_, segments[0].last_);
+                            archive.flush();
+                        });
+
+                    size = archive.bytes_written();
+                    tracks_pointers = archive.has_tracked_pointers();
+                }
+
+                // the positions of tracked pointers are used to identify
+                // them, those are unique only inside of one segment
+                for (std::size_t i = 1; i != segments.size(); ++i)
+                {
+                    if (segments[i].tracks_pointers_)
+                    {
+                        if (tracks_pointers)
+                        {
+                            buffer.data_.resize(0);
+                            buffer.chunks_.clear();
+                            serialization_threads = 1;
+                            return false;
+                        }
+                        tracks_pointers = true;
+                    }
+                }
+
+                for (std::size_t i = 1; i != segments.size(); ++i)
+                    size += append_segment(buffer, segments[i]);
+
+                arg_size = size;
+                return true;
+            }
+        }
+
         template <typename Buffer>
         std::size_t
         encode_parcels(parcelport& pp,
@@ -173,6 +317,21 @@ namespace hpx
                     // mark start of serialization
                     util::high_resolution_timer timer;
 
+                    // large messages are serialized concurrently, this is
+                    // not supported for compressed archives
+                    std::vector<detail::encoded_segment> segments;
+                    if (filter.get() == nullptr &&
+                        num_parcels != std::size_t(-1))
+                    {
+                        segments = detail::plan_segments(ps, parcels_sent,
+                            pp.get_parallel_encoding_threshold());
+                    }
+
+                    std::size_t serialization_threads = 1;
+                    if (segments.empty() ||
+                        !detail::encode_concurrently(pp, ps, parcels_sent, buffer,
+                            archive_flags, segments, arg_size,
+                            serialization_threads))
                     {
                         // Serialize the data
                         if (filter.get() != nullptr)
@@ -187,33 +346,28 @@ namespace hpx
                         if(num_parcels != std::size_t(-1))
                             archive << parcels_sent; //-V128
 
-                        for(std::size_t i = 0; i != parcels_sent; ++i)
-                        {
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                            std::size_t archive_pos = archive.current_pos();
-                            std::int64_t serialize_time =
-                                timer.elapsed_nanoseconds();
-#endif
+                        detail::serialize_parcels(pp, archive, ps, 0,
+                            parcels_sent);
 
-                            LPT_(debug) << ps[i];
-                            archive.set_split_gids(ps[i].split_gids());
-                            archive << ps[i];
+                        // the filter processes all of the data while the
+                        // archive is being flushed
+                        std::int64_t compression_time =
+                            timer.elapsed_nanoseconds();
 
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                            performance_counters::parcels::data_point action_data;
-                            action_data.bytes_ = archive.current_pos() - archive_pos;
-                            action_data.serialization_time_ =
-                                timer.elapsed_nanoseconds() - serialize_time;
-                            action_data.num_parcels_ = 1;
-                            pp.add_sent_data(
-                                ps[i].get_action()->get_action_name(),
-                                action_data);
-#endif
-                        }
                         archive.flush();
                         arg_size = archive.bytes_written();
+
+                        if (filter.get() != nullptr)
+                        {
+                            detail::add_compression_data(pp, ps[0], buffer,
+                                timer.elapsed_nanoseconds() - compression_time,
+                                arg_size);
+                        }
                     }
 
+                    buffer.data_point_.serialization_threads_ =
+                        serialization_threads;
+
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
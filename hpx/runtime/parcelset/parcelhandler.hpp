@@ -359,6 +359,18 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // accumulated number of threads serializing the messages sent
+        std::int64_t get_serialization_threads_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // the total time it took to compress the messages sent (nanoseconds)
+        std::int64_t get_compression_time_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // ratio of uncompressed to compressed data sent (in units of 0.01)
+        std::int64_t get_compression_ratio_sent(
+            std::string const& pp_type, bool reset) const;
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -390,6 +402,16 @@ namespace hpx { namespace parcelset
         // total data received (bytes)
         std::int64_t get_action_data_received(std::string const& pp_type,
             std::string const& action, bool reset) const;
+
+        // the total time it took to compress the messages sent (nanoseconds)
+        std::int64_t get_action_compression_time_sent(
+            std::string const& pp_type, std::string const& action,
+            bool reset) const;
+
+        // ratio of uncompressed to compressed data sent (in units of 0.01)
+        std::int64_t get_action_compression_ratio_sent(
+            std::string const& pp_type, std::string const& action,
+            bool reset) const;
 #endif
 
         //
@@ -241,6 +241,15 @@ namespace hpx { namespace parcelset
         std::int64_t get_buffer_allocate_time_sent(bool reset);
         std::int64_t get_buffer_allocate_time_received(bool reset);
 
+        /// accumulated number of threads serializing the messages sent
+        std::int64_t get_serialization_threads_sent(bool reset);
+
+        /// the total time it took to compress the messages sent (nanoseconds)
+        std::int64_t get_compression_time_sent(bool reset);
+
+        /// ratio of uncompressed to compressed data sent (in units of 0.01)
+        std::int64_t get_compression_ratio_sent(bool reset);
+
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -270,6 +279,14 @@ namespace hpx { namespace parcelset
         // total data received (bytes)
         std::int64_t get_action_data_received(
             std::string const&, bool reset);
+
+        // the total time it took to compress the messages sent (nanoseconds)
+        std::int64_t get_action_compression_time_sent(
+            std::string const&, bool reset);
+
+        // ratio of uncompressed to compressed data sent (in units of 0.01)
+        std::int64_t get_action_compression_ratio_sent(
+            std::string const&, bool reset);
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -321,6 +338,14 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        /// Return the minimal (estimated) amount of parcel data one thread
+        /// should serialize when encoding a message concurrently, zero
+        /// disables concurrent encoding
+        std::size_t get_parallel_encoding_threshold() const
+        {
+            return parallel_encoding_threshold_;
+        }
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(boost::system::error_code const& ec,
             parcel const & p);
@@ -367,6 +392,9 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// concurrent serialization of large messages
+        std::size_t parallel_encoding_threshold_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
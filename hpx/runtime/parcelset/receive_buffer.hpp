@@ -0,0 +1,101 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_RECEIVE_BUFFER_HPP
+#define HPX_PARCELSET_RECEIVE_BUFFER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/function.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace hpx { namespace parcelset
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The type of a function providing the memory the zero-copy chunks of
+    /// incoming messages are received into. It is invoked with the size of
+    /// the chunk and may return an empty pointer to fall back to the default
+    /// allocation. The memory has to stay valid for as long as any copy of
+    /// the returned pointer is alive.
+    ///
+    /// Large arrays sent as a serialize_buffer using the default allocator
+    /// take over this memory on the receiving locality without copying it.
+    typedef util::function_nonser<std::shared_ptr<char>(std::size_t)>
+        receive_buffer_provider;
+
+    /// Install the function used to allocate the memory for incoming
+    /// zero-copy chunks, returns the previously installed function. Passing
+    /// an empty function restores the default allocation.
+    HPX_EXPORT receive_buffer_provider set_receive_buffer_provider(
+        receive_buffer_provider f);
+
+    /// Allocate memory for an incoming zero-copy chunk of the given size.
+    HPX_EXPORT std::shared_ptr<char> allocate_receive_buffer(std::size_t size);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Storage for an incoming zero-copy chunk. The memory is shared such that
+    // it can outlive the parcel buffer if it is adopted by the de-serialized
+    // data.
+    class receive_buffer
+    {
+    public:
+        typedef std::allocator<char> allocator_type;
+
+        explicit receive_buffer(allocator_type const& = allocator_type())
+          : size_(0)
+        {}
+
+        void resize(std::size_t size)
+        {
+            if (size == size_)
+                return;
+
+            data_ = (size != 0) ? allocate_receive_buffer(size) :
+                std::shared_ptr<char>();
+            size_ = size;
+        }
+
+        char* data()
+        {
+            return data_.get();
+        }
+        char const* data() const
+        {
+            return data_.get();
+        }
+
+        char& operator[](std::size_t i)
+        {
+            return data_.get()[i];
+        }
+        char const& operator[](std::size_t i) const
+        {
+            return data_.get()[i];
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        void clear()
+        {
+            data_.reset();
+            size_ = 0;
+        }
+
+        std::shared_ptr<char> const& shared_data() const
+        {
+            return data_;
+        }
+
+    private:
+        std::shared_ptr<char> data_;
+        std::size_t size_;
+    };
+}}
+
+#endif
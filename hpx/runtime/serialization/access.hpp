@@ -218,6 +218,14 @@ namespace hpx { namespace serialization
         };
 
     public:
+        // true if T is serialized using a serialize() member function
+        template <class T>
+        struct has_intrusive_serialization
+          : std::integral_constant<bool,
+                hpx::traits::is_intrusive_polymorphic<T>::value ||
+                has_serialize<T>::value>
+        {};
+
         template <class Archive, class T>
         static void serialize(Archive& ar, T& t, unsigned)
         {
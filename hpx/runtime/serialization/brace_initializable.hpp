@@ -10,167 +10,359 @@
 
 #if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) && defined (HPX_HAVE_CXX17_IF_CONSTEXPR)
 
+#include <hpx/runtime/serialization/access.hpp>
+#include <hpx/runtime/serialization/basic_archive.hpp>
 #include <hpx/runtime/serialization/brace_initializable_fwd.hpp>
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
 #include <hpx/traits/brace_initializable_traits.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+#include <hpx/util/detail/pack.hpp>
 #include <hpx/util/tuple.hpp>
 
+#include <boost/predef/other/endian.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
 
 namespace hpx { namespace serialization
 {
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<0>)
+    namespace detail
     {
-        serialize(archive, t, version);
-    }
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke 'f' with references to all fields of the given struct.
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<1>)
+        {
+            auto& [p1] = t;
+            return f(p1);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<1>)
-    {
-        auto& [p1] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<2>)
+        {
+            auto& [p1, p2] = t;
+            return f(p1, p2);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<2>)
-    {
-        auto& [p1, p2] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<3>)
+        {
+            auto& [p1, p2, p3] = t;
+            return f(p1, p2, p3);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<3>)
-    {
-        auto& [p1, p2, p3] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<4>)
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return f(p1, p2, p3, p4);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<4>)
-    {
-        auto& [p1, p2, p3, p4] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3, p4);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<5>)
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return f(p1, p2, p3, p4, p5);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<5>)
-    {
-        auto& [p1, p2, p3, p4, p5] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3, p4, p5);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<6>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return f(p1, p2, p3, p4, p5, p6);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<6>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3, p4, p5, p6);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<7>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<7>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<8>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<8>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
-        auto&& data =
-            hpx::util::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<9>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<9>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
-        auto&& data =
-            hpx::util::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<10>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<10>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
-        auto&& data = hpx::util::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<11>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<11>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
-        auto&& data = hpx::util::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<12>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<12>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
-        auto&& data = hpx::util::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
-        serialize(archive, data, version);
-    }
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<13>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<13>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
-        auto&& data = hpx::util::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
-        serialize(archive, data, version);
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<14>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8,
+                p9, p10, p11, p12, p13, p14);
+        }
+
+        template <typename T, typename F>
+        decltype(auto) visit_struct(T& t, F&& f,
+            hpx::traits::detail::size<15>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14, p15] = t;
+            return f(p1, p2, p3, p4, p5, p6, p7, p8,
+                p9, p10, p11, p12, p13, p14, p15);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Compile-time layout description of brace-initializable structs.
+        //
+        // A struct has a bitwise layout if all of its fields are arithmetic
+        // types, enumerations, or (nested) std::arrays of those. Such structs
+        // are stored as a single block of sizeof(T) bytes instead of field by
+        // field. C-style arrays are not supported as brace elision prevents
+        // the number of fields of the enclosing struct from being detected.
+        template <typename T>
+        struct is_bitwise_struct_field
+          : std::integral_constant<bool,
+                (std::is_arithmetic<T>::value &&
+                    !std::is_same<T, long double>::value) ||
+                std::is_enum<T>::value>
+        {};
+
+        template <typename T, std::size_t N>
+        struct is_bitwise_struct_field<std::array<T, N> >
+          : is_bitwise_struct_field<T>
+        {};
+
+        struct struct_field_types
+        {
+            template <typename ... Ts>
+            hpx::util::detail::pack<typename std::decay<Ts>::type...>
+            operator()(Ts&...) const
+            {
+                return {};
+            }
+        };
+
+        template <typename Fields>
+        struct has_bitwise_struct_fields;
+
+        template <typename ... Ts>
+        struct has_bitwise_struct_fields<hpx::util::detail::pack<Ts...> >
+          : hpx::util::detail::all_of<is_bitwise_struct_field<Ts>...>
+        {};
+
+        template <typename T, typename Enable = void>
+        struct struct_layout
+        {
+            static constexpr bool is_bitwise = false;
+        };
+
+        template <typename T>
+        struct struct_layout<T,
+            typename std::enable_if<
+                std::is_class<T>::value &&
+                has_struct_serialization<T>::value &&
+                decltype(hpx::traits::detail::arity<T>())::value != 0
+            >::type>
+        {
+            typedef decltype(hpx::traits::detail::arity<T>()) arity_type;
+            typedef decltype(visit_struct(std::declval<T&>(),
+                struct_field_types(), arity_type())) field_types;
+
+            static constexpr std::size_t num_fields = arity_type::value;
+            static constexpr bool is_bitwise =
+                std::is_trivially_copyable<T>::value &&
+                has_bitwise_struct_fields<field_types>::value;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The fields of bitwise structs are stored using the byte order of
+        // the archive.
+        inline bool struct_needs_byte_swap(std::uint32_t flags)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            return (flags & hpx::serialization::endian_little) ? true : false;
+#else
+            return (flags & hpx::serialization::endian_big) ? true : false;
+#endif
+        }
+
+        struct swap_struct_field_bytes
+        {
+            template <typename T>
+            void swap(T& t) const
+            {
+                if constexpr (sizeof(T) != 1)
+                {
+                    reverse_bytes(sizeof(T),
+                        reinterpret_cast<char*>(std::addressof(t)));
+                }
+            }
+
+            template <typename T, std::size_t N>
+            void swap(std::array<T, N>& arr) const
+            {
+                for (T& t : arr)
+                    swap(t);
+            }
+
+            template <typename ... Ts>
+            void operator()(Ts&... ts) const
+            {
+                int const sequencer[] = { 0, (swap(ts), 0)... };
+                (void) sequencer;
+            }
+        };
+
+        template <typename T>
+        void swap_struct_bytes(T& t)
+        {
+            visit_struct(t, swap_struct_field_bytes(),
+                typename struct_layout<T>::arity_type());
+        }
+
+        template <typename T>
+        void serialize_bitwise_struct(output_archive& ar, T const& t)
+        {
+            if (!struct_needs_byte_swap(ar.flags()))
+            {
+                save_binary(ar, std::addressof(t), sizeof(T));
+                return;
+            }
+
+            T tmp(t);
+            swap_struct_bytes(tmp);
+            save_binary(ar, std::addressof(tmp), sizeof(T));
+        }
+
+        template <typename T>
+        void serialize_bitwise_struct(input_archive& ar, T& t)
+        {
+            load_binary(ar, std::addressof(t), sizeof(T));
+            if (struct_needs_byte_swap(ar.flags()))
+                swap_struct_bytes(t);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Arrays of bitwise structs are stored as one contiguous block.
+        template <typename T>
+        void save_bitwise_structs(output_archive& ar, T const* data,
+            std::size_t count)
+        {
+            if (!struct_needs_byte_swap(ar.flags()))
+            {
+                save_binary(ar, data, count * sizeof(T));
+                return;
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+                serialize_bitwise_struct(ar, data[i]);
+        }
+
+        template <typename T>
+        void load_bitwise_structs(input_archive& ar, T* data,
+            std::size_t count)
+        {
+            load_binary(ar, data, count * sizeof(T));
+            if (struct_needs_byte_swap(ar.flags()))
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                    swap_struct_bytes(data[i]);
+            }
+        }
+
+        // Types which are serialized as bitwise structs, i.e. which are not
+        // handled by any of the other serialization methods.
+        template <typename T>
+        struct is_bitwise_struct
+          : std::integral_constant<bool,
+                !hpx::traits::is_bitwise_serializable<T>::value &&
+                !access::has_intrusive_serialization<T>::value &&
+                !has_serialize_adl<T>::value &&
+                struct_layout<T>::is_bitwise>
+        {};
     }
 
     template <typename Archive, typename T>
     void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<14>)
+        hpx::traits::detail::size<0>)
     {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14] = t;
-        auto&& data = hpx::util::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14);
-        serialize(archive, data, version);
+        serialize(archive, t, version);
     }
 
-    template <typename Archive, typename T>
+    template <typename Archive, typename T, std::size_t N>
     void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<15>)
+        hpx::traits::detail::size<N> arity)
     {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
-            p14, p15] = t;
-        auto&& data = hpx::util::forward_as_tuple(p1, p2, p3, p4, p5,
-            p6, p7, p8, p9, p10, p11, p12, p13, p14, p15);
-        serialize(archive, data, version);
+        detail::visit_struct(t,
+            [&](auto&... fields)
+            {
+                auto&& data = hpx::util::forward_as_tuple(fields...);
+                serialize(archive, data, version);
+            },
+            arity);
     }
 
     template <typename Archive, typename T>
     void serialize_struct(Archive& ar, T& t, const unsigned int version)
     {
+        typedef typename std::remove_const<T>::type type;
+
+        if constexpr (detail::struct_layout<type>::is_bitwise)
+        {
+            if (!ar.disable_array_optimization())
+            {
+                detail::serialize_bitwise_struct(ar, const_cast<type&>(t));
+                return;
+            }
+        }
+
         serialize_struct(ar, t, version, hpx::traits::detail::arity<T>());
     }
 }}
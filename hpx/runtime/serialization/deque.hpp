@@ -7,33 +7,92 @@
 #define HPX_SERIALIZATION_DEQUE_HPP
 
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/detail/serialize_bitwise_collection.hpp>
 #include <hpx/runtime/serialization/detail/serialize_collection.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 
 #include <cstdint>
 #include <deque>
+#include <type_traits>
 
 namespace hpx { namespace serialization
 {
+    namespace detail
+    {
+        template <typename T, typename Allocator>
+        void load_deque_impl(input_archive & ar, std::deque<T, Allocator> & d,
+            std::uint64_t size, std::false_type)
+        {
+            // normal load ...
+            detail::load_collection(ar, d, size);
+        }
+
+        template <typename T, typename Allocator>
+        void load_deque_impl(input_archive & ar, std::deque<T, Allocator> & d,
+            std::uint64_t size, std::true_type)
+        {
+            if (ar.disable_array_optimization())
+            {
+                load_deque_impl(ar, d, size, std::false_type());
+                return;
+            }
+
+            // bitwise load into the contiguous segments of the deque ...
+            d.resize(size);
+            load_bitwise_segments<T>(ar, d.begin(), size);
+        }
+
+        template <typename T, typename Allocator>
+        void save_deque_impl(output_archive & ar,
+            const std::deque<T, Allocator> & d, std::false_type)
+        {
+            // normal save ...
+            detail::save_collection(ar, d);
+        }
+
+        template <typename T, typename Allocator>
+        void save_deque_impl(output_archive & ar,
+            const std::deque<T, Allocator> & d, std::true_type)
+        {
+            if (ar.disable_array_optimization())
+            {
+                save_deque_impl(ar, d, std::false_type());
+                return;
+            }
+
+            // bitwise save of the contiguous segments of the deque ...
+            save_bitwise_segments<T>(ar, d.begin(), d.size());
+        }
+    }
+
     template <typename T, typename Allocator>
     void serialize(input_archive & ar, std::deque<T, Allocator> & d, unsigned)
     {
-        // normal load ...
+        typedef std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value> use_optimized;
+
         std::uint64_t size;
         ar >> size; //-V128
         if(size == 0) return;
 
-        detail::load_collection(ar, d, size);
+        detail::load_deque_impl(ar, d, size, use_optimized());
     }
 
     template <typename T, typename Allocator>
     void serialize(output_archive & ar, const std::deque<T, Allocator> & d, unsigned)
     {
-        // normal save ...
+        typedef std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value> use_optimized;
+
         std::uint64_t size = d.size();
         ar << size;
         if(d.empty()) return;
 
-        detail::save_collection(ar, d);
+        detail::save_deque_impl(ar, d, use_optimized());
     }
 }}
 
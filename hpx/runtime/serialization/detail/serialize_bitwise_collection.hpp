@@ -0,0 +1,200 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_SERIALIZATION_DETAIL_SERIALIZE_BITWISE_COLLECTION_HPP
+#define HPX_SERIALIZATION_DETAIL_SERIALIZE_BITWISE_COLLECTION_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/serialization/basic_archive.hpp>
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// The elements of node based containers are not stored contiguously. If the
+// elements are bitwise serializable they are gathered into blocks which are
+// handed to the archive in one go instead of element by element. Blocks are
+// byte streams only, the sender and the receiver may use different block
+// boundaries.
+namespace hpx { namespace serialization { namespace detail
+{
+    // size of the blocks used to gather elements (bytes)
+    constexpr std::size_t bitwise_block_size = 4096;
+
+    // elements are gathered only if they are bitwise serializable and at
+    // least one of them fits into a block
+    template <typename T>
+    struct use_bitwise_blocks
+      : std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value && sizeof(T) <= bitwise_block_size>
+    {};
+
+    template <typename Key, typename Value>
+    struct use_bitwise_pairs
+      : std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<Key>::type
+            >::value &&
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<Value>::type
+            >::value && sizeof(Key) + sizeof(Value) <= bitwise_block_size>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Save 'count' elements of type T, 'proj' returns a reference to the T
+    // to save for a given element of the sequence.
+    template <typename T, typename Iterator, typename Projection>
+    void save_bitwise_elements(output_archive& ar, Iterator it,
+        std::size_t count, Projection && proj)
+    {
+        static_assert(sizeof(T) <= bitwise_block_size,
+            "the element size must not exceed the block size");
+
+        std::size_t const block_elements = bitwise_block_size / sizeof(T);
+
+        char buffer[bitwise_block_size];
+        while (count != 0)
+        {
+            std::size_t n = (std::min)(count, block_elements);
+            for (std::size_t i = 0; i != n; ++i, ++it)
+            {
+                std::memcpy(buffer + i * sizeof(T),
+                    std::addressof(proj(*it)), sizeof(T));
+            }
+            save_binary(ar, buffer, n * sizeof(T));
+            count -= n;
+        }
+    }
+
+    // Load 'count' elements of type T, every element is handed to 'f'.
+    template <typename T, typename F>
+    void load_bitwise_elements(input_archive& ar, std::size_t count, F && f)
+    {
+        static_assert(sizeof(T) <= bitwise_block_size,
+            "the element size must not exceed the block size");
+
+        std::size_t const block_elements = bitwise_block_size / sizeof(T);
+
+        char buffer[bitwise_block_size];
+        while (count != 0)
+        {
+            std::size_t n = (std::min)(count, block_elements);
+            load_binary(ar, buffer, n * sizeof(T));
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                T t;
+                std::memcpy(static_cast<void*>(std::addressof(t)),
+                    buffer + i * sizeof(T), sizeof(T));
+                f(std::move(t));
+            }
+            count -= n;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Save the keys and values of a map like container as separate arrays
+    // (per block), which avoids transmitting the padding of the pairs.
+    template <typename Key, typename Value, typename Iterator>
+    void save_bitwise_pairs(output_archive& ar, Iterator it, std::size_t count)
+    {
+        static_assert(sizeof(Key) + sizeof(Value) <= bitwise_block_size,
+            "the element size must not exceed the block size");
+
+        std::size_t const block_elements =
+            bitwise_block_size / (sizeof(Key) + sizeof(Value));
+
+        char buffer[bitwise_block_size];
+        while (count != 0)
+        {
+            std::size_t n = (std::min)(count, block_elements);
+            char* values = buffer + n * sizeof(Key);
+            for (std::size_t i = 0; i != n; ++i, ++it)
+            {
+                std::memcpy(buffer + i * sizeof(Key),
+                    std::addressof(it->first), sizeof(Key));
+                std::memcpy(values + i * sizeof(Value),
+                    std::addressof(it->second), sizeof(Value));
+            }
+            save_binary(ar, buffer, n * (sizeof(Key) + sizeof(Value)));
+            count -= n;
+        }
+    }
+
+    // Load the keys and values stored by save_bitwise_pairs, every pair is
+    // handed to 'f'.
+    template <typename Key, typename Value, typename F>
+    void load_bitwise_pairs(input_archive& ar, std::size_t count, F && f)
+    {
+        static_assert(sizeof(Key) + sizeof(Value) <= bitwise_block_size,
+            "the element size must not exceed the block size");
+
+        std::size_t const block_elements =
+            bitwise_block_size / (sizeof(Key) + sizeof(Value));
+
+        char buffer[bitwise_block_size];
+        while (count != 0)
+        {
+            std::size_t n = (std::min)(count, block_elements);
+            load_binary(ar, buffer, n * (sizeof(Key) + sizeof(Value)));
+
+            char const* values = buffer + n * sizeof(Key);
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                Key key;
+                Value value;
+                std::memcpy(static_cast<void*>(std::addressof(key)),
+                    buffer + i * sizeof(Key), sizeof(Key));
+                std::memcpy(static_cast<void*>(std::addressof(value)),
+                    values + i * sizeof(Value), sizeof(Value));
+                f(std::move(key), std::move(value));
+            }
+            count -= n;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Save the elements of a container whose storage consists of contiguous
+    // segments (like std::deque), every segment is saved directly.
+    template <typename T, typename Iterator>
+    void save_bitwise_segments(output_archive& ar, Iterator it,
+        std::size_t count)
+    {
+        while (count != 0)
+        {
+            T const* first = std::addressof(*it);
+            std::size_t n = 1;
+            for (++it; n != count && std::addressof(*it) == first + n; ++it)
+                ++n;
+
+            save_binary(ar, first, n * sizeof(T));
+            count -= n;
+        }
+    }
+
+    template <typename T, typename Iterator>
+    void load_bitwise_segments(input_archive& ar, Iterator it,
+        std::size_t count)
+    {
+        while (count != 0)
+        {
+            T* first = std::addressof(*it);
+            std::size_t n = 1;
+            for (++it; n != count && std::addressof(*it) == first + n; ++it)
+                ++n;
+
+            load_binary(ar, first, n * sizeof(T));
+            count -= n;
+        }
+    }
+}}}
+
+#endif
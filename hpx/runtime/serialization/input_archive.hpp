@@ -44,9 +44,11 @@ namespace hpx { namespace serialization
         template <typename Container>
         input_archive(Container & buffer,
                 std::size_t inbound_data_size = 0,
-                const std::vector<serialization_chunk>* chunks = nullptr)
+                const std::vector<serialization_chunk>* chunks = nullptr,
+                const std::vector<std::shared_ptr<char> >* chunk_owners = nullptr)
           : base_type(0U)
-          , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , buffer_(new input_container<Container>(
+                buffer, chunks, inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -126,6 +128,24 @@ namespace hpx { namespace serialization
             return size_;
         }
 
+        // Take shared ownership of the memory the next zero-copy chunk was
+        // received into instead of copying it. Returns an empty pointer if
+        // the chunk can't be adopted, the data has to be loaded as usual in
+        // this case.
+        std::shared_ptr<char> adopt_binary_chunk(
+            std::size_t count, std::size_t alignment)
+        {
+            if (0 == count || disable_data_chunking())
+                return std::shared_ptr<char>();
+
+            std::shared_ptr<char> data =
+                buffer_->adopt_binary_chunk(count, alignment);
+            if (data)
+                size_ += count;
+
+            return data;
+        }
+
         // this function is needed to avoid a MSVC linker error
         std::size_t current_pos() const
         {
@@ -54,21 +54,25 @@ namespace hpx { namespace serialization
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
             chunks_(nullptr), current_chunk_(std::size_t(-1)),
-            current_chunk_size_(0)
+            current_chunk_size_(0), chunk_owners_(nullptr)
         {}
 
         input_container(Container const& cont,
                 std::vector<serialization_chunk> const* chunks,
-                std::size_t inbound_data_size)
+                std::size_t inbound_data_size,
+                std::vector<std::shared_ptr<char> > const* chunk_owners = nullptr)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
             chunks_(nullptr), current_chunk_(std::size_t(-1)),
-            current_chunk_size_(0)
+            current_chunk_size_(0), chunk_owners_(nullptr)
         {
             if (chunks && chunks->size() != 0)
             {
                 chunks_ = chunks;
                 current_chunk_ = 0;
+
+                if (chunk_owners && chunk_owners->size() == chunks->size())
+                    chunk_owners_ = chunk_owners;
             }
         }
 
@@ -155,14 +159,42 @@ namespace hpx { namespace serialization
                     return;
                 }
 
-                // unfortunately we can't implement a zero copy policy on
-                // the receiving end
-                // as the memory was already allocated by the serialization code
+                // the memory was already allocated by the serialization code,
+                // see adopt_binary_chunk for a zero copy alternative
                 std::memcpy(address, get_chunk_data(current_chunk_).pos_, count);
                 ++current_chunk_;
             }
         }
 
+        // Hand out the memory the current chunk was received into if the
+        // parcelport allows for it to outlive the archive. Returns an empty
+        // pointer (without consuming the chunk) otherwise, in which case the
+        // data has to be loaded using load_binary_chunk.
+        std::shared_ptr<char> adopt_binary_chunk(
+            std::size_t count, std::size_t alignment) // override
+        {
+            if (chunk_owners_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_)
+            {
+                return std::shared_ptr<char>();
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+
+            std::shared_ptr<char> const& owner = (*chunk_owners_)[current_chunk_];
+            if (!owner ||
+                get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count ||
+                get_chunk_data(current_chunk_).cpos_ != owner.get() ||
+                reinterpret_cast<std::uintptr_t>(owner.get()) % alignment != 0)
+            {
+                return std::shared_ptr<char>();
+            }
+
+            ++current_chunk_;
+            return owner;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -171,6 +203,9 @@ namespace hpx { namespace serialization
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // owners of the memory of the zero-copy chunks, if available
+        std::vector<std::shared_ptr<char> > const* chunk_owners_;
     };
 }}
 
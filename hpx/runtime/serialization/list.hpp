@@ -7,33 +7,84 @@
 #define HPX_SERIALIZATION_LIST_HPP
 
 #include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/detail/serialize_bitwise_collection.hpp>
 #include <hpx/runtime/serialization/detail/serialize_collection.hpp>
 
 #include <cstdint>
 #include <list>
+#include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization
 {
+    namespace detail
+    {
+        template <typename T, typename Allocator>
+        void load_list_impl(input_archive & ar, std::list<T, Allocator> & ls,
+            std::uint64_t size, std::false_type)
+        {
+            // normal load ...
+            detail::load_collection(ar, ls, size);
+        }
+
+        template <typename T, typename Allocator>
+        void load_list_impl(input_archive & ar, std::list<T, Allocator> & ls,
+            std::uint64_t size, std::true_type)
+        {
+            if (ar.disable_array_optimization())
+            {
+                load_list_impl(ar, ls, size, std::false_type());
+                return;
+            }
+
+            // bitwise load in blocks ...
+            ls.clear();
+            load_bitwise_elements<T>(ar, size,
+                [&ls](T && t) { ls.push_back(std::move(t)); });
+        }
+
+        template <typename T, typename Allocator>
+        void save_list_impl(output_archive & ar,
+            const std::list<T, Allocator> & ls, std::false_type)
+        {
+            // normal save ...
+            detail::save_collection(ar, ls);
+        }
+
+        template <typename T, typename Allocator>
+        void save_list_impl(output_archive & ar,
+            const std::list<T, Allocator> & ls, std::true_type)
+        {
+            if (ar.disable_array_optimization())
+            {
+                save_list_impl(ar, ls, std::false_type());
+                return;
+            }
+
+            // bitwise save in blocks ...
+            save_bitwise_elements<T>(ar, ls.begin(), ls.size(),
+                [](T const& t) -> T const& { return t; });
+        }
+    }
+
     template <typename T, typename Allocator>
     void serialize(input_archive & ar, std::list<T, Allocator> & ls, unsigned)
     {
-        // normal load ...
         std::uint64_t size;
         ar >> size; //-V128
         if(size == 0) return;
 
-        detail::load_collection(ar, ls, size);
+        detail::load_list_impl(ar, ls, size, detail::use_bitwise_blocks<T>());
     }
 
     template <typename T, typename Allocator>
     void serialize(output_archive & ar, const std::list<T, Allocator> & ls, unsigned)
     {
-        // normal save ...
         std::uint64_t size = ls.size();
         ar << size;
         if(ls.empty()) return;
 
-        detail::save_collection(ar, ls);
+        detail::save_list_impl(ar, ls, detail::use_bitwise_blocks<T>());
     }
 }}
 
@@ -7,6 +7,7 @@
 #define HPX_SERIALIZATION_MAP_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/detail/serialize_bitwise_collection.hpp>
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
 #include <hpx/traits/is_bitwise_serializable.hpp>
@@ -96,35 +97,90 @@ namespace hpx
             detail::save_pair_impl(ar, t, optimized());
         }
 
+        namespace detail
+        {
+            template <class Key, class Value, class Comp, class Alloc>
+            void load_map_impl(input_archive& ar,
+                std::map<Key, Value, Comp, Alloc>& t, std::uint64_t size,
+                std::false_type)
+            {
+                typedef typename std::map<Key, Value, Comp, Alloc>::value_type
+                    value_type;
+
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    value_type v;
+                    ar >> v;
+                    t.insert(t.end(), std::move(v));
+                }
+            }
+
+            template <class Key, class Value, class Comp, class Alloc>
+            void load_map_impl(input_archive& ar,
+                std::map<Key, Value, Comp, Alloc>& t, std::uint64_t size,
+                std::true_type)
+            {
+                if (ar.disable_array_optimization())
+                {
+                    load_map_impl(ar, t, size, std::false_type());
+                    return;
+                }
+
+                load_bitwise_pairs<Key, Value>(ar, size,
+                    [&t](Key && key, Value && value)
+                    {
+                        t.emplace_hint(t.end(), std::move(key), std::move(value));
+                    });
+            }
+
+            template <class Key, class Value, class Comp, class Alloc>
+            void save_map_impl(output_archive& ar,
+                const std::map<Key, Value, Comp, Alloc>& t, std::false_type)
+            {
+                typedef typename std::map<Key, Value, Comp, Alloc>::value_type
+                    value_type;
+
+                for (const value_type& val : t)
+                {
+                    ar << val;
+                }
+            }
+
+            template <class Key, class Value, class Comp, class Alloc>
+            void save_map_impl(output_archive& ar,
+                const std::map<Key, Value, Comp, Alloc>& t, std::true_type)
+            {
+                if (ar.disable_array_optimization())
+                {
+                    save_map_impl(ar, t, std::false_type());
+                    return;
+                }
+
+                save_bitwise_pairs<Key, Value>(ar, t.begin(), t.size());
+            }
+        } // namespace detail
+
         template <class Key, class Value, class Comp, class Alloc>
         void serialize(input_archive& ar, std::map<Key, Value, Comp, Alloc>& t, unsigned)
         {
-            typedef typename std::map<Key, Value, Comp, Alloc>::value_type value_type;
+            typedef detail::use_bitwise_pairs<Key, Value> optimized;
 
             std::uint64_t size;
             ar >> size; //-V128
 
             t.clear();
-            for (std::size_t i = 0; i < size; ++i)
-            {
-                value_type v;
-                ar >> v;
-                t.insert(t.end(), std::move(v));
-            }
+            detail::load_map_impl(ar, t, size, optimized());
         }
 
         template <class Key, class Value, class Comp, class Alloc>
         void serialize(output_archive& ar,
             const std::map<Key, Value, Comp, Alloc>& t, unsigned)
         {
-            typedef typename std::map<Key, Value, Comp, Alloc>::value_type value_type;
+            typedef detail::use_bitwise_pairs<Key, Value> optimized;
 
             std::uint64_t size = t.size();
             ar << size;
-            for(const value_type& val : t)
-            {
-                ar << val;
-            }
+            detail::save_map_impl(ar, t, optimized());
         }
     }
 }
@@ -183,6 +183,13 @@ namespace hpx { namespace serialization
             return buffer_->get_num_chunks();
         }
 
+        // Return whether pointers were tracked while serializing into this
+        // archive, their positions are referred to by the serialized data.
+        bool has_tracked_pointers() const
+        {
+            return !pointer_tracker_.empty();
+        }
+
         // this function is needed to avoid a MSVC linker error
         std::size_t current_pos() const
         {
@@ -11,14 +11,18 @@
 #include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/traits/supports_streaming_with_any.hpp>
 #include <hpx/util/bind_back.hpp>
 
+#include <boost/predef/other/endian.h>
 #include <boost/shared_array.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization
 {
@@ -37,6 +41,9 @@ namespace hpx { namespace serialization
             dealloc.deallocate(p, size);
         }
 
+        // keeps the adopted memory of a received chunk alive
+        static void chunk_deleter(T*, std::shared_ptr<char> const&) {}
+
     public:
         enum init_mode
         {
@@ -252,6 +259,16 @@ namespace hpx { namespace serialization
         {
             ar >> size_ >> alloc_; //-V128
 
+            // buffers using the default allocator take over the memory the
+            // parcelport has received the data into, if possible
+            typedef std::integral_constant<bool,
+                    std::is_same<Allocator, std::allocator<T> >::value &&
+                    hpx::traits::is_bitwise_serializable<T>::value
+                > can_adopt;
+
+            if (size_ != 0 && load_adopted(ar, can_adopt()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind_back(&serialize_buffer::deleter<allocator_type>,
                     alloc_, size_));
@@ -262,6 +279,34 @@ namespace hpx { namespace serialization
             }
         }
 
+        template <typename Archive>
+        bool load_adopted(Archive& ar, std::false_type)
+        {
+            return false;
+        }
+
+        template <typename Archive>
+        bool load_adopted(Archive& ar, std::true_type)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            std::shared_ptr<char> chunk =
+                ar.adopt_binary_chunk(size_ * sizeof(T), alignof(T));
+            if (!chunk)
+                return false;
+
+            T* p = reinterpret_cast<T*>(chunk.get());
+            data_.reset(p, util::bind_back(&serialize_buffer::chunk_deleter,
+                std::move(chunk)));
+            return true;
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
@@ -8,10 +8,13 @@
 #define HPX_SERIALIZATION_UNORDERED_MAP_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/detail/serialize_bitwise_collection.hpp>
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/map.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
 
+#include <cstddef>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -19,6 +22,77 @@ namespace hpx
 {
     namespace serialization
     {
+        namespace detail
+        {
+            template <class Key, class Value, class Hash, class KeyEqual,
+                class Alloc>
+            void load_unordered_map_impl(input_archive& ar,
+                std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t,
+                std::size_t size, std::false_type)
+            {
+                typedef std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>
+                    container_type;
+                typedef typename container_type::value_type value_type;
+
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    value_type v;
+                    ar >> v;
+                    t.insert(t.end(), std::move(v));
+                }
+            }
+
+            template <class Key, class Value, class Hash, class KeyEqual,
+                class Alloc>
+            void load_unordered_map_impl(input_archive& ar,
+                std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t,
+                std::size_t size, std::true_type)
+            {
+                if (ar.disable_array_optimization())
+                {
+                    load_unordered_map_impl(ar, t, size, std::false_type());
+                    return;
+                }
+
+                load_bitwise_pairs<Key, Value>(ar, size,
+                    [&t](Key && key, Value && value)
+                    {
+                        t.emplace(std::move(key), std::move(value));
+                    });
+            }
+
+            template <class Key, class Value, class Hash, class KeyEqual,
+                class Alloc>
+            void save_unordered_map_impl(output_archive& ar,
+                const std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t,
+                std::false_type)
+            {
+                typedef std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>
+                    container_type;
+                typedef typename container_type::value_type value_type;
+
+                for (const value_type& val : t)
+                {
+                    ar << val;
+                }
+            }
+
+            template <class Key, class Value, class Hash, class KeyEqual,
+                class Alloc>
+            void save_unordered_map_impl(output_archive& ar,
+                const std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t,
+                std::true_type)
+            {
+                if (ar.disable_array_optimization())
+                {
+                    save_unordered_map_impl(ar, t, std::false_type());
+                    return;
+                }
+
+                save_bitwise_pairs<Key, Value>(ar, t.begin(), t.size());
+            }
+        } // namespace detail
+
         template <class Key, class Value, class Hash, class KeyEqual, class Alloc>
         void serialize(input_archive& ar,
             std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t, unsigned)
@@ -27,34 +101,24 @@ namespace hpx
                 container_type;
 
             typedef typename container_type::size_type size_type;
-            typedef typename container_type::value_type value_type;
+            typedef detail::use_bitwise_pairs<Key, Value> optimized;
 
             size_type size;
             ar >> size; //-V128
 
             t.clear();
-            for (size_type i = 0; i < size; ++i)
-            {
-                value_type v;
-                ar >> v;
-                t.insert(t.end(), std::move(v));
-            }
+            t.reserve(size);
+            detail::load_unordered_map_impl(ar, t, size, optimized());
         }
 
         template <class Key, class Value, class Hash, class KeyEqual, class Alloc>
         void serialize(output_archive& ar,
             const std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>& t, unsigned)
         {
-            typedef std::unordered_map<Key, Value, Hash, KeyEqual, Alloc>
-                container_type;
-
-            typedef typename container_type::value_type value_type;
+            typedef detail::use_bitwise_pairs<Key, Value> optimized;
 
             ar << t.size(); //-V128
-            for(const value_type& val : t)
-            {
-                ar << val;
-            }
+            detail::save_unordered_map_impl(ar, t, optimized());
         }
     }
 }
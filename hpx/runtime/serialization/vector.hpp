@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/brace_initializable.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/detail/serialize_collection.hpp>
 #include <hpx/traits/is_bitwise_serializable.hpp>
@@ -85,6 +86,24 @@ namespace hpx { namespace serialization
             >::value> use_optimized;
 
         v.clear();
+
+#if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) && defined (HPX_HAVE_CXX17_IF_CONSTEXPR)
+        // vectors of structs with a bitwise layout are loaded in one go
+        if constexpr (detail::is_bitwise_struct<T>::value)
+        {
+            if (!ar.disable_array_optimization())
+            {
+                std::uint64_t size;
+                ar >> size; //-V128
+                if (size == 0) return;
+
+                v.resize(size);
+                detail::load_bitwise_structs(ar, v.data(), v.size());
+                return;
+            }
+        }
+#endif
+
         detail::load_impl(ar, v, use_optimized());
     }
 
@@ -143,6 +162,19 @@ namespace hpx { namespace serialization
         std::uint64_t size = v.size();
         ar << size;
         if(v.empty()) return;
+
+#if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) && defined (HPX_HAVE_CXX17_IF_CONSTEXPR)
+        // vectors of structs with a bitwise layout are saved in one go
+        if constexpr (detail::is_bitwise_struct<T>::value)
+        {
+            if (!ar.disable_array_optimization())
+            {
+                detail::save_bitwise_structs(ar, v.data(), v.size());
+                return;
+            }
+        }
+#endif
+
         detail::save_impl(ar, v, use_optimized());
     }
 }}
@@ -121,7 +121,10 @@ namespace hpx { namespace threads { namespace coroutines
 
             impl_.bind_args(&arg);
 
-            impl_.invoke();
+            if (impl_.is_stackless())
+                impl_.invoke_stackless();
+            else
+                impl_.invoke();
 
             return impl_.result();
         }
@@ -131,6 +134,11 @@ namespace hpx { namespace threads { namespace coroutines
             return impl_.is_ready();
         }
 
+        bool is_stackless() const
+        {
+            return impl_.is_stackless();
+        }
+
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
@@ -90,6 +90,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
     /////////////////////////////////////////////////////////////////////////////
     std::ptrdiff_t const default_stack_size = -1;
 
+    // Coroutines created with this stack size never get a stack of their own,
+    // they run to completion on the stack of the thread invoking them (this
+    // is the size runtime_configuration reports for thread_stacksize_nostack).
+    std::ptrdiff_t const nostack_stack_size =
+        (std::numeric_limits<std::ptrdiff_t>::max)();
+
 #if defined(HPX_HAVE_APEX)
     apex_task_wrapper rebind_base_apex(thread_id_type id);
 #endif
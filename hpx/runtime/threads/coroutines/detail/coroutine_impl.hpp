@@ -45,6 +45,7 @@
 #include <hpx/util/unique_function.hpp>
 
 #include <cstddef>
+#include <limits>
 #include <utility>
 
 namespace hpx { namespace threads { namespace coroutines { namespace detail
@@ -73,6 +74,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
           , m_result(unknown, invalid_thread_id)
           , m_arg(nullptr)
           , m_fun(std::move(f))
+          , m_stackless(stack_size == nostack_stack_size)
         {}
 
 #if defined(HPX_DEBUG)
@@ -81,6 +83,20 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()() noexcept;
 
+        // Stackless coroutines execute their function directly on the stack
+        // of the invoking thread and have to run to completion.
+        bool is_stackless() const
+        {
+            return m_stackless;
+        }
+
+        HPX_EXPORT void invoke_stackless();
+
+        // Called instead of yield() from inside a stackless coroutine. A
+        // request to suspend throws invalid_status, the worker OS-thread
+        // which runs the coroutine is never blocked.
+        HPX_EXPORT arg_type yield_stackless(result_type arg);
+
     public:
         void bind_result(result_type res)
         {
@@ -109,16 +125,28 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         }
 #endif
 
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        std::ptrdiff_t get_available_stack_space()
+        {
+            // stackless coroutines use the stack of the invoking OS-thread
+            if (m_stackless)
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
+            return this->super_type::get_available_stack_space();
+        }
+#endif
+
         void reset()
         {
-            this->reset_stack();
+            if (!m_stackless)
+                this->reset_stack();
             m_fun.reset(); // just reset the bound function
             this->super_type::reset();
         }
 
         void rebind(functor_type && f, thread_id_type id)
         {
-            this->rebind_stack();     // count how often a coroutines object was reused
+            if (!m_stackless)
+                this->rebind_stack(); // count how often a coroutines object was reused
             m_fun = std::move(f);
             this->super_type::rebind_base(id);
         }
@@ -129,6 +157,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         arg_type* m_arg;
 
         functor_type m_fun;
+        bool m_stackless;
     };
 }}}}
 
@@ -94,6 +94,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         {
             HPX_ASSERT(m_pimpl);
 
+            if (HPX_UNLIKELY(m_pimpl->is_stackless()))
+                return m_pimpl->yield_stackless(std::move(arg));
+
             this->m_pimpl->bind_result(arg);
 
             {
@@ -138,6 +141,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             return m_pimpl->get_thread_id();
         }
 
+        bool is_stackless() const
+        {
+            HPX_ASSERT(m_pimpl);
+            return m_pimpl->is_stackless();
+        }
+
         std::size_t get_thread_phase() const
         {
 #if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
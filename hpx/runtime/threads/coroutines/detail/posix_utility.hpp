@@ -31,6 +31,7 @@
 #define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_POSIX_UTILITY_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 
 // include unist.d conditionally to check for POSIX version. Not all OSs have the
@@ -78,7 +79,8 @@ namespace posix
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
  && _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    // Map a new stack, the memory is committed lazily on first touch.
+    inline void* map_stack(std::size_t size)
     {
         void* real_stack = ::mmap(nullptr,
             size + EXEC_PAGESIZE,
@@ -125,6 +127,40 @@ namespace posix
 #endif
     }
 
+    inline void unmap_stack(void* stack, std::size_t size)
+    {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+        if (use_guard_pages) {
+            void** real_stack =
+                static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
+            ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
+        } else {
+            ::munmap(stack, size);
+        }
+#else
+        ::munmap(stack, size);
+#endif
+    }
+
+    inline void* alloc_stack(std::size_t size)
+    {
+        if (use_stack_pool)
+            return allocate_pooled_stack(size);
+        return map_stack(size);
+    }
+
+    // Give the pages in the given range back to the operating system. The
+    // range stays mapped, MADV_FREE lets the kernel reclaim the pages lazily
+    // which is cheaper than MADV_DONTNEED if the stack is reused soon.
+    inline void release_stack_pages(void* addr, std::size_t len)
+    {
+#if defined(MADV_FREE)
+        if (::madvise(addr, len, MADV_FREE) == 0)
+            return;
+#endif
+        ::madvise(addr, len, MADV_DONTNEED);
+    }
+
     inline void watermark_stack(void* stack, std::size_t size)
     {
         HPX_ASSERT(size > EXEC_PAGESIZE);
@@ -146,7 +182,7 @@ namespace posix
         {
             // We never free up the first page, as it's initialized only when the
             // stack is created.
-            ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+            release_stack_pages(stack, size - EXEC_PAGESIZE);
             return true;
         }
 
@@ -155,17 +191,10 @@ namespace posix
 
     inline void free_stack(void* stack, std::size_t size)
     {
-#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
-        if (use_guard_pages) {
-            void** real_stack =
-                static_cast<void**>(stack) - (EXEC_PAGESIZE / sizeof(void*));
-            ::munmap(static_cast<void*>(real_stack), size + EXEC_PAGESIZE);
-        } else {
-            ::munmap(stack, size);
-        }
-#else
-        ::munmap(stack, size);
-#endif
+        if (use_stack_pool)
+            deallocate_pooled_stack(stack, size);
+        else
+            unmap_stack(stack, size);
     }
 
 #else  // non-mmap()
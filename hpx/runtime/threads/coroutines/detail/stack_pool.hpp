@@ -0,0 +1,58 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The stack pool keeps the stacks of destroyed coroutines for later reuse. It
+// is shared by all thread queues of the process and holds a separate set of
+// stacks for every NUMA node, stacks are returned to the set of the NUMA node
+// the releasing thread runs on and handed out to threads running on the same
+// NUMA node. Stacks are mapped lazily (memory is committed on first touch
+// only) and protected by a guard page (if enabled). Whenever a stack which
+// was used beyond its first page is returned to the pool, all of its pages
+// except the first one are handed back to the operating system (MADV_FREE).
+// Stacks exceeding the configured pool size are unmapped.
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+    namespace posix
+    {
+        // controls whether coroutine stacks are allocated from the stack
+        // pool (hpx.stacks.use_pool)
+        HPX_EXPORT extern bool use_stack_pool;
+
+        // the maximal number of idle stacks kept per stack size and NUMA
+        // node (hpx.stacks.pool_size)
+        HPX_EXPORT extern std::size_t stack_pool_size;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+        HPX_EXPORT void* allocate_pooled_stack(std::size_t size);
+        HPX_EXPORT void deallocate_pooled_stack(void* stack, std::size_t size);
+#endif
+
+        // The overall address space reserved for coroutine stacks (including
+        // guard pages and stacks held by the pool).
+        HPX_EXPORT std::int64_t get_stack_bytes_reserved(bool reset);
+
+        // An upper bound for the memory committed for coroutine stacks:
+        // stacks in use are accounted for with their full size, idle stacks
+        // held by the pool with the pages not given back to the system.
+        HPX_EXPORT std::int64_t get_stack_bytes_resident(bool reset);
+    }
+}}}}
+
+#endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP*/
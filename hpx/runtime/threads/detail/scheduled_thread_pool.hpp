@@ -240,6 +240,13 @@ namespace hpx { namespace threads { namespace detail
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_to_pending_level(
+            policies::steal_level level, std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_to_pending_level(
+                level, num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool reset) override
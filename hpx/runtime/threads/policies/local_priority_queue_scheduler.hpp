@@ -11,6 +11,7 @@
 #include <hpx/compat/mutex.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
 #include <hpx/runtime/threads/policies/thread_queue.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/runtime/threads/topology.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -134,6 +136,12 @@ namespace hpx { namespace threads { namespace policies
             high_priority_queues_(num_queues_),
             victim_threads_(num_queues_)
         {
+            for (std::size_t i = 0; i != steal_level_count; ++i)
+            {
+                min_tasks_to_steal_pending_[i] =
+                    detail::get_min_tasks_to_steal_pending(steal_level(i));
+            }
+
             if (!deferred_initialization)
             {
                 HPX_ASSERT(num_queues_ != 0);
@@ -445,6 +453,36 @@ namespace hpx { namespace threads { namespace policies
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_stolen_to_pending_level(steal_level level,
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_stolen_threads = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    num_stolen_threads += high_priority_queues_[i].data_->
+                        get_num_stolen_to_pending_level(level, reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    num_stolen_threads += queues_[i].data_->
+                        get_num_stolen_to_pending_level(level, reset);
+                }
+                return num_stolen_threads;
+            }
+
+            num_stolen_threads += queues_[num_thread].data_->
+                get_num_stolen_to_pending_level(level, reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                num_stolen_threads += high_priority_queues_[num_thread].data_->
+                    get_num_stolen_to_pending_level(level, reset);
+            }
+            return num_stolen_threads;
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -608,8 +646,11 @@ namespace hpx { namespace threads { namespace policies
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
+                // victims are ordered by increasing distance
+                for (victim_thread const& victim :
+                    victim_threads_[num_thread].data_)
                 {
+                    std::size_t idx = victim.num_thread_;
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
@@ -621,14 +662,32 @@ namespace hpx { namespace threads { namespace policies
                             q->increment_num_stolen_from_pending();
                             this_high_priority_queue->
                                 increment_num_stolen_to_pending();
+                            this_high_priority_queue->
+                                increment_num_stolen_to_pending_level(
+                                    victim.level_);
                             return true;
                         }
                     }
 
-                    if (queues_[idx].data_->get_next_thread(thrd, running))
+                    // don't steal from far away victims which have only
+                    // little work left
+                    thread_queue_type* q = queues_[idx].data_;
+                    int min_tasks = min_tasks_to_steal_pending_[victim.level_];
+                    if (min_tasks != 0 &&
+                        q->get_pending_queue_length() < min_tasks)
+                    {
+                        continue;
+                    }
+
+                    // queue backends may hand over more than one thread
+                    std::size_t stolen =
+                        q->steal_next_thread(thrd, this_queue, running);
+                    if (stolen != 0)
                     {
-                        queues_[idx].data_->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
+                        q->increment_num_stolen_from_pending(stolen);
+                        this_queue->increment_num_stolen_to_pending(stolen);
+                        this_queue->increment_num_stolen_to_pending_level(
+                            victim.level_, stolen);
                         return true;
                     }
                 }
@@ -1048,8 +1107,10 @@ namespace hpx { namespace threads { namespace policies
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
+                for (victim_thread const& victim :
+                    victim_threads_[num_thread].data_)
                 {
+                    std::size_t idx = victim.num_thread_;
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
@@ -1150,24 +1211,32 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num_threads = num_queues_;
             auto const& topo = rp_.get_topology();
 
-            // get NUMA domain masks of all queues...
+            // get NUMA domain, cache and core masks of all queues...
             std::vector<mask_type> numa_masks(num_threads);
+            std::vector<mask_type> cache_masks(num_threads);
             std::vector<mask_type> core_masks(num_threads);
+            std::vector<std::size_t> numa_nodes(num_threads);
             for (std::size_t i = 0; i != num_threads; ++i)
             {
                 std::size_t num_pu = rp_.get_affinity_data().get_pu_num(i);
                 numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
+                cache_masks[i] = topo.get_cache_affinity_mask(num_pu);
                 core_masks[i] = topo.get_core_affinity_mask(num_pu);
+                numa_nodes[i] = topo.get_numa_node_number(num_pu);
             }
 
             // iterate over the number of threads again to determine where to
             // steal from
             std::ptrdiff_t radius = std::lround(num_threads / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
+            std::vector<victim_thread>& victims =
+                victim_threads_[num_thread].data_;
+            victims.clear();
+            victims.reserve(num_threads);
 
             std::size_t num_pu = rp_.get_affinity_data().get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
+            mask_cref_type cache_mask = cache_masks[num_thread];
             mask_cref_type core_mask = core_masks[num_thread];
 
             // we allow the thread on the boundary of the NUMA domain to steal
@@ -1180,7 +1249,8 @@ namespace hpx { namespace threads { namespace policies
             else
                 first_mask = pu_mask;
 
-            auto iterate = [&](hpx::util::function_nonser<bool(std::size_t)> f)
+            auto iterate = [&](steal_level level,
+                hpx::util::function_nonser<bool(std::size_t)> f)
             {
                 // check our neighbors in a radial fashion (left and right
                 // alternating, increasing distance each iteration)
@@ -1195,14 +1265,14 @@ namespace hpx { namespace threads { namespace policies
 
                     if (f(std::size_t(left)))
                     {
-                        victim_threads_[num_thread].data_.push_back(
-                            static_cast<std::size_t>(left));
+                        victims.push_back(victim_thread(
+                            static_cast<std::size_t>(left), level));
                     }
 
                     std::size_t right = (num_thread + i) % num_threads;
                     if (f(right))
                     {
-                        victim_threads_[num_thread].data_.push_back(right);
+                        victims.push_back(victim_thread(right, level));
                     }
                 }
                 if ((num_threads % 2) == 0)
@@ -1210,25 +1280,37 @@ namespace hpx { namespace threads { namespace policies
                     std::size_t right = (num_thread + i) % num_threads;
                     if (f(right))
                     {
-                        victim_threads_[num_thread].data_.push_back(right);
+                        victims.push_back(victim_thread(right, level));
                     }
                 }
             };
 
             // check for threads which share the same core...
-            iterate(
+            iterate(steal_level_core,
                 [&](std::size_t other_num_thread)
                 {
                     return any(core_mask & core_masks[other_num_thread]);
                 }
             );
 
+            // check for threads which share the last level cache...
+            iterate(steal_level_cache,
+                [&](std::size_t other_num_thread)
+                {
+                    return
+                        !any(core_mask & core_masks[other_num_thread])
+                        && any(cache_mask & cache_masks[other_num_thread])
+                        && any(numa_mask & numa_masks[other_num_thread]);
+                }
+            );
+
             // check for threads which share the same NUMA domain...
-            iterate(
+            iterate(steal_level_numa,
                 [&](std::size_t other_num_thread)
                 {
                     return
                         !any(core_mask & core_masks[other_num_thread])
+                        && !any(cache_mask & cache_masks[other_num_thread])
                         && any(numa_mask & numa_masks[other_num_thread]);
                 }
             );
@@ -1236,12 +1318,24 @@ namespace hpx { namespace threads { namespace policies
             // check for the rest and if we are NUMA aware
             if (numa_sensitive_ != 2 && any(first_mask & pu_mask))
             {
-                iterate(
+                std::size_t num_local = victims.size();
+                iterate(steal_level_remote,
                     [&](std::size_t other_num_thread)
                     {
                         return !any(numa_mask & numa_masks[other_num_thread]);
                     }
                 );
+
+                // remote NUMA domains are visited closest first
+                std::size_t numa_node = numa_nodes[num_thread];
+                std::stable_sort(victims.begin() + num_local, victims.end(),
+                    [&](victim_thread const& lhs, victim_thread const& rhs)
+                    {
+                        return topo.get_numa_node_distance(
+                                numa_node, numa_nodes[lhs.num_thread_]) <
+                            topo.get_numa_node_distance(
+                                numa_node, numa_nodes[rhs.num_thread_]);
+                    });
             }
         }
 
@@ -1290,8 +1384,22 @@ namespace hpx { namespace threads { namespace policies
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
+
+        // the worker threads to steal from, ordered by increasing distance
+        struct victim_thread
+        {
+            victim_thread(std::size_t num_thread, steal_level level)
+              : num_thread_(num_thread), level_(level)
+            {}
+
+            std::size_t num_thread_;
+            steal_level level_;
+        };
+
+        std::vector<util::cache_line_data<std::vector<victim_thread>>>
             victim_threads_;
+
+        int min_tasks_to_steal_pending_[steal_level_count];
     };
 }}}
 
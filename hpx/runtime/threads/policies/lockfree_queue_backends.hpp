@@ -10,8 +10,10 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
 #include <hpx/util/lockfree/deque.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -20,6 +22,7 @@ namespace hpx { namespace threads { namespace policies
 
 struct lockfree_fifo;
 struct lockfree_lifo;
+struct lockfree_chase_lev;
 
 // FIFO
 template <typename T>
@@ -113,6 +116,144 @@ struct lockfree_lifo
     };
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// Owner LIFO + stealing FIFO at opposite end, based on the Chase-Lev
+// work-stealing deque. Only the worker thread owning the queue (see
+// set_owner()) operates on the bottom end of the deque, all other threads
+// steal from its top end. Values pushed by other threads (or to the other
+// end) are placed into a separate shared FIFO, which is drained once the
+// deque runs empty.
+namespace detail
+{
+    // Identifies the calling OS thread, the address of a thread local
+    // variable is unique for all concurrently running threads.
+    inline void const* queue_owner_token()
+    {
+        static HPX_NATIVE_TLS char token = 0;
+        return &token;
+    }
+}
+
+template <typename T>
+struct lockfree_chase_lev_backend
+{
+    typedef boost::lockfree::chase_lev_deque<T> container_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    // the maximal number of items a single steal operation may take
+    enum { max_steal_count = 64 };
+
+    lockfree_chase_lev_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : queue_(std::size_t(initial_size))
+      , shared_queue_(std::size_t(initial_size))
+      , owner_(nullptr)
+    {}
+
+    // Make the calling thread the owner of this queue.
+    void set_owner()
+    {
+        owner_.store(detail::queue_owner_token(), std::memory_order_release);
+    }
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end && is_owner())
+            return queue_.push(val);
+        return shared_queue_.push_left(val);
+    }
+
+    bool pop(reference val, bool steal = true)
+    {
+        if (is_owner())
+        {
+            if (queue_.pop(val))
+                return true;
+        }
+        else if (queue_.steal(val))
+        {
+            return true;
+        }
+        return shared_queue_.pop_right(val);
+    }
+
+    // Steal up to half of the items at once, the first item is returned in
+    // val, all other items are pushed onto dest (which has to be owned by the
+    // calling thread). Returns the number of stolen items.
+    std::size_t steal_half(reference val, lockfree_chase_lev_backend& dest)
+    {
+        std::size_t stolen = queue_.steal_half(val,
+            [&dest](const_reference item)
+            {
+                dest.push(item);
+            },
+            max_steal_count);
+
+        if (stolen == 0 && shared_queue_.pop_right(val))
+            stolen = 1;
+
+        return stolen;
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && shared_queue_.empty();
+    }
+
+  private:
+    bool is_owner() const
+    {
+        return owner_.load(std::memory_order_relaxed) ==
+            detail::queue_owner_token();
+    }
+
+    container_type queue_;
+    boost::lockfree::deque<T> shared_queue_;
+    std::atomic<void const*> owner_;
+};
+
+struct lockfree_chase_lev
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_backend<T> type;
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Queue backends may support being owned by a particular worker thread and
+// stealing several items at once.
+template <typename Backend>
+void set_queue_backend_owner(Backend&)
+{
+}
+
+template <typename T>
+void set_queue_backend_owner(lockfree_chase_lev_backend<T>& queue)
+{
+    queue.set_owner();
+}
+
+template <typename Backend>
+std::size_t steal_from_queue_backend(Backend& src, Backend& /*dest*/,
+    typename Backend::reference val)
+{
+    return src.pop(val, true) ? 1 : 0;
+}
+
+template <typename T>
+std::size_t steal_from_queue_backend(lockfree_chase_lev_backend<T>& src,
+    lockfree_chase_lev_backend<T>& dest, T& val)
+{
+    return src.steal_half(val, dest);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // FIFO + stealing at opposite end.
 #if defined(HPX_HAVE_ABP_SCHEDULER)
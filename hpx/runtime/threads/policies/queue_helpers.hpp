@@ -73,13 +73,25 @@ namespace hpx { namespace threads { namespace policies
 
         // ----------------------------------------------------------------
         inline bool get_next_thread(std::size_t id, threads::thread_data*& thrd)
+        {
+            bool stolen = false;
+            return get_next_thread(id, thrd, stolen);
+        }
+
+        // same as above, stolen is set to true if the task was taken from
+        // another queue than the requested one
+        inline bool get_next_thread(std::size_t id, threads::thread_data*& thrd,
+            bool& stolen)
         {
             // loop over all queues and take one task,
             // starting with the requested queue
             // then stealing from any other one in the container
             for (std::size_t i=0; i<num_queues; ++i) {
                 std::size_t q = (id + i) % num_queues;
-                if (queues_[q]->get_next_thread(thrd)) return true;
+                if (queues_[q]->get_next_thread(thrd)) {
+                    stolen = (i != 0);
+                    return true;
+                }
             }
             return false;
         }
@@ -108,6 +120,14 @@ namespace hpx { namespace threads { namespace policies
             return len;
         }
 
+        // ----------------------------------------------------------------
+        inline std::size_t get_pending_queue_length() const
+        {
+            std::size_t len = 0;
+            for (auto &q : queues_) len += q->get_pending_queue_length();
+            return len;
+        }
+
         // ----------------------------------------------------------------
         inline std::size_t get_thread_count(thread_state_enum state = unknown) const
         {
@@ -12,6 +12,7 @@
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
 #include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
 #include <hpx/runtime/threads/policies/thread_queue.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/runtime/threads/topology.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -91,6 +93,16 @@ namespace policies {
           , initialized_(false)
         {
             HPX_ASSERT(num_worker_threads != 0);
+
+            for (std::size_t i = 0; i != steal_level_count; ++i)
+            {
+                min_tasks_to_steal_pending_[i] =
+                    detail::get_min_tasks_to_steal_pending(steal_level(i));
+            }
+            for (std::size_t i = 0; i != HPX_HAVE_MAX_NUMA_DOMAIN_COUNT; ++i)
+            {
+                domain_order_[i].fill(i);
+            }
         }
 
         virtual ~shared_priority_queue_scheduler() {}
@@ -414,6 +426,43 @@ namespace policies {
 
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_stolen_to_pending_level(steal_level level,
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_stolen_threads = 0;
+
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t d = 0; d < num_domains_; ++d) {
+                    for (auto &queue : np_queues_[d].queues_) {
+                        num_stolen_threads +=
+                            queue->get_num_stolen_to_pending_level(
+                                level, reset);
+                    }
+
+                    for (auto &queue : hp_queues_[d].queues_) {
+                        num_stolen_threads +=
+                            queue->get_num_stolen_to_pending_level(
+                                level, reset);
+                    }
+                }
+
+                return num_stolen_threads;
+            }
+
+            std::size_t domain_num = d_lookup_[num_thread];
+
+            num_stolen_threads +=
+                np_queues_[domain_num].queues_[np_lookup_[num_thread]]->
+                    get_num_stolen_to_pending_level(level, reset);
+
+            num_stolen_threads +=
+                hp_queues_[domain_num].queues_[hp_lookup_[num_thread]]->
+                    get_num_stolen_to_pending_level(level, reset);
+
+            return num_stolen_threads;
+        }
 #endif
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -682,6 +731,13 @@ namespace policies {
                 create_thread(data, thrd, initial_state, run_now, ec);
         }
 
+        static void count_stolen_to_pending(
+            thread_queue_type* q, steal_level level)
+        {
+            q->increment_num_stolen_to_pending();
+            q->increment_num_stolen_to_pending_level(level);
+        }
+
         /// Return the next thread to be executed, return false if none available
         virtual bool get_next_thread(std::size_t thread_num, bool running,
             threads::thread_data*& thrd, bool /*enable_stealing*/) override
@@ -697,34 +753,67 @@ namespace policies {
             // find the numa domain from the local thread index
             std::size_t domain_num = d_lookup_[thread_num];
 
+            // other domains are visited closest first
+            std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> const&
+                domains = domain_order_[domain_num];
+
             // is there a high priority task, take first from our numa domain
             // and then try to steal from others
             for (std::size_t d=0; d<num_domains_; ++d) {
-                std::size_t dom = (domain_num+d) % num_domains_;
+                std::size_t dom = domains[d];
                 // set the preferred queue for this domain, if applicable
                 std::size_t q_index = q_lookup_[thread_num];
                 // get next task, steal if from another domain
-                result = hp_queues_[dom].get_next_thread(q_index, thrd);
-                if (result) break;
+                bool stolen = false;
+                result = hp_queues_[dom].get_next_thread(q_index, thrd, stolen);
+                if (result) {
+                    if (d != 0 || stolen) {
+                        count_stolen_to_pending(
+                            hp_queues_[domain_num].queues_[
+                                hp_lookup_[thread_num]],
+                            d != 0 ? steal_level_remote : steal_level_numa);
+                    }
+                    break;
+                }
             }
 
             // try a normal priority task
             if (!result) {
+                int min_tasks =
+                    min_tasks_to_steal_pending_[steal_level_remote];
                 for (std::size_t d=0; d<num_domains_; ++d) {
-                    std::size_t dom = (domain_num+d) % num_domains_;
+                    std::size_t dom = domains[d];
+                    // don't steal from other domains which have only little
+                    // work left
+                    if (d != 0 && min_tasks != 0 &&
+                        np_queues_[dom].get_pending_queue_length() <
+                            std::size_t(min_tasks))
+                    {
+                        continue;
+                    }
                     // set the preferred queue for this domain, if applicable
                     std::size_t q_index = q_lookup_[thread_num];
                     // get next task, steal if from another domain
-                    result = np_queues_[dom].get_next_thread(q_index, thrd);
-                    if (result) break;
+                    bool stolen = false;
+                    result =
+                        np_queues_[dom].get_next_thread(q_index, thrd, stolen);
+                    if (result) {
+                        if (d != 0 || stolen) {
+                            count_stolen_to_pending(
+                                np_queues_[domain_num].queues_[
+                                    np_lookup_[thread_num]],
+                                d != 0 ? steal_level_remote : steal_level_numa);
+                        }
+                        break;
+                    }
                 }
             }
 
             // low priority task
             if (!result) {
 #ifdef JB_LP_STEALING
-                for (std::size_t d=domain_num; d<domain_num+num_domains_; ++d) {
-                    std::size_t dom = d % num_domains_;
+                for (std::size_t d=0; d<num_domains_; ++d) {
+                    std::size_t dom = domains[d];
                     // set the preferred queue for this domain, if applicable
                     std::size_t q_index = (dom==domain_num) ?
                         q_lookup_[thread_num] :
@@ -1202,6 +1291,24 @@ namespace policies {
                         q_counts_[i], queues, max_queue_thread_count_);
                 }
 
+                // order the domains to steal from by increasing distance,
+                // domains at the same distance are visited round robin
+                for (std::size_t i = 0; i < num_domains_; ++i)
+                {
+                    auto& domains = domain_order_[i];
+                    for (std::size_t d = 0; d < num_domains_; ++d)
+                    {
+                        domains[d] = (i + d) % num_domains_;
+                    }
+                    std::stable_sort(domains.begin() + 1,
+                        domains.begin() + num_domains_,
+                        [&](std::size_t lhs, std::size_t rhs)
+                        {
+                            return topo.get_numa_node_distance(i, lhs) <
+                                topo.get_numa_node_distance(i, rhs);
+                        });
+                }
+
                 // create worker_id to queue lookups for each queue type
                 for (std::size_t local_id=0; local_id!=num_workers_; ++local_id)
                 {
@@ -1288,6 +1395,15 @@ namespace policies {
         std::array<numa_queues, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> lp_queues_;
         std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> counters_;
 
+        // for each domain the list of all domains ordered by distance
+        std::array<
+            std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT>,
+            HPX_HAVE_MAX_NUMA_DOMAIN_COUNT
+        > domain_order_;
+
+        // don't steal from domains which have less pending threads
+        int min_tasks_to_steal_pending_[steal_level_count];
+
         // lookup domain from local worker index
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> d_lookup_;
 
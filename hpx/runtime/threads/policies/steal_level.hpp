@@ -0,0 +1,41 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADS_POLICIES_STEAL_LEVEL_OCT_18_2026_0331AM)
+#define HPX_THREADS_POLICIES_STEAL_LEVEL_OCT_18_2026_0331AM
+
+#include <cstddef>
+
+namespace hpx { namespace threads { namespace policies
+{
+    /// This enumeration describes how far away (in terms of the hardware
+    /// topology) a worker thread is from the worker thread it steals work
+    /// from. Schedulers try to steal from the closest victims first.
+    enum steal_level
+    {
+        steal_level_core = 0,       ///< The victim runs on the same core
+        steal_level_cache = 1,      ///< The victim shares the last level
+            ///< cache
+        steal_level_numa = 2,       ///< The victim runs in the same NUMA
+            ///< domain
+        steal_level_remote = 3,     ///< The victim runs in a different NUMA
+            ///< domain
+        steal_level_count = 4
+    };
+
+    /// Return the name of the given steal level as used for configuration
+    /// entries and performance counters.
+    inline char const* get_steal_level_name(steal_level level)
+    {
+        static char const* const names[] =
+        {
+            "core", "cache", "numa", "remote"
+        };
+        return std::size_t(level) < std::size_t(steal_level_count) ?
+            names[level] : "unknown";
+    }
+}}}
+
+#endif
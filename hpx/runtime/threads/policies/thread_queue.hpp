@@ -13,6 +13,7 @@
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
@@ -72,6 +73,24 @@ namespace hpx { namespace threads { namespace policies
             return min_tasks_to_steal_pending;
         }
 
+        // don't steal from victims at the given distance if less than this
+        // amount of pending tasks are left
+        inline int get_min_tasks_to_steal_pending(steal_level level)
+        {
+            static int const min_tasks_to_steal_pending[steal_level_count] =
+            {
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.min_tasks_to_steal_core", "0")),
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.min_tasks_to_steal_cache", "0")),
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.min_tasks_to_steal_numa", "0")),
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.min_tasks_to_steal_remote", "0"))
+            };
+            return min_tasks_to_steal_pending[level];
+        }
+
         inline int get_min_tasks_to_steal_staged()
         {
             static int min_tasks_to_steal_staged =
@@ -138,6 +157,13 @@ namespace hpx { namespace threads { namespace policies
     //     bool empty();
     // };
     //
+    // // Optional, see lockfree_queue_backends.hpp:
+    //
+    // void set_queue_backend_owner(queue_backend<T>& q);
+    //
+    // std::size_t steal_from_queue_backend(queue_backend<T>& src,
+    //     queue_backend<T>& dest, reference val);
+    //
     // struct queue_policy
     // {
     //     template <typename T>
@@ -231,6 +257,10 @@ namespace hpx { namespace threads { namespace policies
             {
                 heap = &thread_heap_huge_;
             }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                heap = &thread_heap_nostack_;
+            }
             else {
                 switch(stacksize) {
                 case thread_stacksize_small:
@@ -249,6 +279,10 @@ namespace hpx { namespace threads { namespace policies
                     heap = &thread_heap_huge_;
                     break;
 
+                case thread_stacksize_nostack:
+                    heap = &thread_heap_nostack_;
+                    break;
+
                 default:
                     break;
                 }
@@ -416,6 +450,10 @@ namespace hpx { namespace threads { namespace policies
             {
                 thread_heap_huge_.push_front(thrd);
             }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                thread_heap_nostack_.push_front(thrd);
+            }
             else
             {
                 switch(stacksize) {
@@ -435,6 +473,10 @@ namespace hpx { namespace threads { namespace policies
                     thread_heap_huge_.push_front(thrd);
                     break;
 
+                case thread_stacksize_nostack:
+                    thread_heap_nostack_.push_front(thrd);
+                    break;
+
                 default:
                     HPX_ASSERT(false);
                     break;
@@ -565,6 +607,7 @@ namespace hpx { namespace threads { namespace policies
             thread_heap_medium_(),
             thread_heap_large_(),
             thread_heap_huge_(),
+            thread_heap_nostack_(),
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -581,6 +624,11 @@ namespace hpx { namespace threads { namespace policies
         {
             new_tasks_count_.data_ = 0;
             work_items_count_.data_ = 0;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            for (auto& stolen : stolen_to_pending_level_)
+                stolen.store(0, std::memory_order_relaxed);
+#endif
         }
 
         static void deallocate(threads::thread_data* p)
@@ -603,6 +651,9 @@ namespace hpx { namespace threads { namespace policies
 
             for(auto t: thread_heap_huge_)
                 deallocate(t.get());
+
+            for(auto t: thread_heap_nostack_)
+                deallocate(t.get());
         }
 
         void set_max_count(std::size_t max_count = max_thread_count)
@@ -711,6 +762,22 @@ namespace hpx { namespace threads { namespace policies
             stolen_to_pending_.fetch_add(num, std::memory_order_relaxed);
         }
 
+        // steals are additionally counted depending on the distance of the
+        // queue they were stolen from
+        std::int64_t get_num_stolen_to_pending_level(
+            steal_level level, bool reset)
+        {
+            return util::get_and_reset_value(
+                stolen_to_pending_level_[level], reset);
+        }
+
+        void increment_num_stolen_to_pending_level(
+            steal_level level, std::size_t num = 1)
+        {
+            stolen_to_pending_level_[level].fetch_add(
+                num, std::memory_order_relaxed);
+        }
+
         std::int64_t get_num_stolen_to_staged(bool reset)
         {
             return util::get_and_reset_value(stolen_to_staged_, reset);
@@ -741,6 +808,10 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num = 1)
         {
         }
+        HPX_CXX14_CONSTEXPR void increment_num_stolen_to_pending_level(
+            steal_level level, std::size_t num = 1)
+        {
+        }
         HPX_CXX14_CONSTEXPR void increment_num_stolen_to_staged(
             std::size_t num = 1)
         {
@@ -910,6 +981,54 @@ namespace hpx { namespace threads { namespace policies
             return false;
         }
 
+        /// Steal the next thread to be executed from this queue, return the
+        /// number of stolen threads (zero if none is available). Queue
+        /// backends supporting batched stealing may steal more than one
+        /// thread, all threads except the one returned are moved to the
+        /// queue 'dest' which has to be owned by the calling worker thread.
+        std::size_t steal_next_thread(threads::thread_data*& thrd,
+            thread_queue* dest, bool allow_stealing = true) HPX_HOT
+        {
+            std::int64_t work_items_count =
+                work_items_count_.data_.load(std::memory_order_relaxed);
+
+            if (0 == work_items_count ||
+                (allow_stealing && min_tasks_to_steal_pending > work_items_count))
+            {
+                return 0;
+            }
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            thread_description* tdesc;
+            std::size_t stolen = steal_from_queue_backend(
+                work_items_, dest->work_items_, tdesc);
+            if (0 != stolen)
+            {
+                work_items_count_.data_ -= std::int64_t(stolen);
+                dest->work_items_count_.data_ += std::int64_t(stolen - 1);
+
+                if (maintain_queue_wait_times) {
+                    work_items_wait_ += util::high_resolution_clock::now() -
+                        util::get<1>(*tdesc);
+                    ++work_items_wait_count_;
+                }
+
+                thrd = util::get<0>(*tdesc);
+                delete tdesc;
+            }
+            return stolen;
+#else
+            std::size_t stolen = steal_from_queue_backend(
+                work_items_, dest->work_items_, thrd);
+            if (0 != stolen)
+            {
+                work_items_count_.data_ -= std::int64_t(stolen);
+                dest->work_items_count_.data_ += std::int64_t(stolen - 1);
+            }
+            return stolen;
+#endif
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd, bool other_end = false)
         {
@@ -1140,7 +1259,12 @@ namespace hpx { namespace threads { namespace policies
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            // the queues are owned by the worker thread starting them up
+            set_queue_backend_owner(work_items_);
+            set_queue_backend_owner(new_tasks_);
+        }
         void on_stop_thread(std::size_t num_thread) {}
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
@@ -1172,6 +1296,7 @@ namespace hpx { namespace threads { namespace policies
         thread_heap_type thread_heap_medium_;
         thread_heap_type thread_heap_large_;
         thread_heap_type thread_heap_huge_;
+        thread_heap_type thread_heap_nostack_;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
@@ -1193,6 +1318,8 @@ namespace hpx { namespace threads { namespace policies
         std::atomic<std::int64_t> stolen_to_pending_;
         // count of new_tasks stolen to this queue from other queues
         std::atomic<std::int64_t> stolen_to_staged_;
+        // count of work_items stolen to this queue per distance of the victim
+        std::atomic<std::int64_t> stolen_to_pending_level_[steal_level_count];
 #endif
 
         util::block_profiler<add_new_tag> add_new_logger_;
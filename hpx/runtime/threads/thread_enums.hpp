@@ -134,6 +134,11 @@ namespace hpx { namespace threads
         thread_stacksize_huge = 4,          ///< use very large stack size
 
         thread_stacksize_current = 5,      ///< use size of current thread's stack
+        thread_stacksize_nostack = 6,      ///< run to completion on the stack
+            ///< of the scheduling OS-thread, the thread can't be suspended:
+            ///< it must not block (wait for a future, a contended mutex, a
+            ///< condition variable, sleep, etc.), doing so throws an
+            ///< exception of type invalid_status
 
         thread_stacksize_default = thread_stacksize_small,  ///< use default stack size
         thread_stacksize_minimal = thread_stacksize_small,  ///< use minimally stack size
@@ -21,6 +21,7 @@
 #include <hpx/runtime/threads/policies/affinity_data.hpp>
 #include <hpx/runtime/threads/policies/callback_notifier.hpp>
 #include <hpx/runtime/threads/policies/scheduler_mode.hpp>
+#include <hpx/runtime/threads/policies/steal_level.hpp>
 #include <hpx/runtime/threads/thread_executor.hpp>
 #include <hpx/runtime/threads/thread_init_data.hpp>
 #include <hpx/runtime/threads/topology.hpp>
@@ -274,6 +275,35 @@ namespace hpx { namespace threads
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+
+        virtual std::int64_t get_num_stolen_to_pending_level(
+            policies::steal_level /*level*/, std::size_t /*thread_num*/,
+            bool /*reset*/) { return 0; }
+
+        std::int64_t get_num_stolen_to_pending_core(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_to_pending_level(
+                policies::steal_level_core, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_to_pending_cache(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_to_pending_level(
+                policies::steal_level_cache, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_to_pending_numa(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_to_pending_level(
+                policies::steal_level_numa, thread_num, reset);
+        }
+        std::int64_t get_num_stolen_to_pending_remote(
+            std::size_t thread_num, bool reset)
+        {
+            return get_num_stolen_to_pending_level(
+                policies::steal_level_remote, thread_num, reset);
+        }
 #endif
 
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
@@ -430,6 +430,10 @@ namespace hpx { namespace threads
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+        std::int64_t get_num_stolen_to_pending_core(bool reset);
+        std::int64_t get_num_stolen_to_pending_cache(bool reset);
+        std::int64_t get_num_stolen_to_pending_numa(bool reset);
+        std::int64_t get_num_stolen_to_pending_remote(bool reset);
 #endif
 
 private:
@@ -175,6 +175,25 @@ namespace hpx { namespace threads
         mask_type get_numa_node_affinity_mask_from_numa_node(
             std::size_t num_node) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit available to the given thread which
+        ///        shares the last level cache with it. This falls back to
+        ///        the socket if no cache information is available.
+        ///
+        /// \param ec         [in,out] this represents the error status on exit,
+        ///                   if this is pre-initialized to \a hpx#throws
+        ///                   the function will throw on error instead.
+        mask_cref_type get_cache_affinity_mask(std::size_t num_thread,
+            error_code& ec = throws) const;
+
+        /// \brief Return the relative distance between the two given NUMA
+        ///        nodes as reported by the system (10 denotes the local
+        ///        node). If the system does not provide distance
+        ///        information this returns 10 for identical nodes and 20
+        ///        otherwise.
+        std::size_t get_numa_node_distance(std::size_t numa_node1,
+            std::size_t numa_node2) const;
+
         /// \brief Return a bit mask where each set bit corresponds to a
         ///        processing unit available to the given thread inside
         ///        the core it is running on.
@@ -363,6 +382,10 @@ namespace hpx { namespace threads
                 get_core_number(num_thread), default_mask);
         }
 
+        mask_type init_cache_affinity_mask(std::size_t num_thread) const;
+
+        void init_numa_node_distances();
+
         void init_num_of_pus();
 
         hwloc_topology_t topo;
@@ -404,7 +427,12 @@ namespace hpx { namespace threads
         std::vector<mask_type> socket_affinity_masks_;
         std::vector<mask_type> numa_node_affinity_masks_;
         std::vector<mask_type> core_affinity_masks_;
+        std::vector<mask_type> cache_affinity_masks_;
         std::vector<mask_type> thread_affinity_masks_;
+
+        // NUMA distance matrix, numa_node_distances_[i][j] is the relative
+        // distance between NUMA nodes i and j
+        std::vector<std::vector<std::size_t> > numa_node_distances_;
     };
 
 #include <hpx/config/warnings_suffix.hpp>
@@ -15,14 +15,27 @@
 #if !defined(CHECKPOINT_HPP_07262017)
 #define CHECKPOINT_HPP_07262017
 
+#include <hpx/async.hpp>
 #include <hpx/dataflow.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/mutex.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_future.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -500,6 +513,418 @@ namespace util {
         (void) sequencer;         // Suppress unused param. warnings
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Checkpoint files
+    //
+    // A checkpoint file stores every object in its own serialization archive,
+    // which allows to restore the objects independently of each other. The
+    // file consists of a fixed size header, the archives (in the order they
+    // were written) and an index holding the offset and size of every
+    // archive:
+    //
+    //      header | archive | archive | ... | index
+    //
+    /// The version of the checkpoint file format written by
+    /// save_checkpoint_file. Files using a different version are rejected
+    /// when being opened.
+    constexpr std::uint32_t checkpoint_file_version = 1;
+
+    namespace detail {
+        constexpr char checkpoint_file_magic[8] = {
+            'H', 'P', 'X', 'C', 'K', 'P', 'T', '\0'};
+
+        // used to detect files written on a machine with different byte order
+        constexpr std::uint32_t checkpoint_file_byte_order = 0x01020304;
+
+        struct checkpoint_file_header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint64_t num_objects;
+            std::uint64_t index_offset;
+        };
+
+        struct checkpoint_file_index_entry
+        {
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        // Serialize a single object into its own archive
+        template <typename T>
+        typename std::enable_if<!hpx::traits::is_future<T>::value>::type
+        wait_checkpoint_object(T const&)
+        {
+        }
+
+        template <typename T>
+        typename std::enable_if<hpx::traits::is_future<T>::value>::type
+        wait_checkpoint_object(T const& f)
+        {
+            // futures have to be ready in order to be serialized
+            f.wait();
+        }
+
+        template <typename T>
+        std::vector<char> serialize_checkpoint_object(T const& t)
+        {
+            wait_checkpoint_object(t);
+
+            std::vector<char> data;
+            hpx::serialization::output_archive ar(data);
+            ar << t;
+            return data;
+        }
+
+        // Writes the archives of the objects to a checkpoint file as soon as
+        // they become available.
+        class checkpoint_file_writer
+        {
+            typedef hpx::lcos::local::mutex mutex_type;
+
+        public:
+            checkpoint_file_writer(
+                std::string const& filename, std::size_t num_objects)
+              : filename_(filename)
+              , file_(filename,
+                    std::ios::binary | std::ios::out | std::ios::trunc)
+              , index_(num_objects)
+              , offset_(sizeof(checkpoint_file_header))
+            {
+                if (!file_)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::checkpoint_file_writer",
+                        "could not create checkpoint file: " + filename_);
+                }
+
+                // reserve space for the header, it is written once all
+                // objects have been stored
+                checkpoint_file_header header = {};
+                write(&header, sizeof(header));
+            }
+
+            void write_object(std::size_t i, std::vector<char> const& data)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                index_[i].offset = offset_;
+                index_[i].size = data.size();
+
+                write(data.data(), data.size());
+                offset_ += data.size();
+            }
+
+            void finalize()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                write(index_.data(),
+                    index_.size() * sizeof(checkpoint_file_index_entry));
+
+                checkpoint_file_header header = {};
+                std::memcpy(header.magic, checkpoint_file_magic,
+                    sizeof(header.magic));
+                header.version = checkpoint_file_version;
+                header.byte_order = checkpoint_file_byte_order;
+                header.num_objects = index_.size();
+                header.index_offset = offset_;
+
+                file_.seekp(0);
+                write(&header, sizeof(header));
+
+                file_.close();
+                if (!file_)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::finalize",
+                        "could not write checkpoint file: " + filename_);
+                }
+            }
+
+        private:
+            void write(void const* data, std::size_t size)
+            {
+                file_.write(static_cast<char const*>(data), size);
+                if (!file_)
+                {
+                    HPX_THROW_EXCEPTION(filesystem_error,
+                        "checkpoint_file_writer::write",
+                        "could not write checkpoint file: " + filename_);
+                }
+            }
+
+            std::string filename_;
+            std::ofstream file_;
+            std::vector<checkpoint_file_index_entry> index_;
+            std::uint64_t offset_;
+            mutex_type mtx_;
+        };
+
+        // Read-only view of the archive of a single object stored in a
+        // checkpoint file, used as the container of an input_archive.
+        class checkpoint_object_view
+        {
+        public:
+            checkpoint_object_view(char const* data, std::size_t size)
+              : data_(data)
+              , size_(size)
+            {
+            }
+
+            char const& operator[](std::size_t i) const
+            {
+                return data_[i];
+            }
+
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+        private:
+            char const* data_;
+            std::size_t size_;
+        };
+    }
+
+    ///////////////////////////////////
+    /// Save_checkpoint_file
+    ///
+    /// \tparam Ts          Containers to be serialized and written to the
+    ///                     checkpoint file.
+    ///
+    /// \param filename     The name of the checkpoint file to create.
+    ///
+    /// \param ts           The containers to store.
+    ///
+    /// Save_checkpoint_file serializes every container into its own archive
+    /// and writes them to a checkpoint file. The containers are serialized
+    /// concurrently, each archive is written to the file as soon as it is
+    /// available. Unlike save_checkpoint the containers are not copied, they
+    /// have to stay valid until the returned future becomes ready. Futures
+    /// are stored once they have become ready.
+    ///
+    /// Every locality may write its own checkpoint file concurrently to the
+    /// others, as long as the file names differ.
+    ///
+    /// \returns Save_checkpoint_file returns a future which becomes ready
+    ///          once the checkpoint file has been written completely.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(
+        std::string const& filename, Ts const&... ts)
+    {
+        std::shared_ptr<detail::checkpoint_file_writer> writer;
+        try
+        {
+            writer = std::make_shared<detail::checkpoint_file_writer>(
+                filename, sizeof...(Ts));
+        }
+        catch (...)
+        {
+            return hpx::make_exceptional_future<void>(
+                std::current_exception());
+        }
+
+        std::vector<hpx::future<void>> objects;
+        objects.reserve(sizeof...(Ts));
+
+        std::size_t i = 0;
+        int const sequencer[] = {0,
+            (objects.push_back(hpx::async([writer, i, &ts]() {
+                writer->write_object(i, detail::serialize_checkpoint_object(ts));
+            })), ++i, 0)...};
+        (void) sequencer;
+
+        return hpx::when_all(objects).then(hpx::launch::sync,
+            [writer](hpx::future<std::vector<hpx::future<void>>> f) {
+                // propagate exceptions thrown while storing the objects
+                for (hpx::future<void>& object : f.get())
+                    object.get();
+
+                writer->finalize();
+            });
+    }
+
+    ///////////////////////////////////
+    /// Checkpoint File Object
+    ///
+    /// Checkpoint_file gives access to a checkpoint file written by
+    /// save_checkpoint_file. The file is mapped into memory instead of being
+    /// read, the objects are de-serialized directly from the mapped file
+    /// whenever they are restored. Objects can be restored in any order and
+    /// independently of each other.
+    class checkpoint_file
+    {
+    public:
+        /// Map the given checkpoint file into memory.
+        ///
+        /// \param filename     The name of the checkpoint file to open.
+        ///
+        /// \throws hpx::exception (filesystem_error) if the file can't be
+        ///         mapped or (invalid_data) if it is not a valid checkpoint
+        ///         file of the supported version.
+        explicit checkpoint_file(std::string const& filename)
+        {
+            try
+            {
+                boost::interprocess::file_mapping file(
+                    filename.c_str(), boost::interprocess::read_only);
+                region_ = boost::interprocess::mapped_region(
+                    file, boost::interprocess::read_only);
+            }
+            catch (boost::interprocess::interprocess_exception const& e)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_file::checkpoint_file",
+                    "could not map checkpoint file: " + filename + " (" +
+                        e.what() + ")");
+            }
+
+            validate(filename);
+        }
+
+        /// Returns the number of objects stored in the checkpoint file.
+        std::size_t size() const
+        {
+            return header().num_objects;
+        }
+
+        /// De-serialize the object with the given index.
+        ///
+        /// \param i     The index of the object, i.e. its position in the
+        ///              argument list of save_checkpoint_file.
+        ///
+        /// \param t     The container to restore.
+        template <typename T>
+        void restore(std::size_t i, T& t) const
+        {
+            if (i >= size())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, "checkpoint_file::restore",
+                    "object index out of bounds");
+            }
+
+            detail::checkpoint_file_index_entry const& entry = index()[i];
+            detail::checkpoint_object_view view(
+                data() + entry.offset, entry.size);
+
+            hpx::serialization::input_archive ar(view, entry.size);
+            ar >> t;
+        }
+
+    private:
+        char const* data() const
+        {
+            return static_cast<char const*>(region_.get_address());
+        }
+
+        detail::checkpoint_file_header const& header() const
+        {
+            return *reinterpret_cast<detail::checkpoint_file_header const*>(
+                data());
+        }
+
+        detail::checkpoint_file_index_entry const* index() const
+        {
+            return reinterpret_cast<
+                detail::checkpoint_file_index_entry const*>(
+                data() + header().index_offset);
+        }
+
+        void validate(std::string const& filename) const
+        {
+            std::size_t const file_size = region_.get_size();
+            if (file_size < sizeof(detail::checkpoint_file_header) ||
+                std::memcmp(header().magic, detail::checkpoint_file_magic,
+                    sizeof(detail::checkpoint_file_magic)) != 0)
+            {
+                HPX_THROW_EXCEPTION(invalid_data,
+                    "checkpoint_file::validate",
+                    "not a checkpoint file: " + filename);
+            }
+
+            detail::checkpoint_file_header const& h = header();
+            if (h.version != checkpoint_file_version)
+            {
+                HPX_THROW_EXCEPTION(invalid_data,
+                    "checkpoint_file::validate",
+                    "unsupported checkpoint file version " +
+                        std::to_string(h.version) + ": " + filename);
+            }
+            if (h.byte_order != detail::checkpoint_file_byte_order)
+            {
+                HPX_THROW_EXCEPTION(invalid_data,
+                    "checkpoint_file::validate",
+                    "checkpoint file was written using a different byte "
+                    "order: " + filename);
+            }
+
+            // compare the number of entries instead of the index size, the
+            // size computed from a corrupted header could overflow
+            if (h.index_offset < sizeof(detail::checkpoint_file_header) ||
+                h.index_offset > file_size ||
+                h.num_objects > (file_size - h.index_offset) /
+                    sizeof(detail::checkpoint_file_index_entry))
+            {
+                HPX_THROW_EXCEPTION(invalid_data,
+                    "checkpoint_file::validate",
+                    "corrupted checkpoint file index: " + filename);
+            }
+
+            for (std::size_t i = 0; i != h.num_objects; ++i)
+            {
+                detail::checkpoint_file_index_entry const& entry = index()[i];
+                if (entry.offset > h.index_offset ||
+                    entry.size > h.index_offset - entry.offset)
+                {
+                    HPX_THROW_EXCEPTION(invalid_data,
+                        "checkpoint_file::validate",
+                        "corrupted checkpoint file index: " + filename);
+                }
+            }
+        }
+
+        boost::interprocess::mapped_region region_;
+    };
+
+    ///////////////////////////////////
+    /// Resurrect - Checkpoint file overload
+    ///
+    /// Restore_checkpoint takes a checkpoint file as a first argument and the
+    /// containers which will be filled from the file (in the same order as
+    /// they were passed to save_checkpoint_file).
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint file.
+    ///
+    /// \param f            The checkpoint file to restore from.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore.
+    ///
+    /// \returns Restore_checkpoint returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint(checkpoint_file const& f, T& t, Ts&... ts)
+    {
+        if (f.size() != sizeof...(Ts) + 1)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "restore_checkpoint",
+                "the number of containers does not match the number of "
+                "objects stored in the checkpoint file");
+        }
+
+        f.restore(0, t);
+        std::size_t i = 1;
+        int const sequencer[] = {0, (f.restore(i++, ts), 0)...};
+        (void) sequencer;
+    }
+
 }    // End Util Namespace
 }    // End HPX Namespace
 
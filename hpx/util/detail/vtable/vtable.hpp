@@ -9,6 +9,7 @@
 #define HPX_UTIL_DETAIL_VTABLE_VTABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/util/thread_local_caching_allocator.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -54,6 +55,11 @@ namespace hpx { namespace util { namespace detail
             return *reinterpret_cast<T const*>(obj);
         }
 
+        // Callables not fitting into the inline storage are placed into
+        // memory blocks taken from the thread local cache (if their
+        // alignment permits), which avoids going through the system
+        // allocator for the continuations created by future::then,
+        // when_all, and dataflow.
         template <typename T>
         static void* allocate(void* storage, std::size_t storage_size)
         {
@@ -61,6 +67,9 @@ namespace hpx { namespace util { namespace detail
                 typename std::aligned_storage<sizeof(T), alignof(T)>::type;
 
             if (sizeof(T) > storage_size) {
+                if (is_thread_local_cacheable<T>::value) {
+                    return thread_local_caching_allocate(sizeof(storage_t));
+                }
                 return new storage_t;
             }
             return storage;
@@ -77,7 +86,11 @@ namespace hpx { namespace util { namespace detail
             }
 
             if (sizeof(T) > storage_size) {
-                delete static_cast<storage_t*>(obj);
+                if (is_thread_local_cacheable<T>::value) {
+                    thread_local_caching_deallocate(obj, sizeof(storage_t));
+                } else {
+                    delete static_cast<storage_t*>(obj);
+                }
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool);
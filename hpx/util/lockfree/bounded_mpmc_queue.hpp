@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithm from "Bounded MPMC queue" by D. Vyukov
+//  Link: http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+//
+//  C++ implementation - Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  The queue is a fixed size ring buffer which can be concurrently accessed by
+//  any number of producers and consumers. Every slot carries a sequence number
+//  telling whether it is ready to be written or to be read for the current
+//  lap around the ring. Push and pop claim a slot by a single CAS on the
+//  corresponding position counter and never block each other; they fail
+//  (instead of waiting) if the queue is full or empty.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_BOUNDED_MPMC_QUEUE_OCT_18_2026_0356AM)
+#define HPX_UTIL_LOCKFREE_BOUNDED_MPMC_QUEUE_OCT_18_2026_0356AM
+
+#include <hpx/config.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace lockfree
+{
+
+template <typename T>
+struct bounded_mpmc_queue
+{
+  private:
+    struct cell
+    {
+        T* get()
+        {
+            return reinterpret_cast<T*>(&storage_);
+        }
+
+        std::atomic<std::size_t> sequence_;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+    };
+
+  public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    // The capacity is rounded up to the next power of two.
+    explicit bounded_mpmc_queue(std::size_t capacity = 1024)
+      : mask_(0)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+
+        mask_ = size - 1;
+        cells_.reset(new cell[size]);
+        for (std::size_t i = 0; i != size; ++i)
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+
+        enqueue_pos_.data_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.data_.store(0, std::memory_order_relaxed);
+    }
+
+    bounded_mpmc_queue(bounded_mpmc_queue const&) = delete;
+    bounded_mpmc_queue& operator=(bounded_mpmc_queue const&) = delete;
+
+    ~bounded_mpmc_queue()
+    {
+        std::size_t pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+        std::size_t end = enqueue_pos_.data_.load(std::memory_order_relaxed);
+        for (/**/; pos != end; ++pos)
+            cells_[pos & mask_].get()->~T();
+    }
+
+    std::size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    // Any thread: push the given value, fails if the queue is full. The value
+    // is moved from only if the push succeeds.
+    template <typename U>
+    bool push(U && val)
+    {
+        cell* c = nullptr;
+        std::size_t pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            c = &cells_[pos & mask_];
+            std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+            std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+            if (diff == 0)
+            {
+                if (enqueue_pos_.data_.compare_exchange_weak(pos, pos + 1,
+                        std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;       // the queue is full
+            }
+            else
+            {
+                pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+            }
+        }
+
+        ::new (c->get()) T(std::forward<U>(val));
+        c->sequence_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Any thread: pop a value, fails if the queue is empty.
+    bool pop(T& val)
+    {
+        return consume_one(
+            [&val](T && item)
+            {
+                val = std::move(item);
+            });
+    }
+
+    // Any thread: pop a value and pass it (as an rvalue) to the given
+    // function, fails if the queue is empty. This does not require T to be
+    // default constructible or assignable.
+    template <typename F>
+    bool consume_one(F && f)
+    {
+        cell* c = nullptr;
+        std::size_t pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            c = &cells_[pos & mask_];
+            std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+            std::ptrdiff_t diff =
+                std::ptrdiff_t(seq) - std::ptrdiff_t(pos + 1);
+            if (diff == 0)
+            {
+                if (dequeue_pos_.data_.compare_exchange_weak(pos, pos + 1,
+                        std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;       // the queue is empty
+            }
+            else
+            {
+                pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* item = c->get();
+        f(std::move(*item));
+        item->~T();
+        c->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    // The result is approximate if the queue is concurrently modified.
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    std::size_t size() const
+    {
+        std::size_t dequeue_pos =
+            dequeue_pos_.data_.load(std::memory_order_relaxed);
+        std::size_t enqueue_pos =
+            enqueue_pos_.data_.load(std::memory_order_relaxed);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+    }
+
+  private:
+    std::size_t mask_;
+    std::unique_ptr<cell[]> cells_;
+
+    // producers and consumers contend on separate cache lines
+    hpx::util::cache_line_data<std::atomic<std::size_t> > enqueue_pos_;
+    hpx::util::cache_line_data<std::atomic<std::size_t> > dequeue_pos_;
+};
+
+}}
+
+#endif
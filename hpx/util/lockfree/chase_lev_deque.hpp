@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithm from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: http://dl.acm.org/citation.cfm?id=1073974
+//
+//  Memory orderings follow "Correct and Efficient Work-Stealing for Weak
+//  Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: http://dl.acm.org/citation.cfm?id=2442524
+//
+//  C++ implementation - Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  The deque has a single owner which pushes and pops at the bottom end (LIFO)
+//  while any number of thieves concurrently steal from the top end (FIFO).
+//  Push and pop are wait-free for the owner unless the underlying ring buffer
+//  has to grow, stealing is lock-free.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_18_2026_0323AM)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_18_2026_0323AM
+
+#include <hpx/config.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace boost { namespace lockfree
+{
+
+template <typename T>
+struct chase_lev_deque
+{
+  private:
+    // circular array of atomic slots, slots are accessed using indices which
+    // are always increasing, the array wraps them around
+    struct array
+    {
+        explicit array(std::int64_t log_size)
+          : log_size_(log_size)
+          , mask_((std::int64_t(1) << log_size) - 1)
+          , items_(new std::atomic<T>[std::size_t(1) << log_size])
+        {}
+
+        std::int64_t size() const
+        {
+            return mask_ + 1;
+        }
+
+        T get(std::int64_t i) const
+        {
+            return items_[i & mask_].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t i, T const& val)
+        {
+            items_[i & mask_].store(val, std::memory_order_relaxed);
+        }
+
+        array* grow(std::int64_t bottom, std::int64_t top) const
+        {
+            array* a = new array(log_size_ + 1);
+            for (std::int64_t i = top; i != bottom; ++i)
+                a->put(i, get(i));
+            return a;
+        }
+
+        std::int64_t const log_size_;
+        std::int64_t const mask_;
+        std::unique_ptr<std::atomic<T>[]> items_;
+    };
+
+  public:
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+    explicit chase_lev_deque(std::size_t initial_size = 128)
+      : array_(nullptr)
+    {
+        std::int64_t log_size = 1;
+        while ((std::size_t(1) << log_size) < initial_size)
+            ++log_size;
+
+        array* a = new array(log_size);
+        arrays_.emplace_back(a);
+        array_.store(a, std::memory_order_relaxed);
+
+        top_.data_.store(0, std::memory_order_relaxed);
+        bottom_.data_.store(0, std::memory_order_relaxed);
+    }
+
+    chase_lev_deque(chase_lev_deque const&) = delete;
+    chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+    // Owner only: push the given value onto the bottom end.
+    bool push(T const& val)
+    {
+        std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.data_.load(std::memory_order_acquire);
+        array* a = array_.load(std::memory_order_relaxed);
+
+        if (b - t > a->size() - 1)
+        {
+            // Thieves may still read from the old array, it is kept alive
+            // until the deque is destroyed.
+            a = a->grow(b, t);
+            arrays_.emplace_back(a);
+            array_.store(a, std::memory_order_release);
+        }
+
+        a->put(b, val);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Owner only: pop a value from the bottom end.
+    bool pop(T& val)
+    {
+        std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+        array* a = array_.load(std::memory_order_relaxed);
+        bottom_.data_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // the deque was empty
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        val = a->get(b);
+        if (t == b)
+        {
+            // last element, race against thieves
+            bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return result;
+        }
+        return true;
+    }
+
+    // Any thread: steal a value from the top end. This fails if the deque is
+    // empty or if another thread won the race for the top element.
+    bool steal(T& val)
+    {
+        std::int64_t t = top_.data_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+        if (t >= b)
+            return false;
+
+        array* a = array_.load(std::memory_order_acquire);
+        T item = a->get(t);
+        if (!top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        val = item;
+        return true;
+    }
+
+    // Any thread: steal up to half of the elements (at most max_count) from
+    // the top end, the first stolen element is returned in val, all others
+    // are passed to f in FIFO order. Every element is taken using a separate
+    // steal operation, the batch ends early if the race for an element is
+    // lost. Returns the number of stolen elements.
+    template <typename F>
+    std::size_t steal_half(T& val, F && f,
+        std::size_t max_count = std::size_t(-1))
+    {
+        if (!steal(val))
+            return 0;
+
+        std::size_t count = (size() + 1) / 2;
+        if (count > max_count - 1)
+            count = max_count - 1;
+
+        std::size_t stolen = 1;
+        T item;
+        while (count-- != 0 && steal(item))
+        {
+            f(item);
+            ++stolen;
+        }
+        return stolen;
+    }
+
+    // Any thread: approximate number of elements
+    std::size_t size() const
+    {
+        std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+        return b > t ? std::size_t(b - t) : 0;
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+  private:
+    // top_ is written by thieves, bottom_ by the owner only
+    hpx::util::cache_line_data<std::atomic<std::int64_t> > top_;
+    hpx::util::cache_line_data<std::atomic<std::int64_t> > bottom_;
+
+    std::atomic<array*> array_;
+    std::vector<std::unique_ptr<array> > arrays_;
+};
+
+}}
+
+#endif // HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_OCT_18_2026_0323AM
@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_THREAD_LOCAL_CACHING_ALLOCATOR_HPP)
+#define HPX_UTIL_THREAD_LOCAL_CACHING_ALLOCATOR_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if !defined(HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE)
+#define HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE 256
+#endif
+
+namespace hpx { namespace util
+{
+    namespace detail
+    {
+        // Allocate and release memory blocks through a cache local to the
+        // calling (OS-) thread. Blocks not larger than
+        // HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE are kept in per-size
+        // free lists and are handed out again without involving the
+        // underlying allocator. Blocks may be released by a thread different
+        // from the one which allocated them. The returned memory is suitably
+        // aligned for any fundamental type.
+        HPX_EXPORT void* thread_local_caching_allocate(std::size_t size);
+        HPX_EXPORT void thread_local_caching_deallocate(
+            void* p, std::size_t size) noexcept;
+
+        template <typename T>
+        struct is_thread_local_cacheable
+          : std::integral_constant<bool,
+                alignof(T) <= alignof(std::max_align_t)>
+        {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The thread_local_caching_allocator is used for the short lived, small
+    // allocations created in large numbers by future::then, when_all and
+    // dataflow (shared states and continuation frames). In steady state those
+    // do not touch the system allocator at all.
+    template <typename T = int>
+    struct thread_local_caching_allocator
+    {
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef thread_local_caching_allocator<U> other;
+        };
+
+        typedef std::true_type is_always_equal;
+        typedef std::true_type propagate_on_container_move_assignment;
+
+        thread_local_caching_allocator() = default;
+
+        template <typename U>
+        explicit thread_local_caching_allocator(
+            thread_local_caching_allocator<U> const&)
+        {
+        }
+
+        pointer address(reference x) const noexcept
+        {
+            return &x;
+        }
+
+        const_pointer address(const_reference x) const noexcept
+        {
+            return &x;
+        }
+
+        pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (!detail::is_thread_local_cacheable<T>::value)
+                return std::allocator<T>().allocate(n);
+
+            return static_cast<pointer>(
+                detail::thread_local_caching_allocate(n * sizeof(T)));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (!detail::is_thread_local_cacheable<T>::value)
+            {
+                std::allocator<T>().deallocate(p, n);
+                return;
+            }
+
+            detail::thread_local_caching_deallocate(p, n * sizeof(T));
+        }
+
+        size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U, typename ... Args>
+        void construct(U* p, Args &&... args)
+        {
+            ::new((void *)p) U(std::forward<Args>(args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+    };
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR bool operator==(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    HPX_CONSTEXPR bool operator!=(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&)
+    {
+        return false;
+    }
+}}
+
+#endif
@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/traits/plugin_config_data.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+
+#include <cstddef>
+#include <limits>
+
+#include <lz4.h>
+#include <lz4hc.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for
+    // this type. This information ends up in the system wide configuration
+    // database under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      level = 0
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "level = ${HPX_LZ4_COMPRESSION_LEVEL:0}\n"
+                   "threshold = ${HPX_LZ4_COMPRESSION_THRESHOLD:4096}\n"
+                   "min_ratio = ${HPX_LZ4_COMPRESSION_MIN_RATIO:1.1}";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace
+    {
+        // The settings are read only once, filters are created for every
+        // message sent.
+        struct lz4_settings
+        {
+            lz4_settings()
+              : level_(util::safe_lexical_cast<int>(get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.level", "0"), 0)),
+                policy_(compression_policy::from_config(
+                    "hpx.plugins.lz4_serialization_filter"))
+            {}
+
+            int level_;
+            compression_policy policy_;
+        };
+
+        lz4_settings const& get_lz4_settings()
+        {
+            static lz4_settings const settings;
+            return settings;
+        }
+    }
+
+    lz4_serialization_filter::lz4_serialization_filter(bool compress,
+            serialization::binary_filter* next_filter)
+      : block_compression_filter(compress,
+            compress ? get_lz4_settings().policy_ : compression_policy()),
+        level_(compress ? get_lz4_settings().level_ : 0)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::max_compressed_length(
+        std::size_t size) const
+    {
+        if (size > std::size_t(LZ4_MAX_INPUT_SIZE))
+            return 0;
+        return std::size_t(LZ4_compressBound(int(size)));
+    }
+
+    // A level of zero (or below) selects the fast compressor, levels above
+    // zero select the corresponding level of the high compression variant.
+    std::size_t lz4_serialization_filter::compress(char const* src,
+        std::size_t src_count, char* dst, std::size_t dst_count)
+    {
+        if (src_count > std::size_t(LZ4_MAX_INPUT_SIZE))
+            return 0;
+
+        int capacity = dst_count > std::size_t((std::numeric_limits<int>::max)()) ?
+            (std::numeric_limits<int>::max)() : int(dst_count);
+
+        int compressed_size = 0;
+        if (level_ > 0)
+        {
+            compressed_size = LZ4_compress_HC(
+                src, dst, int(src_count), capacity, level_);
+        }
+        else
+        {
+            compressed_size = LZ4_compress_fast(
+                src, dst, int(src_count), capacity, 1 - level_);
+        }
+        return compressed_size > 0 ? std::size_t(compressed_size) : 0;
+    }
+
+    std::size_t lz4_serialization_filter::decompress(char const* src,
+        std::size_t src_count, char* dst, std::size_t dst_count)
+    {
+        int capacity = dst_count > std::size_t((std::numeric_limits<int>::max)()) ?
+            (std::numeric_limits<int>::max)() : int(dst_count);
+
+        int size = LZ4_decompress_safe(src, dst, int(src_count), capacity);
+        if (size < 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::decompress",
+                "decompression failure, the archive data is corrupted");
+            return 0;
+        }
+        return std::size_t(size);
+    }
+}}}
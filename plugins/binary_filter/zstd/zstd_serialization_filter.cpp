@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/traits/plugin_config_data.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for
+    // this type. This information ends up in the system wide configuration
+    // database under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      level = 1
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static char const* call()
+        {
+            return "level = ${HPX_ZSTD_COMPRESSION_LEVEL:1}\n"
+                   "threshold = ${HPX_ZSTD_COMPRESSION_THRESHOLD:4096}\n"
+                   "min_ratio = ${HPX_ZSTD_COMPRESSION_MIN_RATIO:1.1}";
+        }
+    };
+}}
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace
+    {
+        // The settings are read only once, filters are created for every
+        // message sent.
+        struct zstd_settings
+        {
+            zstd_settings()
+              : level_(util::safe_lexical_cast<int>(get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level", "1"), 1)),
+                policy_(compression_policy::from_config(
+                    "hpx.plugins.zstd_serialization_filter"))
+            {}
+
+            int level_;
+            compression_policy policy_;
+        };
+
+        zstd_settings const& get_zstd_settings()
+        {
+            static zstd_settings const settings;
+            return settings;
+        }
+
+        // Creating a compression context is expensive, reuse one per OS
+        // thread.
+        struct zstd_cctx_deleter
+        {
+            void operator()(ZSTD_CCtx* ctx) const
+            {
+                ZSTD_freeCCtx(ctx);
+            }
+        };
+
+        ZSTD_CCtx* get_zstd_cctx()
+        {
+            static thread_local std::unique_ptr<ZSTD_CCtx, zstd_cctx_deleter>
+                ctx(ZSTD_createCCtx());
+            return ctx.get();
+        }
+    }
+
+    zstd_serialization_filter::zstd_serialization_filter(bool compress,
+            serialization::binary_filter* next_filter)
+      : block_compression_filter(compress,
+            compress ? get_zstd_settings().policy_ : compression_policy()),
+        level_(compress ? get_zstd_settings().level_ : 1)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::max_compressed_length(
+        std::size_t size) const
+    {
+        return ZSTD_compressBound(size);
+    }
+
+    std::size_t zstd_serialization_filter::compress(char const* src,
+        std::size_t src_count, char* dst, std::size_t dst_count)
+    {
+        ZSTD_CCtx* ctx = get_zstd_cctx();
+
+        std::size_t compressed_size = ctx != nullptr ?
+            ZSTD_compressCCtx(ctx, dst, dst_count, src, src_count, level_) :
+            ZSTD_compress(dst, dst_count, src, src_count, level_);
+
+        return ZSTD_isError(compressed_size) ? 0 : compressed_size;
+    }
+
+    std::size_t zstd_serialization_filter::decompress(char const* src,
+        std::size_t src_count, char* dst, std::size_t dst_count)
+    {
+        std::size_t size = ZSTD_decompress(dst, dst_count, src, src_count);
+        if (ZSTD_isError(size))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::decompress",
+                std::string("decompression failure: ") +
+                    ZSTD_getErrorName(size));
+            return 0;
+        }
+        return size;
+    }
+}}}
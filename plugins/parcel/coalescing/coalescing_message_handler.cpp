@@ -24,6 +24,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -42,6 +43,8 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -50,7 +53,9 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100";
         }
     };
 }}
@@ -86,19 +91,113 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
+
+        // number of parcels after which the adaptive mode re-evaluates the
+        // coalescing parameters
+        HPX_CONSTEXPR_OR_CONST std::size_t adapt_every = 16;
     }
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_coalesced_parcels_ =
+            detail::get_num_messages(max_coalesced_parcels_);
+        if (!adaptive_)
+        {
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+        }
+        else
+        {
+            num_coalesced_parcels_ =
+                (std::min)(num_coalesced_parcels_, max_coalesced_parcels_);
+        }
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        if (!adaptive_)
+            interval_ = detail::get_interval(interval_);
+    }
+
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+        parcels_since_adapt_ = 0;
+        if (!adaptive_)
+        {
+            // fall back to the configured parameters
+            num_coalesced_parcels_ = max_coalesced_parcels_;
+            interval_ = detail::get_interval(interval_);
+        }
+    }
+
+    void coalescing_message_handler::update_latency_budget()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_budget_ = detail::get_latency_budget(latency_budget_);
+    }
+
+    // Track the mean and the mean deviation of the time between parcels
+    // (using the same estimator as TCP uses for round trip times) and derive
+    // the coalescing parameters from those every couple of parcels:
+    //
+    //  - a message holds as many parcels as are expected to arrive within
+    //    the latency budget (but not more than configured),
+    //  - the buffer is flushed at the latest after the time needed to
+    //    collect that many parcels (but not later than the latency budget).
+    //
+    // Coalescing is switched off (the interval is zero) whenever parcels
+    // arrive too rarely for a second parcel to show up within the budget.
+    void coalescing_message_handler::adapt_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        std::int64_t budget = std::int64_t(latency_budget_) * 1000;   // [ns]
+
+        // all gaps longer than the latency budget have the same effect, idle
+        // periods should not dominate the estimate
+        std::int64_t gap = (std::min)(time_since_last_parcel, 2 * budget);
+
+        std::int64_t error = gap - average_gap_;
+        average_gap_ += error / 8;
+        average_gap_deviation_ +=
+            ((error < 0 ? -error : error) - average_gap_deviation_) / 8;
+
+        if (++parcels_since_adapt_ < detail::adapt_every)
+            return;
+        parcels_since_adapt_ = 0;
+
+        std::int64_t average_gap = (std::max)(average_gap_, std::int64_t(1));
+        std::size_t num_parcels = std::size_t(budget / average_gap);
+        num_parcels = (std::max)(
+            (std::min)(num_parcels, max_coalesced_parcels_), std::size_t(1));
+
+        num_coalesced_parcels_ = num_parcels;
+        if (num_parcels == 1)
+        {
+            interval_ = 0;
+            return;
+        }
+
+        // leave room for the variation in the arrival times
+        std::int64_t interval = (std::min)(budget,
+            std::int64_t(num_parcels) * (average_gap + average_gap_deviation_));
+        interval_ = std::size_t((interval + 999) / 1000);            // [us]
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -115,6 +214,12 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        latency_budget_(detail::get_latency_budget(interval_)),
+        max_coalesced_parcels_(num_coalesced_parcels_),
+        average_gap_(std::int64_t(latency_budget_) * 1000),
+        average_gap_deviation_(0),
+        parcels_since_adapt_(0),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -135,7 +240,11 @@ namespace hpx { namespace plugins { namespace parcel
             util::bind_front(&coalescing_message_handler::
                 get_average_time_between_parcels, this),
             util::bind_front(&coalescing_message_handler::
-                get_time_between_parcels_histogram_creator, this));
+                get_time_between_parcels_histogram_creator, this),
+            util::bind_front(&coalescing_message_handler::
+                get_parcels_per_message_limit, this),
+            util::bind_front(&coalescing_message_handler::
+                get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -144,6 +253,13 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_budget",
+            util::bind(
+                &coalescing_message_handler::update_latency_budget, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -162,6 +278,9 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+            adapt_parameters(time_since_last_parcel);
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -355,6 +474,19 @@ namespace hpx { namespace plugins { namespace parcel
         return num_parcels / num_messages;
     }
 
+    std::int64_t
+        coalescing_message_handler::get_parcels_per_message_limit(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(interval_) * 1000;                      // [ns]
+    }
+
     std::int64_t coalescing_message_handler::get_messages_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
@@ -0,0 +1,249 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugins/parcelport/shmem/segment.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/format.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    segment::segment() noexcept
+      : data_(nullptr), size_(0), owner_(false)
+    {}
+
+    segment::~segment()
+    {
+        reset();
+    }
+
+    segment::segment(segment && rhs) noexcept
+      : name_(std::move(rhs.name_))
+      , data_(rhs.data_)
+      , size_(rhs.size_)
+      , owner_(rhs.owner_)
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+        rhs.owner_ = false;
+    }
+
+    segment& segment::operator=(segment && rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+
+            name_ = std::move(rhs.name_);
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            owner_ = rhs.owner_;
+
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+            rhs.owner_ = false;
+        }
+        return *this;
+    }
+
+    void segment::reset() noexcept
+    {
+        if (data_ != nullptr)
+            ::munmap(data_, size_);
+        if (owner_)
+            ::shm_unlink(name_.c_str());
+
+        data_ = nullptr;
+        size_ = 0;
+        owner_ = false;
+    }
+
+    void segment::unlink()
+    {
+        ::shm_unlink(name_.c_str());
+        owner_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    segment segment::create(std::string const& name, std::size_t size,
+        error_code& ec)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd == -1 && errno == EEXIST)
+        {
+            // a process with the same id has not cleaned up after itself
+            ::shm_unlink(name.c_str());
+            fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        }
+
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                hpx::util::format("shm_open failed for {}: {}",
+                    name, std::strerror(errno)));
+            return segment();
+        }
+
+        if (::ftruncate(fd, off_t(size)) == -1)
+        {
+            int err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                hpx::util::format("ftruncate failed for {}: {}",
+                    name, std::strerror(err)));
+            return segment();
+        }
+
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+        ::close(fd);
+
+        if (p == MAP_FAILED)
+        {
+            int err = errno;
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::create",
+                hpx::util::format("mmap failed for {}: {}",
+                    name, std::strerror(err)));
+            return segment();
+        }
+
+        segment s;
+        s.name_ = name;
+        s.data_ = static_cast<char*>(p);
+        s.size_ = size;
+        s.owner_ = true;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return s;
+    }
+
+    segment segment::open(std::string const& name, error_code& ec)
+    {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                hpx::util::format("shm_open failed for {}: {}",
+                    name, std::strerror(errno)));
+            return segment();
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            int err = errno;
+            ::close(fd);
+
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                hpx::util::format("fstat failed for {}: {}",
+                    name, std::strerror(err)));
+            return segment();
+        }
+
+        std::size_t size = std::size_t(st.st_size);
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+        ::close(fd);
+
+        if (p == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, network_error, "shmem::segment::open",
+                hpx::util::format("mmap failed for {}: {}",
+                    name, std::strerror(errno)));
+            return segment();
+        }
+
+        segment s;
+        s.name_ = name;
+        s.data_ = static_cast<char*>(p);
+        s.size_ = size;
+        s.owner_ = false;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return s;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+        std::chrono::microseconds timeout)
+    {
+        struct timespec ts;
+        struct timespec* pts = nullptr;
+        if (timeout.count() != 0)
+        {
+            ts.tv_sec = time_t(timeout.count() / 1000000);
+            ts.tv_nsec = long((timeout.count() % 1000000) * 1000);
+            pts = &ts;
+        }
+
+        // the word is shared between processes, don't use FUTEX_PRIVATE_FLAG
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAIT, expected, pts, nullptr, 0);
+    }
+
+    void futex_wake(std::atomic<std::uint32_t>& word)
+    {
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+            FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t get_host_id()
+    {
+        char hostname[256] = { 0 };
+        ::gethostname(hostname, sizeof(hostname) - 1);
+
+        // distinguish between different boots of hosts with the same name
+        std::string boot_id;
+        std::ifstream f("/proc/sys/kernel/random/boot_id");
+        if (f)
+            std::getline(f, boot_id);
+
+        // FNV-1a
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        for (char c : std::string(hostname) + ":" + boot_id)
+        {
+            hash ^= std::uint8_t(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    std::int32_t get_process_id()
+    {
+        return std::int32_t(::getpid());
+    }
+}}}}
+
+#endif
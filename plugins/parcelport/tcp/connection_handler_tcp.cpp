@@ -21,6 +21,12 @@
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
 #include <hpx/util/runtime_configuration.hpp>
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#endif
 
 #include <boost/io/ios_state.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -33,6 +39,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
@@ -74,6 +81,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 "this parcelport was instantiated to represent an unexpected "
                 "locality type: " + std::string(here_.type()));
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (hpx::util::get_entry_as<int>(ini, "hpx.parcel.tcp.io_uring", 1))
+        {
+            uring_ = io_uring_queue::create(hpx::util::get_entry_as<unsigned>(
+                ini, "hpx.parcel.tcp.io_uring_entries", 256));
+        }
+#endif
     }
 
     connection_handler::~connection_handler()
@@ -122,24 +137,60 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 "tcp::parcelport::run", errors.get_message());
             return false;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring_)
+        {
+            // The scheduler takes over polling the io_uring once the runtime
+            // is up, the parcels exchanged before are handled by an io thread.
+            io_service_pool_.get_io_service(0).post(
+                util::bind(&connection_handler::io_service_work, this,
+                    std::size_t(0)));
+        }
+#endif
         return true;
     }
 
     void connection_handler::do_stop()
     {
+        accepted_connections_set connections;
         {
-            // cancel all pending read operations, close those sockets
             std::lock_guard<lcos::local::spinlock> l(connections_mtx_);
-            for (std::shared_ptr<receiver> const& c : accepted_connections_)
-            {
-                c->shutdown();
-            }
-
-            accepted_connections_.clear();
+            std::swap(connections, accepted_connections_);
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
             write_connections_.clear();
 #endif
         }
+
+        // cancel all pending read operations, close those sockets (the
+        // completion handlers of the reads acquire connections_mtx_)
+        for (std::shared_ptr<receiver> const& c : connections)
+        {
+            c->shutdown();
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring_)
+        {
+            // the reads on the connections closed above still refer to the
+            // receivers, give them a chance to complete
+            util::high_resolution_timer t;
+            std::size_t k = 0;
+            while (uring_->in_flight() != 0 && t.elapsed() < 1.0)
+            {
+                if (uring_->poll())
+                {
+                    k = 0;
+                }
+                else
+                {
+                    util::detail::yield_k(k < 32 ? ++k : k,
+                        "tcp::connection_handler::do_stop");
+                }
+            }
+        }
+#endif
+
         if(acceptor_ != nullptr)
         {
             boost::system::error_code ec;
@@ -226,6 +277,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         s.set_option(boost::asio::ip::tcp::no_delay(true));
         s.set_option(boost::asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        sender_connection->use_io_uring(uring_.get());
+#endif
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<lcos::local::spinlock> lock(connections_mtx_);
@@ -307,6 +362,10 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             s.set_option(boost::asio::ip::tcp::no_delay(true));
             s.set_option(boost::asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            c->use_io_uring(uring_.get());
+#endif
+
             // now accept the incoming connection by starting to read from the
             // socket
             c->async_read(
@@ -344,6 +403,35 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             accepted_connections_.erase(receiver_conn);
         }
     }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    bool connection_handler::background_work(std::size_t num_thread)
+    {
+        return uring_ && uring_->poll();
+    }
+
+    // Poll the io_uring while the runtime is starting up. The io thread is
+    // shared with the acceptor, re-posting this handler lets the asio
+    // handlers in between.
+    void connection_handler::io_service_work(std::size_t k)
+    {
+        if (!hpx::is_starting())
+            return;
+
+        if (uring_->poll())
+        {
+            k = 0;
+        }
+        else
+        {
+            util::detail::yield_k(k < 32 ? ++k : k,
+                "tcp::connection_handler::io_service_work");
+        }
+
+        io_service_pool_.get_io_service(0).post(
+            util::bind(&connection_handler::io_service_work, this, k));
+    }
+#endif
 }}}}
 
 #endif
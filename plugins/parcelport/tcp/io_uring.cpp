@@ -0,0 +1,371 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) && \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/plugins/parcelport/tcp/io_uring.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/logging.hpp>
+
+#include <boost/asio/error.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+// The system call numbers are the same on all architectures supporting
+// io_uring, older C libraries don't know about them yet.
+#if !defined(__NR_io_uring_setup)
+#define __NR_io_uring_setup 425
+#endif
+#if !defined(__NR_io_uring_enter)
+#define __NR_io_uring_enter 426
+#endif
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    namespace
+    {
+        int io_uring_setup(unsigned entries, io_uring_params* p)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        unsigned load_acquire(unsigned const* p)
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void store_release(unsigned* p, unsigned value)
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        // maximal number of completions dispatched by one call to poll()
+        HPX_CONSTEXPR_OR_CONST std::size_t max_completions = 64;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_operation::submit()
+    {
+        HPX_ASSERT(queue_ != nullptr);
+
+        std::memset(&msg_, 0, sizeof(msg_));
+        msg_.msg_iov = iov_.data() + first_;
+        msg_.msg_iovlen = iov_.size() - first_;
+
+        if (write_)
+            queue_->sendmsg(fd_, &msg_, this);
+        else
+            queue_->recvmsg(fd_, &msg_, this);
+    }
+
+    void io_uring_operation::complete(int result)
+    {
+        boost::system::error_code ec;
+        if (result < 0)
+        {
+            if (result == -EAGAIN || result == -EINTR)
+            {
+                submit();
+                return;
+            }
+            ec = boost::system::error_code(
+                -result, boost::system::system_category());
+        }
+        else
+        {
+            // skip over everything which has been transferred already
+            transferred_ += std::size_t(result);
+
+            std::size_t bytes = std::size_t(result);
+            while (bytes != 0 && first_ != iov_.size())
+            {
+                iovec& v = iov_[first_];
+                if (bytes < v.iov_len)
+                {
+                    v.iov_base = static_cast<char*>(v.iov_base) + bytes;
+                    v.iov_len -= bytes;
+                    break;
+                }
+                bytes -= v.iov_len;
+                ++first_;
+            }
+
+            if (first_ != iov_.size())
+            {
+                // no progress while data is outstanding means the other end
+                // has closed the connection
+                if (result != 0)
+                {
+                    submit();
+                    return;
+                }
+                ec = boost::asio::error::eof;
+            }
+        }
+
+        // The handler may start the next operation on this object or release
+        // the last reference to the connection owning it.
+        handler_type handler;
+        std::swap(handler, handler_);
+        handler(ec, transferred_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_queue::io_uring_queue()
+      : fd_(-1)
+      , sq_ring_(MAP_FAILED), sq_ring_size_(0)
+      , cq_ring_(MAP_FAILED), cq_ring_size_(0)
+      , sqes_(nullptr), sqes_size_(0)
+      , sq_head_(nullptr), sq_tail_(nullptr), sq_mask_(nullptr)
+      , sq_flags_(nullptr), sq_array_(nullptr), sq_entries_(0)
+      , cq_head_(nullptr), cq_tail_(nullptr), cq_mask_(nullptr)
+      , cqes_(nullptr)
+      , unsubmitted_(0)
+      , in_flight_(0)
+    {}
+
+    io_uring_queue::~io_uring_queue()
+    {
+        if (sqes_ != nullptr)
+            ::munmap(sqes_, sqes_size_);
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_)
+            ::munmap(cq_ring_, cq_ring_size_);
+        if (sq_ring_ != MAP_FAILED)
+            ::munmap(sq_ring_, sq_ring_size_);
+
+        // closing the ring cancels all operations which are still pending
+        if (fd_ != -1)
+            ::close(fd_);
+    }
+
+    std::unique_ptr<io_uring_queue> io_uring_queue::create(unsigned entries)
+    {
+        std::unique_ptr<io_uring_queue> queue(new io_uring_queue());
+        if (!queue->init(entries))
+            queue.reset();
+        return queue;
+    }
+
+    bool io_uring_queue::init(unsigned entries)
+    {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+
+        fd_ = io_uring_setup(entries, &p);
+        if (fd_ < 0)
+        {
+            int err = errno;
+            fd_ = -1;
+            LPT_(info) << "tcp::io_uring_queue: io_uring is not available ("
+                       << std::strerror(err) << "), using asio instead";
+            return false;
+        }
+
+        // Completions must not be dropped if the completion queue overflows,
+        // this also guarantees IORING_OP_SENDMSG/RECVMSG to be supported.
+        if (!(p.features & IORING_FEAT_NODROP))
+        {
+            LPT_(info) << "tcp::io_uring_queue: the kernel's io_uring support "
+                          "is too old, using asio instead";
+            return false;
+        }
+
+        sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        if (p.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max)(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED)
+            return false;
+
+        if (p.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED)
+                return false;
+        }
+
+        sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+            return false;
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + p.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        sq_mask_ = reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        sq_flags_ = reinterpret_cast<unsigned*>(sq + p.sq_off.flags);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        sq_entries_ = p.sq_entries;
+
+        char* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+
+        return true;
+    }
+
+    void io_uring_queue::sendmsg(int fd, msghdr const* msg,
+        io_uring_operation* op)
+    {
+        push(IORING_OP_SENDMSG, fd, msg, MSG_NOSIGNAL, op);
+    }
+
+    void io_uring_queue::recvmsg(int fd, msghdr* msg, io_uring_operation* op)
+    {
+        push(IORING_OP_RECVMSG, fd, msg, MSG_WAITALL, op);
+    }
+
+    void io_uring_queue::push(std::uint8_t opcode, int fd, void const* msg,
+        std::uint32_t msg_flags, io_uring_operation* op)
+    {
+        std::unique_lock<mutex_type> l(sq_mtx_);
+
+        unsigned tail = *sq_tail_;
+        while (tail - load_acquire(sq_head_) == sq_entries_)
+        {
+            // the submission queue is full, hand everything to the kernel,
+            // make room in the completion queue if the kernel refuses
+            if (!submit_locked())
+            {
+                l.unlock();
+                reap();
+                l.lock();
+            }
+            tail = *sq_tail_;
+        }
+
+        unsigned index = tail & *sq_mask_;
+
+        io_uring_sqe& sqe = sqes_[index];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<std::uintptr_t>(msg);
+        sqe.len = 1;
+        sqe.msg_flags = msg_flags;
+        sqe.user_data = reinterpret_cast<std::uintptr_t>(op);
+
+        sq_array_[index] = index;
+        store_release(sq_tail_, tail + 1);
+
+        ++unsubmitted_;
+        ++in_flight_;
+    }
+
+    bool io_uring_queue::submit_locked()
+    {
+        if (unsubmitted_ == 0)
+            return false;
+
+        int submitted = io_uring_enter(fd_, unsubmitted_, 0, 0);
+        if (submitted <= 0)
+        {
+            // EBUSY/EAGAIN: the completion queue needs to be reaped first,
+            // EINTR: simply retry later
+            HPX_ASSERT(submitted == 0 || errno == EBUSY || errno == EAGAIN ||
+                errno == EINTR);
+            return false;
+        }
+
+        unsubmitted_ -= unsigned(submitted);
+        return true;
+    }
+
+    bool io_uring_queue::reap()
+    {
+        std::pair<io_uring_operation*, int> completions[max_completions];
+        std::size_t count = 0;
+
+        {
+            std::unique_lock<mutex_type> l(cq_mtx_, std::try_to_lock);
+            if (!l)
+                return false;
+
+            // completions which didn't fit into the completion queue are
+            // handed over only while entering the kernel
+            if ((load_acquire(sq_flags_) & IORING_SQ_CQ_OVERFLOW) &&
+                load_acquire(cq_tail_) == *cq_head_)
+            {
+                io_uring_enter(fd_, 0, 0, IORING_ENTER_GETEVENTS);
+            }
+
+            unsigned head = *cq_head_;
+            unsigned tail = load_acquire(cq_tail_);
+            while (head != tail && count != max_completions)
+            {
+                io_uring_cqe const& cqe = cqes_[head & *cq_mask_];
+                completions[count++] = std::make_pair(
+                    reinterpret_cast<io_uring_operation*>(
+                        static_cast<std::uintptr_t>(cqe.user_data)),
+                    cqe.res);
+                ++head;
+            }
+            store_release(cq_head_, head);
+        }
+
+        in_flight_ -= count;
+
+        // the operations may submit new requests from inside complete()
+        for (std::size_t i = 0; i != count; ++i)
+            completions[i].first->complete(completions[i].second);
+
+        return count != 0;
+    }
+
+    bool io_uring_queue::poll()
+    {
+        if (in_flight_.load(std::memory_order_relaxed) == 0)
+            return false;
+
+        bool has_work = false;
+        {
+            std::unique_lock<mutex_type> l(sq_mtx_, std::try_to_lock);
+            if (l)
+                has_work = submit_locked();
+        }
+        return reap() || has_work;
+    }
+}}}}
+
+#endif
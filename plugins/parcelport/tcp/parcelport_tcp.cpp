@@ -35,7 +35,14 @@ namespace hpx { namespace traits
         }
         static char const* call()
         {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            return
+                "io_uring = ${HPX_PARCEL_TCP_IO_URING:1}\n"
+                "io_uring_entries = ${HPX_PARCEL_TCP_IO_URING_ENTRIES:256}\n"
+                ;
+#else
             return "";
+#endif
         }
     };
 }}
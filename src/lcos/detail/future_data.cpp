@@ -20,6 +20,7 @@
 
 #include <boost/intrusive_ptr.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -77,7 +78,9 @@ namespace hpx { namespace lcos { namespace detail
     ///////////////////////////////////////////////////////////////////////////
     future_data_base<traits::detail::future_data_void>::
         ~future_data_base()
-    {}
+    {
+        reset_on_completed();
+    }
 
     static util::unused_type unused_;
 
@@ -214,6 +217,58 @@ namespace hpx { namespace lcos { namespace detail
         handle_on_completed<completed_callback_vector_type>(
             completed_callback_vector_type&&);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The head of the continuation stack is replaced by this marker once the
+    // future has become ready.
+    future_data_base<traits::detail::future_data_void>::continuation_node*
+    future_data_base<traits::detail::future_data_void>::ready_marker()
+    {
+        static continuation_node marker;
+        return &marker;
+    }
+
+    // Push the given continuation onto the stack of continuations to invoke
+    // once the future becomes ready. Returns false (leaving the continuation
+    // untouched) if the future has become ready in the meantime.
+    bool future_data_base<traits::detail::future_data_void>::
+        push_on_completed(completed_callback_type& data_sink)
+    {
+        continuation_node* head = on_completed_.load(std::memory_order_acquire);
+        if (head == ready_marker())
+            return false;
+
+        // the first continuation is stored in place
+        continuation_node* node = nullptr;
+        bool const use_inline_node =
+            !inline_node_used_.load(std::memory_order_relaxed) &&
+            !inline_node_used_.exchange(true, std::memory_order_acquire);
+
+        if (use_inline_node)
+            node = &inline_node_;
+        else
+            node = new continuation_node;
+
+        node->f_ = std::move(data_sink);
+        node->next_ = head;
+
+        while (!on_completed_.compare_exchange_weak(node->next_, node,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            if (node->next_ == ready_marker())
+            {
+                // the future has become ready, the caller has to invoke the
+                // continuation
+                data_sink = std::move(node->f_);
+                if (use_inline_node)
+                    inline_node_used_.store(false, std::memory_order_release);
+                else
+                    delete node;
+                return false;
+            }
+        }
+        return true;
+    }
+
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
     /// immediately.
@@ -222,26 +277,92 @@ namespace hpx { namespace lcos { namespace detail
     {
         if (!data_sink) return;
 
-        if (is_ready())
+        if (is_ready() || !push_on_completed(data_sink))
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
         }
-        else
+    }
+
+    void future_data_base<traits::detail::future_data_void>::notify_ready()
+    {
+        // Note: the state has been changed using a sequentially consistent
+        //       operation, either we see a thread which is about to wait or
+        //       this thread will see the changed state (see wait()).
+        if (has_waiters_.load())
         {
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
             std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            while (cond_.notify_one(std::move(l), threads::thread_priority_boost))
             {
-                l.unlock();
-
-                // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
+                l = std::unique_lock<mutex_type>(mtx_);
             }
-            else
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // no continuations can be registered from now on
+        continuation_node* head =
+            on_completed_.exchange(ready_marker(), std::memory_order_acq_rel);
+        if (head == nullptr)
+            return;
+
+        HPX_ASSERT(head != ready_marker());
+        if (head->next_ == nullptr)
+        {
+            // invoke the only callback (continuation) function
+            completed_callback_type on_completed = std::move(head->f_);
+            if (head != &inline_node_)
+                delete head;
+
+            handle_on_completed(std::move(on_completed));
+            return;
+        }
+
+        // invoke the callback (continuation) functions in the order they
+        // were registered
+        completed_callback_vector_type on_completed;
+        for (continuation_node* node = head; node != nullptr; /**/)
+        {
+            continuation_node* next = node->next_;
+            on_completed.push_back(std::move(node->f_));
+            if (node != &inline_node_)
+                delete node;
+            node = next;
+        }
+        std::reverse(on_completed.begin(), on_completed.end());
+
+        handle_on_completed(std::move(on_completed));
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        reset_on_completed()
+    {
+        // no locking is required as semantics guarantee a single writer
+        // and no reader
+        continuation_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_acq_rel);
+        if (head != ready_marker())
+        {
+            while (head != nullptr)
             {
-                on_completed_.push_back(std::move(data_sink));
+                continuation_node* next = head->next_;
+                if (head != &inline_node_)
+                    delete head;
+                head = next;
             }
         }
+
+        inline_node_.f_.reset();
+        inline_node_used_.store(false, std::memory_order_relaxed);
+        has_waiters_.store(false, std::memory_order_relaxed);
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -251,8 +372,11 @@ namespace hpx { namespace lcos { namespace detail
         state s = state_.load(std::memory_order_acquire);
         if (s == empty)
         {
+            // announce the waiting thread before checking the state again,
+            // see notify_ready()
             std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            has_waiters_.store(true);
+            s = state_.load();
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -271,8 +395,11 @@ namespace hpx { namespace lcos { namespace detail
         // block if this entry is empty
         if (state_.load(std::memory_order_acquire) == empty)
         {
+            // announce the waiting thread before checking the state again,
+            // see notify_ready()
             std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            has_waiters_.store(true);
+            if (state_.load() == empty)
             {
                 threads::thread_state_ex_enum const reason =
                     cond_.wait_until(l, abs_time,
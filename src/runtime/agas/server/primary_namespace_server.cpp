@@ -25,6 +25,7 @@
 #include <hpx/util/assert_owns_lock.hpp>
 #include <hpx/util/bind_back.hpp>
 #include <hpx/util/bind_front.hpp>
+#include <hpx/util/fibhash.hpp>
 #include <hpx/util/format.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
@@ -35,6 +36,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -231,7 +233,7 @@ primary_namespace::begin_migration(naming::gid_type id)
     std::unique_lock<mutex_type> l(mutex_);
 
     wait_for_migration_locked(l, id, hpx::throws);
-    resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+    resolved_type r = resolve_gid_impl(id, hpx::throws);
     if (get<0>(r) == naming::invalid_gid)
     {
         l.unlock();
@@ -329,6 +331,93 @@ void primary_namespace::wait_for_migration_locked(
     }
 }
 
+primary_namespace::shard& primary_namespace::get_shard(
+    naming::gid_type const& id
+    )
+{
+    return shards_[util::fibhash<num_shards>(
+        std::hash<naming::gid_type>()(id))];
+}
+
+bool primary_namespace::rebind_gid_locked(
+    std::unique_lock<mutex_type>& l
+  , gva_table_data_type& data
+  , gva const& g
+  , naming::gid_type const& id
+  , naming::gid_type const& gid
+  , naming::gid_type const& locality
+    )
+{
+    HPX_ASSERT_OWNS_LOCK(l);
+
+    // non-migratable gids can't be rebound
+    if (naming::refers_to_local_lva(gid) &&
+        !naming::refers_to_virtual_memory(gid))
+    {
+        l.unlock();
+
+        HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
+            "cannot rebind gids for non-migratable objects");
+
+        return false;
+    }
+
+    gva& gaddr = data.first;
+    naming::gid_type& loc = data.second;
+
+    // Check for count mismatch (we can't change block sizes of
+    // existing bindings).
+    if (HPX_UNLIKELY(gaddr.count != g.count))
+    {
+        // REVIEW: Is this the right error code to use?
+        l.unlock();
+
+        HPX_THROW_EXCEPTION(bad_parameter
+          , "primary_namespace::bind_gid"
+          , "cannot change block size of existing binding");
+    }
+
+    if (HPX_UNLIKELY(components::component_invalid == g.type))
+    {
+        l.unlock();
+
+        HPX_THROW_EXCEPTION(bad_parameter
+          , "primary_namespace::bind_gid"
+          , hpx::util::format(
+                "attempt to update a GVA with an invalid type, "
+                "gid({1}), gva({2}), locality({3})",
+                id, g, locality));
+    }
+
+    if (HPX_UNLIKELY(!locality))
+    {
+        l.unlock();
+
+        HPX_THROW_EXCEPTION(bad_parameter
+          , "primary_namespace::bind_gid"
+          , hpx::util::format(
+                "attempt to update a GVA with an invalid locality id, "
+                "gid({1}), gva({2}), locality({3})",
+                id, g, locality));
+    }
+
+    // Store the new endpoint and offset
+    gaddr.prefix = g.prefix;
+    gaddr.type   = g.type;
+    gaddr.lva(g.lva());
+    gaddr.offset = g.offset;
+    loc = locality;
+
+    l.unlock();
+
+    LAGAS_(info) << hpx::util::format(
+        "primary_namespace::bind_gid, gid({1}), gva({2}), "
+        "locality({3}), response(repeated_request)",
+        id, g, locality);
+
+    return false;
+}
+
 bool primary_namespace::bind_gid(
     gva g
   , naming::gid_type id
@@ -345,96 +434,63 @@ bool primary_namespace::bind_gid(
     naming::gid_type gid = id;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    shard& s = get_shard(id);
+    std::unique_lock<mutex_type> l(s.mtx_);
 
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
+    // If we got an exact match, this is a request to update an existing
+    // binding (e.g. move semantics).
+    if (gva_table_data_type* data = s.gvas_.find(id))
+        return rebind_gid_locked(l, *data, g, id, gid, locality);
 
-    if (it != end)
+    // The table of ranges has to be consulted only if it is not empty or if
+    // a new range is about to be inserted.
+    std::unique_lock<mutex_type> rl(ranges_mutex_, std::defer_lock);
+    if (g.count > 1 || num_ranges_.load(std::memory_order_acquire) != 0)
     {
-        // If we got an exact match, this is a request to update an existing
-        // binding (e.g. move semantics).
-        if (it->first == id)
-        {
-            // non-migratable gids can't be rebound
-            if (naming::refers_to_local_lva(gid) &&
-                !naming::refers_to_virtual_memory(gid))
-            {
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
-                    "cannot rebind gids for non-migratable objects");
+        rl.lock();
 
-                return false;
-            }
-
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
+        gva_table_type::iterator it = gva_ranges_.lower_bound(id)
+                               , begin = gva_ranges_.begin()
+                               , end = gva_ranges_.end();
 
-            // Check for count mismatch (we can't change block sizes of
-            // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+        if (it != end)
+        {
+            // exact match of the start of an existing range
+            if (it->first == id)
             {
-                // REVIEW: Is this the right error code to use?
                 l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "cannot change block size of existing binding");
+                return rebind_gid_locked(rl, it->second, g, id, gid, locality);
             }
 
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
+            // We're about to decrement the iterator it - first, we
+            // check that it's safe to do this.
+            else if (it != begin)
             {
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
-            }
+                --it;
 
-            if (HPX_UNLIKELY(!locality))
-            {
-                l.unlock();
+                // Check that a previous range doesn't cover the new id.
+                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+                {
+                    // REVIEW: Is this the right error code to use?
+                    rl.unlock();
+                    l.unlock();
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
+                    HPX_THROW_EXCEPTION(bad_parameter
+                      , "primary_namespace::bind_gid"
+                      , "the new GID is contained in an existing range");
+                }
             }
-
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
-
-            l.unlock();
-
-            LAGAS_(info) << hpx::util::format(
-                "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                "locality({3}), response(repeated_request)",
-                id, g, locality);
-
-            return false;
         }
 
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
+        else if (HPX_LIKELY(!gva_ranges_.empty()))
         {
             --it;
 
             // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+            if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
+                rl.unlock();
                 l.unlock();
 
                 HPX_THROW_EXCEPTION(bad_parameter
@@ -444,26 +500,14 @@ bool primary_namespace::bind_gid(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
-        {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
-
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
-        }
-    }
-
     // non-migratable gids don't need to be bound
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
     {
+        if (rl.owns_lock())
+            rl.unlock();
+        l.unlock();
+
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
             gid, g, locality);
@@ -475,6 +519,8 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
     {
+        if (rl.owns_lock())
+            rl.unlock();
         l.unlock();
 
         HPX_THROW_EXCEPTION(internal_server_error
@@ -484,6 +530,8 @@ bool primary_namespace::bind_gid(
 
     if (HPX_UNLIKELY(components::component_invalid == g.type))
     {
+        if (rl.owns_lock())
+            rl.unlock();
         l.unlock();
 
         HPX_THROW_EXCEPTION(bad_parameter
@@ -495,11 +543,25 @@ bool primary_namespace::bind_gid(
     }
 
     // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    bool inserted = false;
+    if (g.count > 1)
     {
-        l.unlock();
+        inserted = util::insert_checked(gva_ranges_.insert(
+            std::make_pair(id, std::make_pair(g, locality))));
+        if (inserted)
+            num_ranges_.fetch_add(1, std::memory_order_release);
+    }
+    else
+    {
+        inserted = s.gvas_.insert(id, std::make_pair(g, locality)).second;
+    }
+
+    if (rl.owns_lock())
+        rl.unlock();
+    l.unlock();
 
+    if (HPX_UNLIKELY(!inserted))
+    {
         HPX_THROW_EXCEPTION(lock_error
           , "primary_namespace::bind_gid"
           , hpx::util::format(
@@ -508,8 +570,6 @@ bool primary_namespace::bind_gid(
                 id, g, locality));
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
         id, g, locality);
@@ -528,17 +588,19 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(naming::gid_type
 
     resolved_type r;
 
+    if (naming::detail::is_migratable(id))
     {
         std::unique_lock<mutex_type> l(mutex_);
 
         // wait for any migration to be completed
-        if (naming::detail::is_migratable(id))
-        {
-            wait_for_migration_locked(l, id, hpx::throws);
-        }
+        wait_for_migration_locked(l, id, hpx::throws);
 
         // now, resolve the id
-        r = resolve_gid_locked(l, id, hpx::throws);
+        r = resolve_gid_impl(id, hpx::throws);
+    }
+    else
+    {
+        r = resolve_gid_impl(id, hpx::throws);
     }
 
     if (get<0>(r) == naming::invalid_gid)
@@ -577,27 +639,55 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    gva_table_data_type data;
+    bool found = false;
 
-    if (it != end)
     {
-        if (HPX_UNLIKELY(it->second.first.count != count))
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mtx_);
+
+        if (gva_table_data_type* p = s.gvas_.find(id))
         {
-            l.unlock();
+            if (HPX_UNLIKELY(p->first.count != count))
+            {
+                l.unlock();
 
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::unbind_gid"
-              , "block sizes must match");
+                HPX_THROW_EXCEPTION(bad_parameter
+                  , "primary_namespace::unbind_gid"
+                  , "block sizes must match");
+            }
+
+            data = *p;
+            s.gvas_.erase(id);
+            found = true;
         }
+    }
 
-        gva_table_data_type data = it->second;
+    if (!found && num_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        std::unique_lock<mutex_type> l(ranges_mutex_);
 
-        gvas_.erase(it);
+        gva_table_type::iterator it = gva_ranges_.find(id);
+        if (it != gva_ranges_.end())
+        {
+            if (HPX_UNLIKELY(it->second.first.count != count))
+            {
+                l.unlock();
 
-        l.unlock();
+                HPX_THROW_EXCEPTION(bad_parameter
+                  , "primary_namespace::unbind_gid"
+                  , "block sizes must match");
+            }
+
+            data = it->second;
+            gva_ranges_.erase(it);
+            num_ranges_.fetch_sub(1, std::memory_order_release);
+            found = true;
+        }
+    }
+
+    if (found)
+    {
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), gva({3}), "
             "locality_id({4})",
@@ -624,8 +714,6 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::unbind_gid, gid({1}), count({2}), "
         "response(no_success)",
@@ -782,34 +870,31 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        naming::gid_type const last = (lower != upper) ? upper : lower + 1;
+        for (naming::gid_type raw = lower; raw != last; ++raw)
         {
+            shard& s = get_shard(raw);
+            std::lock_guard<mutex_type> l(s.mtx_);
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
-            hpx::util::format_to(ss,
-                "\n  [server] lower({1}), credits({2})",
-                lower_it->first,
-                lower_it->second);
+            if (std::int64_t* credits = s.refcnts_.find(raw))
+            {
+                hpx::util::format_to(ss,
+                    "\n  [server] lower({1}), credits({2})",
+                    raw, *credits);
+            }
         }
 
         LAGAS_(debug) << ss.str();
@@ -824,28 +909,10 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
+        dump_refcnt_matches(lower, upper, "primary_namespace::increment");
     }
 #endif
 
@@ -854,44 +921,27 @@ void primary_namespace::increment(
     // reference count is 2^64 - 2. The maximum number of credits a single GID
     // can hold, however, is limited to 2^32 - 1.
 
-    // The third parameter we pass here is the default data to use in case the
-    // key is not mapped. We don't insert GIDs into the refcnt table when we
-    // allocate/bind them, so if a GID is not in the refcnt table, we know that
-    // it's global reference count is the initial global reference count.
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count.
 
     for (naming::gid_type raw = lower; raw != upper; ++raw)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
-        {
-            std::int64_t count =
-                std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
-
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
-            {
-                l.unlock();
+        shard& s = get_shard(raw);
+        std::int64_t count = 0;
 
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::increment"
-                    , hpx::util::format(
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count));
-                return;
-            }
-
-            it = p.first;
-        }
-        else
         {
-            it->second += credits;
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            std::int64_t* refcnt = s.refcnts_.insert(
+                raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL)).first;
+            *refcnt += credits;
+            count = *refcnt;
         }
 
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::increment, raw({1}), refcnt({2})",
-            lower, it->second);
+            lower, count);
     }
 
     if (&ec != &throws)
@@ -900,42 +950,38 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    std::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+    std::list<naming::gid_type> const& free_list
   , free_entry_list_type& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , error_code& ec
     )
 {
-    HPX_ASSERT_OWNS_LOCK(l);
-
     using hpx::util::get;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
-
-        // The mapping's key space.
-        key_type gid = it->first;
-
+        // Resolve the query GID.
+        resolved_type r;
         if (naming::detail::is_migratable(gid))
         {
+            std::unique_lock<mutex_type> l(mutex_);
+
             // wait for any migration to be completed
             wait_for_migration_locked(l, gid, ec);
-        }
+            if (ec) return;
 
-        // Resolve the query GID.
-        resolved_type r = resolve_gid_locked(l, gid, ec);
+            r = resolve_gid_impl(gid, ec);
+        }
+        else
+        {
+            r = resolve_gid_impl(gid, ec);
+        }
         if (ec) return;
 
         naming::gid_type& raw = get<0>(r);
         if (raw == naming::invalid_gid)
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -951,8 +997,6 @@ void primary_namespace::resolve_free_list(
         // REVIEW: Should we do more to make sure the GVA is valid?
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -963,8 +1007,6 @@ void primary_namespace::resolve_free_list(
         }
         else if (HPX_UNLIKELY(0 == g.count))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -985,9 +1027,6 @@ void primary_namespace::resolve_free_list(
         // Add the information needed to destroy these components to the
         // free list.
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
-
-        // remove this entry from the refcnt table
-        refcnts_.erase(it);
     }
 }
 
@@ -1007,88 +1046,31 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+    if (LAGAS_ENABLED(debug))
+    {
+        dump_refcnt_matches(lower, upper,
+            "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
-
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
-        {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "negative entry in reference count table, raw({1}), "
-                            "refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
-                    return;
-                }
-
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
-
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count));
-                    return;
-                }
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count.
 
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
-            }
+    std::list<naming::gid_type> free_list;
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        shard& s = get_shard(raw);
+        std::unique_lock<mutex_type> l(s.mtx_);
 
-            // Sanity check.
-            if (it->second < 0)
+        std::int64_t* refcnt = s.refcnts_.find(raw);
+        if (refcnt == nullptr)
+        {
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
                 l.unlock();
 
@@ -1097,19 +1079,43 @@ void primary_namespace::decrement_sweep(
                   , hpx::util::format(
                         "negative entry in reference count table, raw({1}), "
                         "refcount({2})",
-                        raw, it->second));
+                        raw,
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            refcnt = s.refcnts_.insert(
+                raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL)).first;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        *refcnt -= credits;
 
-    } // Unlock the mutex.
+        // Sanity check.
+        if (*refcnt < 0)
+        {
+            std::int64_t count = *refcnt;
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , hpx::util::format(
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, count));
+            return;
+        }
+
+        // this objects needs to be deleted, remove it from the refcnt table
+        if (*refcnt == 0)
+        {
+            s.refcnts_.erase(raw);
+            free_list.push_back(raw);
+        }
+    }
+
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+    if (ec) return;
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1176,14 +1182,11 @@ void primary_namespace::free_components_sync(
         ec = make_success_code();
 } // }}}
 
-primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-    std::unique_lock<mutex_type>& l
-  , naming::gid_type const& gid
+primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+    naming::gid_type const& gid
   , error_code& ec
     )
-{ // {{{ resolve_gid_locked implementation
-    HPX_ASSERT_OWNS_LOCK(l);
-
+{ // {{{ resolve_gid_impl implementation
     // handle (non-migratable) components located on this locality first
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
@@ -1199,25 +1202,27 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
-
-    if (it != end)
+    // Check for exact match
     {
-        // Check for exact match
-        if (it->first == id)
+        shard& s = get_shard(id);
+        std::lock_guard<mutex_type> l(s.mtx_);
+
+        if (gva_table_data_type const* data = s.gvas_.find(id))
         {
             if (&ec != &throws)
                 ec = make_success_code();
 
-            gva_table_data_type const& data = it->second;
-            return resolved_type(it->first, data.first, data.second);
+            return resolved_type(id, data->first, data->second);
         }
+    }
 
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
+    // Look for a range containing the GID, if there are any.
+    if (num_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        std::unique_lock<mutex_type> l(ranges_mutex_);
+
+        gva_table_type::const_iterator it = gva_ranges_.upper_bound(id);
+        if (it != gva_ranges_.begin())
         {
             --it;
 
@@ -1230,7 +1235,7 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
                     l.unlock();
 
                     HPX_THROWS_IF(ec, internal_server_error
-                      , "primary_namespace::resolve_gid_locked"
+                      , "primary_namespace::resolve_gid_impl"
                       , "MSBs of lower and upper range bound do not match");
                     return resolved_type(naming::invalid_gid, gva(),
                         naming::invalid_gid);
@@ -1244,32 +1249,6 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
-            }
-
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            return resolved_type(it->first, data.first, data.second);
-        }
-    }
-
     if (&ec != &throws)
         ec = make_success_code();
 
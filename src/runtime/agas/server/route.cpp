@@ -57,20 +57,22 @@ namespace hpx { namespace agas { namespace server
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
-
-            // wait for any migration to be completed
             if (naming::detail::is_migratable(gid))
             {
+                std::unique_lock<mutex_type> l(mutex_);
+
+                // wait for any migration to be completed
                 wait_for_migration_locked(l, gid, ec);
+                if (!ec)
+                    cache_address = resolve_gid_impl(gid, ec);
+            }
+            else
+            {
+                cache_address = resolve_gid_impl(gid, ec);
             }
-
-            cache_address = resolve_gid_locked(l, gid, ec);
 
             if (ec || hpx::util::get<0>(cache_address) == naming::invalid_gid)
             {
-                l.unlock();
-
                 HPX_THROWS_IF(ec, no_success,
                     "primary_namespace::route",
                     hpx::util::format(
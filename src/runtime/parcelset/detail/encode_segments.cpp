@@ -0,0 +1,255 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/base_action.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/parcelset/detail/encode_segments.hpp>
+#include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/logging.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    void serialize_parcels(parcelport& pp,
+        serialization::output_archive& archive, parcel const* ps,
+        std::size_t first, std::size_t last)
+    {
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        util::high_resolution_timer timer;
+#endif
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            std::size_t archive_pos = archive.current_pos();
+            std::int64_t serialize_time = timer.elapsed_nanoseconds();
+#endif
+
+            LPT_(debug) << ps[i];
+            archive.set_split_gids(ps[i].split_gids());
+            archive << ps[i];
+
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            performance_counters::parcels::data_point action_data;
+            action_data.bytes_ = archive.current_pos() - archive_pos;
+            action_data.serialization_time_ =
+                timer.elapsed_nanoseconds() - serialize_time;
+            action_data.num_parcels_ = 1;
+            pp.add_sent_data(
+                ps[i].get_action()->get_action_name(), action_data);
+#endif
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<encoded_segment> plan_segments(
+        parcel const* ps, std::size_t num_parcels, std::size_t threshold)
+    {
+        std::vector<encoded_segment> segments;
+        if (threshold == 0 || num_parcels < 2 || !hpx::is_running())
+            return segments;
+
+        std::size_t total_size = 0;
+        for (std::size_t i = 0; i != num_parcels; ++i)
+            total_size += ps[i].size();
+
+        std::size_t num_segments = (std::min)(
+            (std::min)(num_parcels, total_size / threshold),
+            hpx::get_os_thread_count());
+        if (num_segments < 2)
+            return segments;
+
+        // distribute the parcels such that the estimated sizes of all
+        // segments are roughly the same, every segment gets at least one
+        // parcel
+        segments.reserve(num_segments);
+
+        std::size_t first = 0;
+        std::size_t accumulated_size = 0;
+        for (std::size_t i = 0;
+             i != num_parcels && segments.size() + 1 != num_segments; ++i)
+        {
+            accumulated_size += ps[i].size();
+            if (accumulated_size * num_segments >=
+                    total_size * (segments.size() + 1) ||
+                num_parcels - i == num_segments - segments.size())
+            {
+                segments.emplace_back(first, i + 1);
+                first = i + 1;
+            }
+        }
+        segments.emplace_back(first, num_parcels);
+
+        HPX_ASSERT(segments.size() == num_segments);
+        return segments;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        void encode_segment(parcelport& pp, parcel const* ps,
+            encoded_segment& segment, int archive_flags)
+        {
+            std::size_t arg_size = 0;
+            std::size_t num_chunks = 0;
+            for (std::size_t i = segment.first_; i != segment.last_; ++i)
+            {
+                arg_size += ps[i].size();
+                num_chunks += ps[i].num_chunks();
+            }
+
+            segment.data_.reserve(arg_size);
+            segment.chunks_.reserve(num_chunks);
+
+            serialization::output_archive archive(
+                segment.data_, archive_flags, &segment.chunks_);
+
+            segment.header_size_ = archive.bytes_written();
+
+            serialize_parcels(pp, archive, ps, segment.first_, segment.last_);
+            archive.flush();
+
+            segment.bytes_written_ = archive.bytes_written();
+            segment.tracks_pointers_ = archive.has_tracked_pointers();
+        }
+
+        // State shared between the thread sending the message and the
+        // threads helping with serializing it. Helpers which start running
+        // only after all segments have been taken merely touch this object,
+        // which is why it has to be kept alive by them.
+        struct encode_segments_data
+        {
+            typedef lcos::local::spinlock mutex_type;
+
+            encode_segments_data(parcelport& pp, parcel const* ps,
+                    std::vector<encoded_segment>& segments, int archive_flags)
+              : pp_(pp), ps_(ps), segments_(segments),
+                archive_flags_(archive_flags),
+                num_segments_(segments.size()),
+                next_(1), done_(1), helpers_(0)
+            {}
+
+            // Serialize segments until none are left. The references to
+            // the parcels and segments are valid only as long as there are
+            // segments which have not been finished.
+            void encode(bool helper)
+            {
+                bool counted = !helper;
+                for (std::size_t i = next_++; i < num_segments_; i = next_++)
+                {
+                    if (!counted)
+                    {
+                        ++helpers_;
+                        counted = true;
+                    }
+
+                    try {
+                        encode_segment(pp_, ps_, segments_[i], archive_flags_);
+                    }
+                    catch (...) {
+                        std::lock_guard<mutex_type> l(mtx_);
+                        if (!error_)
+                            error_ = std::current_exception();
+                    }
+
+                    ++done_;
+                }
+            }
+
+            bool finished() const
+            {
+                return done_.load() == num_segments_;
+            }
+
+            parcelport& pp_;
+            parcel const* ps_;
+            std::vector<encoded_segment>& segments_;
+            int archive_flags_;
+            std::size_t num_segments_;
+
+            std::atomic<std::size_t> next_;
+            std::atomic<std::size_t> done_;
+            std::atomic<std::size_t> helpers_;
+
+            mutex_type mtx_;
+            std::exception_ptr error_;
+        };
+    }
+
+    std::size_t encode_segments(parcelport& pp, parcel const* ps,
+        std::vector<encoded_segment>& segments, int archive_flags,
+        util::function_nonser<void()> const& encode_first)
+    {
+        HPX_ASSERT(!segments.empty());
+
+        std::shared_ptr<encode_segments_data> data =
+            std::make_shared<encode_segments_data>(
+                pp, ps, segments, archive_flags);
+
+        // the calling thread takes over whatever was not picked up by the
+        // helpers, so failing to schedule them is not an error
+        for (std::size_t i = 1; i != segments.size(); ++i)
+        {
+            error_code ec(lightweight);
+            hpx::applier::register_work_nullary(
+                [data]() { data->encode(true); },
+                "encode_segments", threads::pending,
+                threads::thread_priority_boost,
+                threads::thread_schedule_hint(),
+                threads::thread_stacksize_default, ec);
+            if (ec)
+                break;
+        }
+
+        std::exception_ptr error;
+        try {
+            encode_first();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        data->encode(false);
+
+        // wait for the helpers to finish the segments they are working on
+        for (std::size_t k = 0; !data->finished(); ++k)
+        {
+            util::detail::yield_k(k % 32,
+                "hpx::parcelset::detail::encode_segments");
+        }
+
+        if (!error)
+            error = data->error_;
+        if (error)
+            std::rethrow_exception(error);
+
+        return data->helpers_.load() + 1;
+    }
+}}}
+
+#endif
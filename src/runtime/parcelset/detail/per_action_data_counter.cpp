@@ -50,6 +50,22 @@ namespace hpx { namespace parcelset { namespace detail
         std::lock_guard<mutex_type> l(mtx_);
         return data_[action].total_bytes(reset);
     }
+
+    // the total time compression took (nanoseconds)
+    std::int64_t per_action_data_counter::total_compression_time(
+        std::string const& action, bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return data_[action].total_compression_time(reset);
+    }
+
+    // ratio of uncompressed to compressed data (in units of 0.01)
+    std::int64_t per_action_data_counter::compression_ratio(
+        std::string const& action, bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return data_[action].compression_ratio(reset);
+    }
 }}}
 
 #endif
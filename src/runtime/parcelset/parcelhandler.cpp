@@ -978,6 +978,30 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    std::int64_t parcelhandler::get_serialization_threads_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_serialization_threads_sent(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_compression_time_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_time_sent(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_compression_ratio_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_ratio_sent(reset) : 0;
+    }
+
     // connection stack statistics
     std::int64_t parcelhandler::get_connection_cache_statistics(
         std::string const& pp_type,
@@ -1045,6 +1069,24 @@ namespace hpx { namespace parcelset
         parcelport* pp = find_parcelport(pp_type, ec);
         return pp ? pp->get_action_data_received(action, reset) : 0;
     }
+
+    // the total time it took to compress the messages sent (nanoseconds)
+    std::int64_t parcelhandler::get_action_compression_time_sent(
+        std::string const& pp_type, std::string const& action, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_action_compression_time_sent(action, reset) : 0;
+    }
+
+    // ratio of uncompressed to compressed data sent (in units of 0.01)
+    std::int64_t parcelhandler::get_action_compression_ratio_sent(
+        std::string const& pp_type, std::string const& action, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_action_compression_ratio_sent(action, reset) : 0;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1200,6 +1242,28 @@ namespace hpx { namespace parcelset
             util::bind_front(&parcelhandler::get_buffer_allocate_time_received, this,
                 pp_type));
 
+        util::function_nonser<std::int64_t(bool)> serialization_threads_sent(
+            util::bind_front(&parcelhandler::get_serialization_threads_sent,
+                this, pp_type));
+
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+        util::function_nonser<std::int64_t(std::string const&, bool)>
+            compression_time_sent(util::bind_front(
+                &parcelhandler::get_action_compression_time_sent, this,
+                pp_type));
+        util::function_nonser<std::int64_t(std::string const&, bool)>
+            compression_ratio_sent(util::bind_front(
+                &parcelhandler::get_action_compression_ratio_sent, this,
+                pp_type));
+#else
+        util::function_nonser<std::int64_t(bool)>
+            compression_time_sent(util::bind_front(
+                &parcelhandler::get_compression_time_sent, this, pp_type));
+        util::function_nonser<std::int64_t(bool)>
+            compression_ratio_sent(util::bind_front(
+                &parcelhandler::get_compression_ratio_sent, this, pp_type));
+#endif
+
         performance_counters::generic_counter_type_data const counter_types[] =
         {
             { hpx::util::format("/parcels/count/{}/sent", pp_type),
@@ -1420,6 +1484,58 @@ namespace hpx { namespace parcelset
               &performance_counters::locality_counter_discoverer,
               "ns"
             },
+            { hpx::util::format(
+                "/serialize/threads/{}/sent", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the accumulated number of threads which took part "
+                  "in serializing the messages sent using the {} connection "
+                  "type (divided by the number of messages sent this gives "
+                  "the average serialization parallelism)", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(serialization_threads_sent), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format("/compression/time/{}/sent", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the total time spent compressing the messages sent "
+                  "using the {} connection type by the referenced locality",
+                  pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+              util::bind(
+                  &performance_counters::per_action_data_counter_creator,
+                  _1, std::move(compression_time_sent), _2),
+              &performance_counters::per_action_data_counter_discoverer,
+#else
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(compression_time_sent), _2),
+              &performance_counters::locality_counter_discoverer,
+#endif
+              "ns"
+            },
+            { hpx::util::format("/compression/ratio/{}/sent", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the ratio of the uncompressed to the compressed "
+                  "amount of data of the messages sent using the {} "
+                  "connection type by the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+              util::bind(
+                  &performance_counters::per_action_data_counter_creator,
+                  _1, std::move(compression_ratio_sent), _2),
+              &performance_counters::per_action_data_counter_discoverer,
+#else
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(compression_ratio_sent), _2),
+              &performance_counters::locality_counter_discoverer,
+#endif
+              "0.01"
+            },
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
@@ -1603,6 +1719,8 @@ namespace hpx { namespace parcelset
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.array_optimization]}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
+            "parallel_encoding_threshold = "
+                "${HPX_PARCEL_PARALLEL_ENCODING_THRESHOLD:65536}",
 #if defined(HPX_HAVE_PARCEL_COALESCING)
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}"
 #else
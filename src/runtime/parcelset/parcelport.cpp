@@ -39,6 +39,7 @@ namespace hpx { namespace parcelset
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
+        parallel_encoding_threshold_(0),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", "0")),
         type_(type)
@@ -66,6 +67,9 @@ namespace hpx { namespace parcelset
         {
             async_serialization_ = true;
         }
+
+        parallel_encoding_threshold_ = hpx::util::get_entry_as<std::size_t>(
+            ini, key + ".parallel_encoding_threshold", "0");
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -183,6 +187,21 @@ namespace hpx { namespace parcelset
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    std::int64_t parcelport::get_serialization_threads_sent(bool reset)
+    {
+        return parcels_sent_.total_serialization_threads(reset);
+    }
+
+    std::int64_t parcelport::get_compression_time_sent(bool reset)
+    {
+        return parcels_sent_.total_compression_time(reset);
+    }
+
+    std::int64_t parcelport::get_compression_ratio_sent(bool reset)
+    {
+        return parcels_sent_.compression_ratio(reset);
+    }
+
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
         std::lock_guard<lcos::local::spinlock> l(mtx_);
@@ -255,6 +274,24 @@ namespace hpx { namespace parcelset
             return parcels_received_.total_bytes(reset);
         return action_parcels_received_.total_bytes(action, reset);
     }
+
+    // the total time it took to compress the messages sent (nanoseconds)
+    std::int64_t parcelport::get_action_compression_time_sent(
+        std::string const& action, bool reset)
+    {
+        if (action.empty())
+            return parcels_sent_.total_compression_time(reset);
+        return action_parcels_sent_.total_compression_time(action, reset);
+    }
+
+    // ratio of uncompressed to compressed data sent (in units of 0.01)
+    std::int64_t parcelport::get_action_compression_ratio_sent(
+        std::string const& action, bool reset)
+    {
+        if (action.empty())
+            return parcels_sent_.compression_ratio(reset);
+        return action_parcels_sent_.compression_ratio(action, reset);
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
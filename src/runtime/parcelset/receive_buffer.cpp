@@ -0,0 +1,74 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace parcelset
+{
+    namespace detail
+    {
+        typedef lcos::local::spinlock receive_buffer_mutex_type;
+
+        receive_buffer_mutex_type& receive_buffer_mtx()
+        {
+            static receive_buffer_mutex_type mtx;
+            return mtx;
+        }
+
+        // the provider is held by a shared_ptr to be able to invoke it
+        // without holding the lock
+        std::shared_ptr<receive_buffer_provider>& receive_buffer_provider_ptr()
+        {
+            static std::shared_ptr<receive_buffer_provider> provider;
+            return provider;
+        }
+    }
+
+    receive_buffer_provider set_receive_buffer_provider(
+        receive_buffer_provider f)
+    {
+        std::shared_ptr<receive_buffer_provider> provider;
+        if (!f.empty())
+        {
+            provider =
+                std::make_shared<receive_buffer_provider>(std::move(f));
+        }
+
+        {
+            std::lock_guard<detail::receive_buffer_mutex_type> l(
+                detail::receive_buffer_mtx());
+            std::swap(provider, detail::receive_buffer_provider_ptr());
+        }
+
+        return provider ? std::move(*provider) : receive_buffer_provider();
+    }
+
+    std::shared_ptr<char> allocate_receive_buffer(std::size_t size)
+    {
+        std::shared_ptr<receive_buffer_provider> provider;
+        {
+            std::lock_guard<detail::receive_buffer_mutex_type> l(
+                detail::receive_buffer_mtx());
+            provider = detail::receive_buffer_provider_ptr();
+        }
+
+        if (provider)
+        {
+            std::shared_ptr<char> data = (*provider)(size);
+            if (data)
+                return data;
+        }
+
+        return std::shared_ptr<char>(
+            new char[size], std::default_delete<char[]>());
+    }
+}}
@@ -32,7 +32,10 @@
 #include <hpx/runtime/threads/coroutines/coroutine.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_impl.hpp>
 #include <hpx/runtime/threads/coroutines/detail/coroutine_self.hpp>
+#include <hpx/runtime/threads/policies/scheduler_base.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/runtime/threads/thread_data_fwd.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
@@ -111,4 +114,63 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         // should not get here, never
         HPX_ASSERT(this->m_state == super_type::ctx_running);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void coroutine_impl::invoke_stackless()
+    {
+        HPX_ASSERT(m_stackless && this->is_ready());
+
+#if defined(HPX_HAVE_THREAD_PHASE_INFORMATION)
+        ++this->m_phase;
+#endif
+        this->m_state = super_type::ctx_running;
+
+        try
+        {
+            coroutine_self* old_self = coroutine_self::get_self();
+            coroutine_self self(this, old_self);
+            reset_self_on_exit on_exit(&self, old_self);
+
+            this->bind_result(m_fun(*this->args()));
+            HPX_ASSERT(m_result.first == thread_state_enum::terminated);
+        }
+        catch (...)
+        {
+            this->reset();
+            this->m_state = super_type::ctx_exited;
+            this->m_exit_status = super_type::ctx_exited_abnormally;
+            throw;
+        }
+
+        this->reset();
+        this->m_state = super_type::ctx_exited;
+        this->m_exit_status = super_type::ctx_exited_return;
+    }
+
+    coroutine_impl::arg_type coroutine_impl::yield_stackless(result_type arg)
+    {
+        HPX_ASSERT(m_stackless && this->running());
+
+        // There is no stack to switch away from, a thread which was asked to
+        // run next is handed to its scheduler instead.
+        if (arg.second)
+        {
+            arg.second->get_scheduler_base()->schedule_thread(
+                arg.second.get(), threads::thread_schedule_hint());
+        }
+
+        // Yielding without being suspended is a hint only, the stackless
+        // thread simply continues to run.
+        if (arg.first == thread_state_enum::pending ||
+            arg.first == thread_state_enum::pending_boost)
+        {
+            return thread_state_ex_enum::wait_signaled;
+        }
+
+        HPX_THROW_EXCEPTION(invalid_status,
+            "coroutine_impl::yield_stackless",
+            "a stackless thread (thread_stacksize_nostack) can't be "
+            "suspended, use a thread with a stack instead");
+        return thread_state_ex_enum::wait_abort;
+    }
 }}}}
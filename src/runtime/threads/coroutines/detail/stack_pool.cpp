@@ -0,0 +1,204 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#endif
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+    namespace posix
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // these global variables are initialized by the runtime configuration
+        // startup code
+        HPX_EXPORT bool use_stack_pool = true;
+        HPX_EXPORT std::size_t stack_pool_size = 1024;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+
+        namespace
+        {
+            // the NUMA node the calling thread is currently running on
+            std::size_t get_current_numa_node()
+            {
+#if (defined(__linux) || defined(linux) || defined(__linux__)) && \
+    defined(SYS_getcpu)
+                unsigned cpu = 0, node = 0;
+                if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+                    return node % HPX_HAVE_MAX_NUMA_DOMAIN_COUNT;
+#endif
+                return 0;
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            class stack_pool
+            {
+                typedef hpx::util::spinlock mutex_type;
+
+                // idle stacks of one NUMA node, grouped by stack size
+                struct numa_node_stacks
+                {
+                    std::vector<void*>& get_stacks(std::size_t size)
+                    {
+                        for (auto& stacks : stacks_)
+                        {
+                            if (stacks.first == size)
+                                return stacks.second;
+                        }
+                        stacks_.emplace_back(size, std::vector<void*>());
+                        return stacks_.back().second;
+                    }
+
+                    mutex_type mtx_;
+                    std::vector<std::pair<std::size_t, std::vector<void*> > >
+                        stacks_;
+                };
+
+            public:
+                stack_pool()
+                  : reserved_bytes_(0)
+                  , resident_bytes_(0)
+                {}
+
+                void* allocate(std::size_t size)
+                {
+                    numa_node_stacks& node =
+                        nodes_[get_current_numa_node()].data_;
+
+                    {
+                        std::lock_guard<mutex_type> l(node.mtx_);
+                        std::vector<void*>& stacks = node.get_stacks(size);
+                        if (!stacks.empty())
+                        {
+                            void* stack = stacks.back();
+                            stacks.pop_back();
+
+                            resident_bytes_ += std::int64_t(size - EXEC_PAGESIZE);
+                            return stack;
+                        }
+                    }
+
+                    void* stack = map_stack(size);
+
+                    reserved_bytes_ += std::int64_t(size + EXEC_PAGESIZE);
+                    resident_bytes_ += std::int64_t(size);
+                    return stack;
+                }
+
+                void deallocate(void* stack, std::size_t size)
+                {
+                    // give the pages used beyond the first page back to the
+                    // system, the stack will be watermarked again on reuse
+                    reset_stack(stack, size);
+
+                    numa_node_stacks& node =
+                        nodes_[get_current_numa_node()].data_;
+
+                    {
+                        std::lock_guard<mutex_type> l(node.mtx_);
+                        std::vector<void*>& stacks = node.get_stacks(size);
+                        if (stacks.size() < stack_pool_size)
+                        {
+                            stacks.push_back(stack);
+
+                            resident_bytes_ -= std::int64_t(size - EXEC_PAGESIZE);
+                            return;
+                        }
+                    }
+
+                    unmap_stack(stack, size);
+
+                    reserved_bytes_ -= std::int64_t(size + EXEC_PAGESIZE);
+                    resident_bytes_ -= std::int64_t(size);
+                }
+
+                std::int64_t get_reserved_bytes() const
+                {
+                    return reserved_bytes_.load(std::memory_order_relaxed);
+                }
+
+                std::int64_t get_resident_bytes() const
+                {
+                    return resident_bytes_.load(std::memory_order_relaxed);
+                }
+
+            private:
+                std::array<
+                    hpx::util::cache_line_data<numa_node_stacks>,
+                    HPX_HAVE_MAX_NUMA_DOMAIN_COUNT
+                > nodes_;
+
+                std::atomic<std::int64_t> reserved_bytes_;
+                std::atomic<std::int64_t> resident_bytes_;
+            };
+
+            // Coroutines may be destroyed during static destruction, the pool
+            // is therefore never destroyed.
+            stack_pool& get_stack_pool()
+            {
+                static stack_pool* pool = new stack_pool;
+                return *pool;
+            }
+        }
+
+        void* allocate_pooled_stack(std::size_t size)
+        {
+            return get_stack_pool().allocate(size);
+        }
+
+        void deallocate_pooled_stack(void* stack, std::size_t size)
+        {
+            get_stack_pool().deallocate(stack, size);
+        }
+
+        std::int64_t get_stack_bytes_reserved(bool /*reset*/)
+        {
+            return get_stack_pool().get_reserved_bytes();
+        }
+
+        std::int64_t get_stack_bytes_resident(bool /*reset*/)
+        {
+            return get_stack_pool().get_resident_bytes();
+        }
+
+#else
+
+        std::int64_t get_stack_bytes_reserved(bool /*reset*/)
+        {
+            return 0;
+        }
+
+        std::int64_t get_stack_bytes_resident(bool /*reset*/)
+        {
+            return 0;
+        }
+
+#endif
+    }
+}}}}
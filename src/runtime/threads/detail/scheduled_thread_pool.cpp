@@ -40,6 +40,11 @@ template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<hpx::compat::mutex,
         hpx::threads::policies::lockfree_lifo>>;
+template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler<
+    hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<hpx::compat::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler<
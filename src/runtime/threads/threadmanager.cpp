@@ -20,6 +20,7 @@
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
 #include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/detail/scheduled_thread_pool.hpp>
 #include <hpx/runtime/threads/detail/set_thread_state.hpp>
 #include <hpx/runtime/threads/executors/current_executor.hpp>
@@ -243,7 +244,7 @@ namespace hpx { namespace threads
 
     namespace strings {
         char const* const stack_size_names[] = {
-            "small", "medium", "large", "huge",
+            "small", "medium", "large", "huge", "current", "nostack",
         };
     }
 
@@ -261,9 +262,14 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (rtcfg.get_stack_size(thread_stacksize_nostack) == size)
+            size = thread_stacksize_nostack;
 
-        if (size < thread_stacksize_small || size > thread_stacksize_huge)
+        if (size < thread_stacksize_small || size > thread_stacksize_nostack ||
+            size == thread_stacksize_current)
+        {
             return "custom";
+        }
 
         return strings::stack_size_names[size - 1];
     }
@@ -427,6 +433,39 @@ namespace hpx { namespace threads
                 break;
             }
 
+            case resource::local_priority_chase_lev:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::detail::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler
+                typedef hpx::threads::policies::local_priority_queue_scheduler<
+                    compat::mutex, hpx::threads::policies::lockfree_chase_lev>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    num_high_priority_queues, 1000, numa_sensitive,
+                    "core-local_priority_chase_lev_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+
+                break;
+            }
+
             case resource::static_:
             {
 #if defined(HPX_HAVE_STATIC_SCHEDULER)
@@ -1014,6 +1053,42 @@ namespace hpx { namespace threads
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_to_pending_core(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_to_pending_core(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_to_pending_cache(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_to_pending_cache(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_to_pending_numa(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_to_pending_numa(
+                all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_to_pending_remote(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_to_pending_remote(
+                all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1373,6 +1448,16 @@ namespace hpx { namespace threads
                 util::bind_front(
                     &coroutine_type::impl_type::get_stack_unbind_count),
                 util::function_nonser<std::uint64_t(bool)>(), "", 0},
+#endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            // /threads{locality#%d/total}/count/stack-bytes-reserved
+            {"count/stack-bytes-reserved",
+                &coroutines::detail::posix::get_stack_bytes_reserved,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-bytes-resident
+            {"count/stack-bytes-resident",
+                &coroutines::detail::posix::get_stack_bytes_resident,
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data)/sizeof(data[0]);
@@ -1642,6 +1727,23 @@ namespace hpx { namespace threads
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &performance_counters::locality_counter_discoverer, ""},
+#endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            {"/threads/count/stack-bytes-reserved",
+                performance_counters::counter_raw,
+                "returns the address space reserved for HPX-thread stacks "
+                "(including stacks held by the stack pool) for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, "bytes"},
+            {"/threads/count/stack-bytes-resident",
+                performance_counters::counter_raw,
+                "returns an upper bound for the memory committed for "
+                "HPX-thread stacks (stacks in use at their full size, pooled "
+                "stacks with the pages not released) for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, "bytes"},
 #endif
             {"/threads/count/objects", performance_counters::counter_raw,
                 "returns the overall number of created HPX-thread objects for "
@@ -1714,6 +1816,46 @@ namespace hpx { namespace threads
                     &thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/stolen-to-pending-core",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen from "
+                "schedulers running on the same core for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_to_pending_core,
+                    &thread_pool_base::get_num_stolen_to_pending_core),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-to-pending-cache",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen from "
+                "schedulers sharing the last level cache for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_to_pending_cache,
+                    &thread_pool_base::get_num_stolen_to_pending_cache),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-to-pending-numa",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen from "
+                "schedulers running in the same NUMA domain for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_to_pending_numa,
+                    &thread_pool_base::get_num_stolen_to_pending_numa),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-to-pending-remote",
+                performance_counters::counter_raw,
+                "returns the overall number of pending HPX-threads stolen from "
+                "schedulers running in a different NUMA domain for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_to_pending_remote,
+                    &thread_pool_base::get_num_stolen_to_pending_remote),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous",
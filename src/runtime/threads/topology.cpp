@@ -269,10 +269,18 @@ namespace hpx { namespace threads
             core_affinity_masks_.push_back(init_core_affinity_mask(i));
         }
 
+        cache_affinity_masks_.reserve(num_of_pus_);
+        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        {
+            cache_affinity_masks_.push_back(init_cache_affinity_mask(i));
+        }
+
         for (std::size_t i = 0; i < num_of_pus_; ++i)
         {
             thread_affinity_masks_.push_back(init_thread_affinity_mask(i));
         }
+
+        init_numa_node_distances();
     } // }}}
 
     void topology::write_to_log() const
@@ -301,6 +309,7 @@ namespace hpx { namespace threads
         detail::write_to_log_mask("socket_affinity_mask", socket_affinity_masks_);
         detail::write_to_log_mask("numa_node_affinity_mask", numa_node_affinity_masks_);
         detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
+        detail::write_to_log_mask("cache_affinity_mask", cache_affinity_masks_);
         detail::write_to_log_mask("thread_affinity_mask", thread_affinity_masks_);
     }
 
@@ -422,6 +431,42 @@ namespace hpx { namespace threads
         return empty_mask;
     }
 
+    mask_cref_type topology::get_cache_affinity_mask(
+        std::size_t num_thread
+      , error_code& ec
+        ) const
+    {
+        std::size_t num_pu = num_thread % num_of_pus_;
+
+        if (num_pu < cache_affinity_masks_.size())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return cache_affinity_masks_[num_pu];
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter
+          , "hpx::threads::topology::get_cache_affinity_mask"
+          , hpx::util::format(
+                "thread number %1% is out of range",
+                num_thread));
+        return empty_mask;
+    }
+
+    std::size_t topology::get_numa_node_distance(
+        std::size_t numa_node1
+      , std::size_t numa_node2
+        ) const
+    {
+        if (numa_node1 < numa_node_distances_.size() &&
+            numa_node2 < numa_node_distances_[numa_node1].size())
+        {
+            return numa_node_distances_[numa_node1][numa_node2];
+        }
+        return numa_node1 == numa_node2 ? 10 : 20;
+    }
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread
       , error_code& ec
@@ -1093,6 +1138,98 @@ namespace hpx { namespace threads
         return default_mask;
     } // }}}
 
+    mask_type topology::init_cache_affinity_mask(
+        std::size_t num_thread
+        ) const
+    { // {{{
+        std::size_t num_pu = (num_thread + pu_offset) % num_of_pus_;
+
+        hwloc_obj_t cache_obj = nullptr;
+        {
+            std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+            hwloc_obj_t obj = hwloc_get_obj_by_type(topo, HWLOC_OBJ_PU,
+                static_cast<unsigned>(num_pu));
+
+            // the outermost cache above the PU is the last level cache
+            for (obj = obj ? obj->parent : nullptr; obj; obj = obj->parent)
+            {
+#if HWLOC_API_VERSION >= 0x00020000
+                if (hwloc_obj_type_is_cache(obj->type))
+#else
+                if (obj->type == HWLOC_OBJ_CACHE)
+#endif
+                {
+                    cache_obj = obj;
+                }
+            }
+        }
+
+        if (cache_obj)
+        {
+            mask_type cache_affinity_mask = mask_type();
+            resize(cache_affinity_mask, get_number_of_pus());
+
+            extract_node_mask(cache_obj, cache_affinity_mask);
+            return cache_affinity_mask;
+        }
+
+        return socket_affinity_masks_[num_thread];
+    } // }}}
+
+    void topology::init_numa_node_distances()
+    { // {{{
+        std::size_t num_of_nodes = get_number_of_numa_nodes();
+        if (num_of_nodes == 0) num_of_nodes = 1;
+
+        numa_node_distances_.assign(num_of_nodes,
+            std::vector<std::size_t>(num_of_nodes, 20));
+        for (std::size_t i = 0; i != num_of_nodes; ++i)
+            numa_node_distances_[i][i] = 10;
+
+        std::unique_lock<hpx::util::spinlock> lk(topo_mtx);
+
+#if HWLOC_API_VERSION >= 0x00020000
+        unsigned nr = 1;
+        hwloc_distances_s* distances = nullptr;
+        if (hwloc_distances_get_by_type(topo, HWLOC_OBJ_NUMANODE, &nr,
+                &distances, 0, 0) != 0 || nr == 0 || distances == nullptr)
+        {
+            return;
+        }
+
+        for (unsigned i = 0; i != distances->nbobjs; ++i)
+        {
+            std::size_t node1 = detail::get_index(distances->objs[i]);
+            for (unsigned j = 0; j != distances->nbobjs; ++j)
+            {
+                std::size_t node2 = detail::get_index(distances->objs[j]);
+                if (node1 < num_of_nodes && node2 < num_of_nodes)
+                {
+                    numa_node_distances_[node1][node2] = std::size_t(
+                        distances->values[i * distances->nbobjs + j]);
+                }
+            }
+        }
+        hwloc_distances_release(topo, distances);
+#else
+        hwloc_distances_s const* distances =
+            hwloc_get_whole_distance_matrix_by_type(topo, HWLOC_OBJ_NODE);
+        if (distances == nullptr || distances->latency == nullptr)
+            return;
+
+        // latencies are normalized such that the local latency is 1.0
+        std::size_t nbobjs = distances->nbobjs;
+        for (std::size_t i = 0; i != nbobjs && i != num_of_nodes; ++i)
+        {
+            for (std::size_t j = 0; j != nbobjs && j != num_of_nodes; ++j)
+            {
+                numa_node_distances_[i][j] = std::size_t(
+                    10.0f * distances->latency[i * nbobjs + j] + 0.5f);
+            }
+        }
+#endif
+    } // }}}
+
     mask_type topology::init_thread_affinity_mask(
         std::size_t num_thread
         ) const
@@ -1497,6 +1634,8 @@ namespace hpx { namespace threads
         print_mask_vector(os, numa_node_affinity_masks_);
         os << "core                  : \n";
         print_mask_vector(os, core_affinity_masks_);
+        os << "cache                 : \n";
+        print_mask_vector(os, cache_affinity_masks_);
         os << "PUs (/threads)        : \n";
         print_mask_vector(os, thread_affinity_masks_);
 
@@ -11,6 +11,7 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/find_prefix.hpp>
 #include <hpx/util/init_ini_data.hpp>
@@ -236,6 +237,8 @@ namespace hpx { namespace util
                 HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_pool = ${HPX_USE_STACK_POOL:1}",
+            "pool_size = ${HPX_STACK_POOL_SIZE:1024}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +260,14 @@ namespace hpx { namespace util
                 "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_PENDING:0}",
             "min_tasks_to_steal_staged = "
                 "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED:10}",
+            "min_tasks_to_steal_core = "
+                "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_CORE:0}",
+            "min_tasks_to_steal_cache = "
+                "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_CACHE:0}",
+            "min_tasks_to_steal_numa = "
+                "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA:0}",
+            "min_tasks_to_steal_remote = "
+                "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_REMOTE:0}",
             "min_add_new_count = ${HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT:10}",
             "max_add_new_count = ${HPX_THREAD_QUEUE_MAX_ADD_NEW_COUNT:10}",
             "max_delete_count = ${HPX_THREAD_QUEUE_MAX_DELETE_COUNT:1000}",
@@ -575,6 +586,10 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::use_stack_pool =
+            init_use_stack_pool();
+        threads::coroutines::detail::posix::stack_pool_size =
+            init_stack_pool_size();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -636,6 +651,10 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::use_stack_pool =
+            init_use_stack_pool();
+        threads::coroutines::detail::posix::stack_pool_size =
+            init_stack_pool_size();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -1055,6 +1074,30 @@ namespace hpx { namespace util
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::init_use_stack_pool() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<int>(
+                    *sec, "use_pool", "1") != 0;
+            }
+        }
+        return true;    // default is true
+    }
+
+    std::size_t runtime_configuration::init_stack_pool_size() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_size", "1024");
+            }
+        }
+        return 1024;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1148,6 +1191,11 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+            // stackless threads run on the stack of the scheduling OS-thread,
+            // see coroutines::detail::nostack_stack_size
+            return (std::numeric_limits<std::ptrdiff_t>::max)();
+
         default:
         case threads::thread_stacksize_small:
             break;
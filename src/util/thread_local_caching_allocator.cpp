@@ -0,0 +1,161 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/internal_allocator.hpp>
+#include <hpx/util/thread_local_caching_allocator.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace util { namespace detail
+{
+#if HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE > 0
+    namespace
+    {
+        // all block sizes are rounded up to a multiple of the alignment
+        // guaranteed by the underlying allocator
+        HPX_CONSTEXPR_OR_CONST std::size_t block_granularity =
+            alignof(std::max_align_t);
+
+        HPX_CONSTEXPR_OR_CONST std::size_t num_size_classes =
+            (HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE +
+                block_granularity - 1) / block_granularity;
+
+        // the maximal number of idle blocks kept per size class and thread
+        HPX_CONSTEXPR_OR_CONST std::size_t max_cached_blocks = 256;
+
+        std::size_t get_size_class(std::size_t size)
+        {
+            return (size + block_granularity - 1) / block_granularity - 1;
+        }
+
+        std::size_t get_block_size(std::size_t size_class)
+        {
+            return (size_class + 1) * block_granularity;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        struct block_cache
+        {
+            block_cache() noexcept
+            {
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    heads_[i] = nullptr;
+                    counts_[i] = 0;
+                }
+                alive_ = true;
+            }
+
+            ~block_cache()
+            {
+                alive_ = false;
+
+                internal_allocator<char> alloc;
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    while (heads_[i] != nullptr)
+                    {
+                        free_block* b = heads_[i];
+                        heads_[i] = b->next_;
+                        alloc.deallocate(
+                            reinterpret_cast<char*>(b), get_block_size(i));
+                    }
+                }
+            }
+
+            void* allocate(std::size_t size_class)
+            {
+                free_block* b = heads_[size_class];
+                if (b != nullptr)
+                {
+                    heads_[size_class] = b->next_;
+                    --counts_[size_class];
+                    return b;
+                }
+                return internal_allocator<char>().allocate(
+                    get_block_size(size_class));
+            }
+
+            void deallocate(void* p, std::size_t size_class) noexcept
+            {
+                if (counts_[size_class] == max_cached_blocks)
+                {
+                    internal_allocator<char>().deallocate(
+                        static_cast<char*>(p), get_block_size(size_class));
+                    return;
+                }
+
+                free_block* b = static_cast<free_block*>(p);
+                b->next_ = heads_[size_class];
+                heads_[size_class] = b;
+                ++counts_[size_class];
+            }
+
+            free_block* heads_[num_size_classes];
+            std::size_t counts_[num_size_classes];
+
+            // blocks released during thread shutdown (after the cache has
+            // been destroyed) are handed back to the allocator directly
+            static HPX_NATIVE_TLS bool alive_;
+        };
+
+        HPX_NATIVE_TLS bool block_cache::alive_ = false;
+
+        block_cache* get_block_cache()
+        {
+            static thread_local block_cache cache;
+            return block_cache::alive_ ? &cache : nullptr;
+        }
+    }
+
+    void* thread_local_caching_allocate(std::size_t size)
+    {
+        if (size != 0 && size <= HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE)
+        {
+            std::size_t size_class = get_size_class(size);
+            if (block_cache* cache = get_block_cache())
+                return cache->allocate(size_class);
+
+            return internal_allocator<char>().allocate(
+                get_block_size(size_class));
+        }
+        return internal_allocator<char>().allocate(size);
+    }
+
+    void thread_local_caching_deallocate(void* p, std::size_t size) noexcept
+    {
+        if (size != 0 && size <= HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE)
+        {
+            std::size_t size_class = get_size_class(size);
+            if (block_cache* cache = get_block_cache())
+            {
+                cache->deallocate(p, size_class);
+                return;
+            }
+
+            internal_allocator<char>().deallocate(
+                static_cast<char*>(p), get_block_size(size_class));
+            return;
+        }
+        internal_allocator<char>().deallocate(static_cast<char*>(p), size);
+    }
+#else
+    void* thread_local_caching_allocate(std::size_t size)
+    {
+        return internal_allocator<char>().allocate(size);
+    }
+
+    void thread_local_caching_deallocate(void* p, std::size_t size) noexcept
+    {
+        internal_allocator<char>().deallocate(static_cast<char*>(p), size);
+    }
+#endif
+}}}
@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the AGAS primary namespace
+// service when binding, resolving, decrementing the credits of, and unbinding
+// GIDs from a given number of concurrent tasks. The server instance of the
+// root locality is invoked directly to exclude any AGAS caching and parcel
+// overheads.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+#include <hpx/runtime/agas/server/primary_namespace.hpp>
+#include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+using hpx::agas::server::primary_namespace;
+
+///////////////////////////////////////////////////////////////////////////////
+void print_stats(char const* op, std::uint64_t tasks, std::uint64_t count,
+    double duration, bool csv)
+{
+    double const rate = double(count) / duration;
+    if (csv)
+    {
+        hpx::util::format_to(hpx::cout,
+            "{1},{2},{3},{4},{5}\n",
+            op, tasks, count, duration, rate)
+            << hpx::flush;
+    }
+    else
+    {
+        hpx::util::format_to(hpx::cout,
+            "operation {1:8}, tasks {2:3}, gids {3:10}, "
+            "duration {4:10.5f}s, {5:14.1f} ops/s\n",
+            op, tasks, count, duration, rate)
+            << hpx::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run the given operation on all GIDs, every task handles a contiguous chunk.
+template <typename F>
+double measure(std::vector<hpx::naming::gid_type> const& gids,
+    std::uint64_t tasks, F const& f)
+{
+    std::size_t const chunk = gids.size() / tasks;
+
+    high_resolution_timer walltime;
+
+    std::vector<hpx::future<void> > futures;
+    futures.reserve(tasks);
+
+    for (std::uint64_t t = 0; t != tasks; ++t)
+    {
+        futures.push_back(hpx::async(
+            [&gids, &f, chunk, t]()
+            {
+                std::size_t const end = (t + 1) * chunk;
+                for (std::size_t i = t * chunk; i != end; ++i)
+                    f(gids[i]);
+            }));
+    }
+
+    hpx::wait_all(futures);
+    return walltime.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        std::uint64_t const count = vm["gids"].as<std::uint64_t>();
+        std::uint64_t const max_tasks = vm["tasks"].as<std::uint64_t>();
+        bool csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == count))
+            throw std::logic_error("error: count of 0 gids specified\n");
+        if (HPX_UNLIKELY(0 == max_tasks))
+            throw std::logic_error("error: at least one task is required\n");
+        if (hpx::get_locality_id() != 0)
+            throw std::logic_error(
+                "error: this benchmark has to be run on the root locality\n");
+
+        primary_namespace* server = reinterpret_cast<primary_namespace*>(
+            hpx::naming::get_agas_client().get_primary_ns_lva());
+
+        hpx::naming::gid_type const locality =
+            hpx::naming::get_gid_from_locality_id(hpx::get_locality_id());
+
+        // GIDs bound by the benchmark refer to this (arbitrary) object
+        static int object = 0;
+
+        for (std::uint64_t tasks = 1; tasks <= max_tasks; tasks *= 2)
+        {
+            std::uint64_t const n = (count / tasks) * tasks;
+
+            std::pair<hpx::naming::gid_type, hpx::naming::gid_type> range =
+                server->allocate(n);
+
+            std::vector<hpx::naming::gid_type> gids;
+            gids.reserve(n);
+            for (hpx::naming::gid_type id = range.first; gids.size() != n; ++id)
+                gids.push_back(id);
+
+            print_stats("bind", tasks, n,
+                measure(gids, tasks,
+                    [&](hpx::naming::gid_type const& id)
+                    {
+                        hpx::agas::gva g(locality,
+                            hpx::components::component_base_lco_with_value,
+                            1, &object);
+                        server->bind_gid(g, id, locality);
+                    }),
+                csv);
+
+            print_stats("resolve", tasks, n,
+                measure(gids, tasks,
+                    [&](hpx::naming::gid_type const& id)
+                    {
+                        server->resolve_gid(id);
+                    }),
+                csv);
+
+            // Increment the credits first to make sure the objects are not
+            // considered to be destroyed when decrementing them again.
+            print_stats("incref", tasks, n,
+                measure(gids, tasks,
+                    [&](hpx::naming::gid_type const& id)
+                    {
+                        server->increment_credit(1, id, id);
+                    }),
+                csv);
+
+            print_stats("decref", tasks, n,
+                measure(gids, tasks,
+                    [&](hpx::naming::gid_type const& id)
+                    {
+                        std::vector<hpx::util::tuple<std::int64_t,
+                            hpx::naming::gid_type, hpx::naming::gid_type>
+                        > requests;
+                        requests.emplace_back(1, id, id);
+                        server->decrement_credit(std::move(requests));
+                    }),
+                csv);
+
+            print_stats("unbind", tasks, n,
+                measure(gids, tasks,
+                    [&](hpx::naming::gid_type const& id)
+                    {
+                        server->unbind_gid(1, id);
+                    }),
+                csv);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("gids", value<std::uint64_t>()->default_value(100000),
+         "number of gids to operate on per measurement")
+        ("tasks", value<std::uint64_t>()->default_value(4),
+         "maximal number of concurrent tasks (measured for powers of two)")
+        ("csv", "output results as csv "
+                "(format: operation,tasks,gids,duration,rate)");
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
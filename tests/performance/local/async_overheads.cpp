@@ -5,6 +5,7 @@
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/threads.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
 #include "worker_timed.hpp"
@@ -21,11 +22,22 @@ std::size_t num_level_tasks = 16;
 std::size_t spread = 2;
 std::uint64_t delay_ns = 0;
 
+// executor used to spawn the leaf tasks, creates stackless threads if
+// requested on the command line
+hpx::threads::executors::default_executor* exec = nullptr;
+
 void test_func()
 {
     worker_timed(delay_ns);
 }
 
+hpx::future<void> spawn_task()
+{
+    if (exec != nullptr)
+        return hpx::async(*exec, &test_func);
+    return hpx::async(&test_func);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 hpx::future<void> spawn_level(std::size_t num_tasks)
 {
@@ -56,7 +68,7 @@ hpx::future<void> spawn_level(std::size_t num_tasks)
 
     // then spawn required number of tasks on this level
     for (std::size_t i = 0; i != num_tasks; ++i)
-        tasks.push_back(hpx::async(&test_func));
+        tasks.push_back(spawn_task());
 
     return hpx::when_all(tasks);
 }
@@ -68,6 +80,11 @@ int hpx_main(boost::program_options::variables_map& vm)
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
 
+    hpx::threads::executors::default_executor nostack_exec(
+        hpx::threads::thread_stacksize_nostack);
+    if (vm.count("stackless"))
+        exec = &nostack_exec;
+
     double seqential_time_per_task = 0;
 
     {
@@ -77,7 +94,7 @@ int hpx_main(boost::program_options::variables_map& vm)
         std::uint64_t start = hpx::util::high_resolution_clock::now();
 
         for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
+            tasks.push_back(spawn_task());
 
         hpx::wait_all(tasks);
 
@@ -117,6 +134,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     hpx::util::print_cdash_timing("AsyncSpeedup",
         seqential_time_per_task/hierarchical_time_per_task);
 
+    exec = nullptr;
     return hpx::finalize();
 }
 
@@ -135,6 +153,9 @@ int main(int argc, char* argv[])
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
          "time spent in the delay loop [ns]")
+        ("stackless",
+         "run the spawned tasks as stackless threads (to completion on the "
+         "stack of the scheduling thread)")
         ;
 
     // Initialize and run HPX
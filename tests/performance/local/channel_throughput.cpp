@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the number of messages per second which can be
+// passed through a local channel by a given number of producers and consumers.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::program_options::variables_map;
+using boost::program_options::options_description;
+using boost::program_options::value;
+
+using hpx::util::high_resolution_timer;
+
+///////////////////////////////////////////////////////////////////////////////
+void print_stats(char const* channel, std::uint64_t producers,
+    std::uint64_t consumers, std::uint64_t count, double duration, bool csv)
+{
+    double const rate = double(count) / duration;
+    if (csv)
+    {
+        hpx::util::format_to(hpx::cout,
+            "{1},{2},{3},{4},{5},{6}\n",
+            channel, producers, consumers, count, duration, rate)
+            << hpx::flush;
+    }
+    else
+    {
+        hpx::util::format_to(hpx::cout,
+            "channel {1:10}, producers {2:3}, consumers {3:3}, "
+            "messages {4:10}, duration {5:10.5f}s, {6:14.1f} msgs/s\n",
+            channel, producers, consumers, count, duration, rate)
+            << hpx::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+double measure(Channel c, std::uint64_t producers, std::uint64_t consumers,
+    std::uint64_t count)
+{
+    std::uint64_t const per_producer = count / producers;
+    std::uint64_t const per_consumer = count / consumers;
+
+    high_resolution_timer walltime;
+
+    std::vector<hpx::future<void> > tasks;
+    tasks.reserve(producers + consumers);
+
+    for (std::uint64_t p = 0; p != producers; ++p)
+    {
+        tasks.push_back(hpx::async(
+            [c, per_producer]() mutable
+            {
+                for (std::uint64_t i = 0; i != per_producer; ++i)
+                    c.set(i);
+            }));
+    }
+
+    for (std::uint64_t q = 0; q != consumers; ++q)
+    {
+        tasks.push_back(hpx::async(
+            [c, per_consumer]()
+            {
+                for (std::uint64_t i = 0; i != per_consumer; ++i)
+                    c.get(hpx::launch::sync);
+            }));
+    }
+
+    hpx::wait_all(tasks);
+    return walltime.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    {
+        std::uint64_t const count = vm["messages"].as<std::uint64_t>();
+        std::uint64_t const max_producers =
+            vm["producers"].as<std::uint64_t>();
+        std::uint64_t const max_consumers =
+            vm["consumers"].as<std::uint64_t>();
+        std::size_t const capacity = vm["capacity"].as<std::size_t>();
+        bool csv = vm.count("csv") != 0;
+
+        if (HPX_UNLIKELY(0 == count))
+            throw std::logic_error("error: count of 0 messages specified\n");
+        if (HPX_UNLIKELY(0 == max_producers || 0 == max_consumers))
+            throw std::logic_error(
+                "error: at least one producer and consumer is required\n");
+
+        // every producer/consumer combination exchanges the same number of
+        // messages
+        for (std::uint64_t p = 1; p <= max_producers; p *= 2)
+        {
+            for (std::uint64_t q = 1; q <= max_consumers; q *= 2)
+            {
+                std::uint64_t const n = (count / (p * q)) * p * q;
+
+                print_stats("unlimited", p, q, n,
+                    measure(hpx::lcos::local::channel<std::uint64_t>(),
+                        p, q, n),
+                    csv);
+                print_stats("bounded", p, q, n,
+                    measure(hpx::lcos::local::bounded_channel<std::uint64_t>(
+                        capacity), p, q, n),
+                    csv);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("messages", value<std::uint64_t>()->default_value(100000),
+         "number of messages to pass through the channel per measurement")
+        ("producers", value<std::uint64_t>()->default_value(4),
+         "maximal number of producers (measured for powers of two)")
+        ("consumers", value<std::uint64_t>()->default_value(4),
+         "maximal number of consumers (measured for powers of two)")
+        ("capacity", value<std::size_t>()->default_value(1024),
+         "capacity of the bounded channel")
+        ("csv", "output results as csv "
+                "(format: channel,producers,consumers,messages,duration,rate)");
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
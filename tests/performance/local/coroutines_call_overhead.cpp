@@ -36,6 +36,7 @@ std::uint64_t contexts   = 1000;
 std::uint64_t iterations = 100000;
 std::uint64_t seed       = 0;
 bool header = true;
+bool stackless = false;
 
 ///////////////////////////////////////////////////////////////////////////////
 std::string format_build_date(std::string timestamp)
@@ -79,7 +80,8 @@ void print_results(
                 "## 2:CTXS:# of Contexts - Independent Variable\n"
                 "## 3:ITER:# of Iterations - Independent Variable\n"
                 "## 4:SEED:PRNG seed - Independent Variable\n"
-                "## 5:WTIME_CS:Walltime/Context Switch [nano-seconds]\n"
+                "## 5:STACKLESS:Stackless coroutines - Independent Variable\n"
+                "## 6:WTIME_CS:Walltime/Context Switch [nano-seconds]\n"
                 ;
 
 /*
@@ -114,12 +116,13 @@ void print_results(
         ;
 */
 
-    hpx::util::format_to(cout, "{} {} {} {} {} {:.14g}",
+    hpx::util::format_to(cout, "{} {} {} {} {} {} {:.14g}",
         payload,
         os_thread_count,
         contexts,
         iterations,
         seed,
+        stackless ? 1 : 0,
         (O/(2*iterations*os_thread_count))*1e9
 //      ((walltime/(2*iterations*os_thread_count))*1e9
     );
@@ -143,13 +146,19 @@ struct kernel
     {
         worker_timed(payload * 1000);
 
-        return hpx::threads::thread_result_type(hpx::threads::pending,
+        return hpx::threads::thread_result_type(hpx::threads::terminated,
             hpx::threads::invalid_thread_id);
     }
-
-    bool operator!() const { return true; }
 };
 
+// every invocation runs the kernel to completion, the coroutine is rebound
+// afterwards (the same happens when a thread object is recycled)
+inline void invoke(coroutine_type& c, kernel const& k)
+{
+    c(wait_signaled);
+    c.rebind(k, hpx::threads::invalid_thread_id);
+}
+
 double perform_2n_iterations()
 {
     std::vector<coroutine_type*> coroutines;
@@ -164,9 +173,15 @@ double perform_2n_iterations()
 
     kernel k;
 
+    // stackless coroutines run on the stack of the invoking thread
+    std::ptrdiff_t stack_size = stackless ?
+        hpx::threads::get_stack_size(hpx::threads::thread_stacksize_nostack) :
+        hpx::threads::get_stack_size(hpx::threads::thread_stacksize_default);
+
     for (std::uint64_t i = 0; i < contexts; ++i)
     {
-        coroutine_type* c = new coroutine_type(k, hpx::threads::invalid_thread_id);
+        coroutine_type* c = new coroutine_type(
+            k, hpx::threads::invalid_thread_id, stack_size);
         coroutines.push_back(c);
     }
 
@@ -177,20 +192,22 @@ double perform_2n_iterations()
     // Warmup
     for (std::uint64_t i = 0; i < iterations; ++i)
     {
-        (*coroutines[indices[i]])(wait_signaled);
+        invoke(*coroutines[indices[i]], k);
     }
 
     hpx::util::high_resolution_timer t;
 
     for (std::uint64_t i = 0; i < iterations; ++i)
     {
-        (*coroutines[indices[i]])(wait_signaled);
+        invoke(*coroutines[indices[i]], k);
     }
 
     double elapsed = t.elapsed();
 
     for (std::uint64_t i = 0; i < contexts; ++i)
     {
+        // run the coroutine to completion to release the bound kernel
+        (*coroutines[i])(wait_signaled);
         delete coroutines[i];
     }
 
@@ -207,6 +224,9 @@ int hpx_main(
         if (vm.count("no-header"))
             header = false;
 
+        if (vm.count("stackless"))
+            stackless = true;
+
         if (!seed)
             seed = std::uint64_t(std::time(nullptr));
 
@@ -296,6 +316,10 @@ int main(
         , "activate and report the specified performance counter")
 */
 
+        ( "stackless"
+        , "use stackless coroutines which run to completion on the stack of "
+          "the invoking thread (no context switches will occur)")
+
         ( "no-header"
         , "do not print out the header")
         ;
@@ -16,6 +16,9 @@
 #include <hpx/include/async.hpp>
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/threads.hpp>
+#include <hpx/lcos/dataflow.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/util/yield_while.hpp>
 #include <hpx/util/lightweight_test.hpp>
 #include <hpx/util/annotated_function.hpp>
@@ -284,6 +287,89 @@ void measure_function_futures_sliding_semaphore(
     print_stats("Apply", "Sliding-Sem", ExecName(exec), count, duration, csv);
 }
 
+// Time the overhead of the shared state alone: make a future ready which has
+// a (synchronously executed) continuation attached
+void measure_promise_set_value_then(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::promise<double> p;
+        future<void> f = p.get_future().then(hpx::launch::sync, scratcher());
+        p.set_value(null_function());
+        f.get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("promise", "Then", "no-executor", count, duration, csv);
+}
+
+// Time the overhead of the shared state alone: make a future ready and
+// retrieve its value
+void measure_promise_set_value_get(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::promise<double> p;
+        future<double> f = p.get_future();
+        p.set_value(null_function());
+        global_scratch += f.get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("promise", "Get", "no-executor", count, duration, csv);
+}
+
+// Time the overhead of combining two futures (as done by each step of a tree
+// reduction) using when_all
+void measure_when_all_pair(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::promise<double> p1, p2;
+        auto f = hpx::when_all(p1.get_future(), p2.get_future());
+        p1.set_value(null_function());
+        p2.set_value(null_function());
+        global_scratch += hpx::util::get<0>(f.get()).get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("when_all", "Pair", "no-executor", count, duration, csv);
+}
+
+// Time the overhead of combining two futures (as done by each step of a tree
+// reduction) using dataflow
+void measure_dataflow_pair(std::uint64_t count, bool csv)
+{
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        hpx::lcos::local::promise<double> p1, p2;
+        future<double> f = hpx::dataflow(hpx::launch::sync,
+            [](future<double> a, future<double> b)
+            {
+                return a.get() + b.get();
+            },
+            p1.get_future(), p2.get_future());
+        p1.set_value(null_function());
+        p2.set_value(null_function());
+        global_scratch += f.get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("dataflow", "Pair", "no-executor", count, duration, csv);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
@@ -300,6 +386,10 @@ int hpx_main(variables_map& vm)
         hpx::parallel::execution::parallel_executor par;
 
         for (int i=0; i<nl; i++) {
+            measure_promise_set_value_get(count, csv);
+            measure_promise_set_value_then(count, csv);
+            measure_when_all_pair(count, csv);
+            measure_dataflow_pair(count, csv);
             measure_action_futures_wait_each(count, csv);
             measure_action_futures_wait_all(count, csv);
             measure_function_futures_wait_each(count, csv, def);
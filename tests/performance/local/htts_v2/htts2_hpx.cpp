@@ -206,13 +206,18 @@ struct hpx_driver : htts2::driver
                 << "OS-threads (Independent Variable),"
                 << "Tasks per OS-thread (Control Variable) [tasks/OS-threads],"
                 << "Payload Duration (Control Variable) [nanoseconds],"
+                << "Queuing Policy (Control Variable),"
                 << "Total Walltime [nanoseconds]"
                 << "\n";
 
-        hpx::util::format_to(std::cout, "{},{},{},{:.14g}\n",
+        // the queuing policy is selected using --hpx:queuing, this allows to
+        // compare the queue backends (e.g. local-priority-fifo and
+        // local-priority-chase-lev) using otherwise identical runs
+        hpx::util::format_to(std::cout, "{},{},{},{},{:.14g}\n",
             this->osthreads_,
             this->tasks_,
             this->payload_duration_,
+            hpx::get_config_entry("hpx.scheduler", "local-priority-fifo"),
             results
         );
     }
@@ -0,0 +1,177 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the segmented algorithms which move elements
+// between the partitions of a partitioned_vector (sort, remove_if, unique,
+// partition, and copy_if) for various vector sizes and numbers of
+// partitions.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/parallel_unique.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+
+struct is_odd
+{
+    bool operator()(int val) const
+    {
+        return val % 2 != 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void fill_vector(hpx::partitioned_vector<int>& v)
+{
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        *it = int((i * 7919) % 100003);
+    }
+}
+
+// Every algorithm is run on a freshly filled vector, only the time needed
+// for the algorithm itself is measured.
+template <typename F>
+double time_algorithm(hpx::partitioned_vector<int>& v, F && f)
+{
+    std::uint64_t elapsed = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        fill_vector(v);
+
+        std::uint64_t start = hpx::util::high_resolution_clock::now();
+        f(v);
+        elapsed += hpx::util::high_resolution_clock::now() - start;
+    }
+    return (elapsed / test_count) / 1e9;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void measure(std::size_t vector_size, std::size_t num_partitions)
+{
+    using namespace hpx::parallel::execution;
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::partitioned_vector<int> v(vector_size,
+        hpx::container_layout(num_partitions, localities));
+    hpx::partitioned_vector<int> dest(vector_size,
+        hpx::container_layout(num_partitions, localities));
+
+    double sort_time = time_algorithm(v,
+        [](hpx::partitioned_vector<int>& v)
+        {
+            hpx::parallel::sort(par, v.begin(), v.end());
+        });
+    double remove_if_time = time_algorithm(v,
+        [](hpx::partitioned_vector<int>& v)
+        {
+            hpx::parallel::remove_if(par, v.begin(), v.end(), is_odd());
+        });
+    double unique_time = time_algorithm(v,
+        [](hpx::partitioned_vector<int>& v)
+        {
+            hpx::parallel::sort(par, v.begin(), v.end());
+            hpx::parallel::unique(par, v.begin(), v.end());
+        });
+    double partition_time = time_algorithm(v,
+        [](hpx::partitioned_vector<int>& v)
+        {
+            hpx::parallel::partition(par, v.begin(), v.end(), is_odd());
+        });
+    double copy_if_time = time_algorithm(v,
+        [&dest](hpx::partitioned_vector<int>& v)
+        {
+            hpx::parallel::copy_if(par, v.begin(), v.end(), dest.begin(),
+                is_odd());
+        });
+
+    hpx::cout << vector_size << ", " << num_partitions << ", "
+        << sort_time << ", " << remove_if_time << ", "
+        << unique_time << ", " << partition_time << ", "
+        << copy_if_time << "\n" << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t max_partitions = vm["partitions"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else if (max_partitions == 0)
+    {
+        hpx::cout << "partitions cannot be zero...\n" << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << "size, partitions, sort [s], remove_if [s], "
+                     "sort+unique [s], partition [s], copy_if [s]\n"
+                  << hpx::flush;
+
+        for (std::size_t size = vector_size / 16; size <= vector_size;
+             size *= 4)
+        {
+            for (std::size_t p = 1; p <= max_partitions; p *= 2)
+            {
+                if (p <= size)
+                    measure(size, p);
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("vector_size"
+        , boost::program_options::value<std::size_t>()->default_value(1048576)
+        , "largest size of the vector (default: 1048576)")
+
+        ("partitions"
+        , boost::program_options::value<std::size_t>()->default_value(16)
+        , "largest number of partitions (default: 16)")
+
+        ("test_count"
+        , boost::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -14,6 +14,7 @@
 #include <boost/predef/other/endian.h>
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
@@ -30,6 +31,23 @@ int test_function(hpx::serialization::serialize_buffer<double> const& b)
 }
 HPX_PLAIN_ACTION(test_function, test_action)
 
+// A brace-initializable struct which is serialized using its compile-time
+// layout (if supported by the compiler)
+struct particle
+{
+    std::array<double, 3> position;
+    std::array<double, 3> velocity;
+    float mass;
+    std::int32_t id;
+};
+
+// This function will never be called
+int test_struct_function(std::vector<particle> const& b)
+{
+    return 42;
+}
+HPX_PLAIN_ACTION(test_struct_function, test_struct_action)
+
 std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     std::uint32_t flags,
     std::vector<hpx::serialization::serialization_chunk>* chunks)
@@ -42,9 +60,28 @@ std::size_t get_archive_size(hpx::parcelset::parcel const& p,
     return gather_size.size();
 }
 
+template <typename Action, typename Arg>
+hpx::parcelset::parcel create_parcel(hpx::naming::id_type const& here,
+    hpx::naming::address addr, bool continuation, Arg const& arg)
+{
+    hpx::naming::gid_type dest = here.get_gid();
+    if (continuation) {
+        return hpx::parcelset::parcel(
+            hpx::parcelset::detail::create_parcel::call(
+                std::move(dest), std::move(addr),
+                hpx::actions::typed_continuation<int>(here),
+                Action(), hpx::threads::thread_priority_normal, arg));
+    }
+
+    return hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        Action(), hpx::threads::thread_priority_normal, arg));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
-double benchmark_serialization(std::size_t data_size, std::size_t iterations,
-    bool continuation, bool zerocopy)
+// returns the elapsed time and the overall number of bytes serialized
+std::pair<double, std::size_t> benchmark_serialization(std::size_t data_size,
+    std::size_t iterations, bool continuation, bool zerocopy, bool structs)
 {
     hpx::naming::id_type const here = hpx::find_here();
     hpx::naming::address addr(hpx::get_locality(),
@@ -89,25 +126,23 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
 
     // create argument for action
     std::vector<double> data;
-    data.resize(data_size);
-
-    hpx::serialization::serialize_buffer<double> buffer(data.data(), data.size(),
-        hpx::serialization::serialize_buffer<double>::reference);
+    std::vector<particle> particles;
 
     // create a parcel with/without continuation
     hpx::parcelset::parcel outp;
-    hpx::naming::gid_type dest = here.get_gid();
-    if (continuation) {
-        outp = hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
-            std::move(dest), std::move(addr),
-            hpx::actions::typed_continuation<int>(here),
-            test_action(), hpx::threads::thread_priority_normal, buffer
-            ));
+    if (structs) {
+        particles.resize(data_size);
+        outp = create_parcel<test_struct_action>(
+            here, addr, continuation, particles);
     }
     else {
-        outp = hpx::parcelset::parcel(hpx::parcelset::detail::create_parcel::call(
-            std::move(dest), std::move(addr),
-            test_action(), hpx::threads::thread_priority_normal, buffer));
+        data.resize(data_size);
+
+        hpx::serialization::serialize_buffer<double> buffer(
+            data.data(), data.size(),
+            hpx::serialization::serialize_buffer<double>::reference);
+
+        outp = create_parcel<test_action>(here, addr, continuation, buffer);
     }
 
     outp.set_source_id(here);
@@ -117,6 +152,7 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
         chunks = new std::vector<hpx::serialization::serialization_chunk>();
 
     //std::uint32_t dest_locality_id = outp.destination_locality_id();
+    std::size_t bytes = 0;
     hpx::util::high_resolution_timer t;
 
     for (std::size_t i = 0; i != iterations; ++i)
@@ -134,6 +170,16 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
             arg_size = archive.bytes_written();
         }
 
+        bytes += arg_size;
+        if (chunks)
+        {
+            for (auto const& chunk : *chunks)
+            {
+                if (chunk.type_ == hpx::serialization::chunk_type_pointer)
+                    bytes += chunk.size_;
+            }
+        }
+
         hpx::parcelset::parcel inp;
 
         {
@@ -148,7 +194,7 @@ double benchmark_serialization(std::size_t data_size, std::size_t iterations,
             chunks->clear();
     }
 
-    return t.elapsed();
+    return std::make_pair(t.elapsed(), bytes);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -161,24 +207,38 @@ int hpx_main(boost::program_options::variables_map& vm)
     bool print_header = vm.count("no-header") == 0;
     bool continuation = vm.count("continuation") != 0;
     bool zerocopy = vm.count("zerocopy") != 0;
+    bool structs = vm.count("structs") != 0;
 
-    std::vector<hpx::future<double> > timings;
+    std::vector<hpx::future<std::pair<double, std::size_t> > > timings;
     for (std::size_t i = 0; i != concurrency; ++i)
     {
         timings.push_back(hpx::async(
             &benchmark_serialization, data_size, iterations,
-            continuation, zerocopy));
+            continuation, zerocopy, structs));
     }
 
     double overall_time = 0;
+    std::size_t overall_bytes = 0;
     for (std::size_t i = 0; i != concurrency; ++i)
-        overall_time += timings[i].get();
+    {
+        std::pair<double, std::size_t> result = timings[i].get();
+        overall_time += result.first;
+        overall_bytes += result.second;
+    }
+
+    // bytes serialized and de-serialized per second
+    double throughput = overall_time != 0 ?
+        double(overall_bytes) / (overall_time / concurrency) / 1e6 : 0.;
 
     if (print_header)
-        hpx::cout << "datasize,testcount,average_time[s]\n" << hpx::flush;
+    {
+        hpx::cout << "datasize,testcount,average_time[s],throughput[MB/s]\n"
+            << hpx::flush;
+    }
 
-    hpx::util::format_to(hpx::cout, "{},{},{}\n",
-        data_size, iterations, overall_time / concurrency) << hpx::flush;
+    hpx::util::format_to(hpx::cout, "{},{},{},{}\n",
+        data_size, iterations, overall_time / concurrency, throughput)
+        << hpx::flush;
     hpx::util::print_cdash_timing("Serialization", overall_time / concurrency);
 
     return hpx::finalize();
@@ -209,6 +269,10 @@ int main(int argc, char* argv[])
         ( "zerocopy"
         , "use zero copy serialization of bitwise copyable arguments")
 
+        ( "structs"
+        , "serialize a vector of brace-initializable structs instead of "
+          "a buffer of doubles")
+
         ( "no-header"
         , "do not print out the csv header row")
         ;
@@ -4,17 +4,26 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/runtime/serialization/deque.hpp>
+#include <hpx/runtime/serialization/list.hpp>
+#include <hpx/runtime/serialization/map.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/unordered_map.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
 #include <hpx/version.hpp>
 
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <iostream>
+#include <list>
+#include <map>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <boost/lexical_cast.hpp>
@@ -217,6 +226,77 @@ void hpx_serialization_test(std::size_t iterations)
               << std::endl << std::endl;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// measure the (bulk) serialization of containers of bitwise serializable
+// elements, with and without array optimizations
+template <typename Container>
+void hpx_container_serialization_test(char const* name,
+    Container const& c, std::size_t iterations)
+{
+    std::uint32_t const flags[] =
+    {
+        0, hpx::serialization::disable_array_optimization
+    };
+
+    for (std::uint32_t flag : flags)
+    {
+        std::vector<char> serialized;
+        Container r;
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            serialized.clear();
+            {
+                hpx::serialization::output_archive archiver(serialized, flag);
+                archiver << c;
+            }
+            {
+                hpx::serialization::input_archive archiver(serialized);
+                archiver >> r;
+            }
+        }
+
+        auto finish = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            finish - start).count();
+
+        if (r != c)
+        {
+            throw std::logic_error(
+                std::string("hpx's case: deserialization failed: ") + name);
+        }
+
+        std::cout << "hpx: " << name
+                  << (flag != 0 ? " (element-wise)" : " (bulk)") << std::endl;
+        std::cout << "hpx: size    = " << serialized.size() << " bytes"
+                  << std::endl;
+        std::cout << "hpx: time    = " << duration << " milliseconds"
+                  << std::endl << std::endl;
+    }
+}
+
+void hpx_container_serialization_test(std::size_t iterations)
+{
+    std::map<std::int64_t, double> m;
+    std::unordered_map<std::int64_t, double> um;
+    std::list<std::int64_t> l;
+    std::deque<std::int64_t> d;
+    for (std::int64_t kInteger : kIntegers)
+    {
+        m.insert(std::make_pair(kInteger, kInteger * 0.5));
+        um.insert(std::make_pair(kInteger, kInteger * 0.5));
+        l.push_back(kInteger);
+        d.push_back(kInteger);
+    }
+
+    hpx_container_serialization_test("std::map", m, iterations);
+    hpx_container_serialization_test("std::unordered_map", um, iterations);
+    hpx_container_serialization_test("std::list", l, iterations);
+    hpx_container_serialization_test("std::deque", d, iterations);
+}
+
 int main(int argc, char **argv)
 {
     if (argc < 2)
@@ -239,5 +319,6 @@ int main(int argc, char **argv)
     }
 
     hpx_serialization_test(iterations);
+    hpx_container_serialization_test(iterations);
 }
 
@@ -0,0 +1,222 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of a mix of get_value and set_value
+// operations issued concurrently by many HPX threads against a single
+// partition of an hpx::unordered_map. As a reference the same operations are
+// executed on a std::unordered_map protected by a single lock.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::size_t, double);
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t num_keys = 10000;
+std::size_t num_ops = 100000;
+std::size_t num_tasks = 0;
+double set_ratio = 0.1;
+int test_count = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+// simple xorshift generator, avoids the overhead of <random>
+struct xorshift
+{
+    explicit xorshift(std::uint64_t seed)
+      : state_(seed * 2685821657736338717ULL + 1)
+    {}
+
+    std::uint64_t operator()()
+    {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 2685821657736338717ULL;
+    }
+
+    std::uint64_t state_;
+};
+
+// reference: a std::unordered_map protected by a single lock
+struct locked_map
+{
+    void get(std::size_t key)
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        sum_ += map_[key];
+    }
+
+    void set(std::size_t key, double val)
+    {
+        std::lock_guard<hpx::lcos::local::spinlock> l(mtx_);
+        map_[key] = val;
+    }
+
+    hpx::lcos::local::spinlock mtx_;
+    std::unordered_map<std::size_t, double> map_;
+    double sum_ = 0;
+};
+
+struct partition_map
+{
+    explicit partition_map(hpx::unordered_map<std::size_t, double>& m)
+      : map_(m)
+    {}
+
+    void get(std::size_t key)
+    {
+        map_.get_value(hpx::launch::sync, key);
+    }
+
+    void set(std::size_t key, double val)
+    {
+        map_.set_value(hpx::launch::sync, key, val);
+    }
+
+    hpx::unordered_map<std::size_t, double>& map_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Map>
+void run_ops(Map& m, std::size_t seed)
+{
+    xorshift gen(seed);
+    std::uint64_t const set_threshold =
+        static_cast<std::uint64_t>(set_ratio * 1000);
+
+    for (std::size_t i = 0; i != num_ops; ++i)
+    {
+        std::uint64_t r = gen();
+        std::size_t key = static_cast<std::size_t>(r % num_keys);
+        if ((r >> 32) % 1000 < set_threshold)
+            m.set(key, double(i));
+        else
+            m.get(key);
+    }
+}
+
+// returns the number of operations per second
+template <typename Map>
+double measure(Map& m)
+{
+    std::uint64_t elapsed = 0;
+    for (int t = 0; t != test_count; ++t)
+    {
+        std::vector<hpx::future<void> > tasks;
+        tasks.reserve(num_tasks);
+
+        std::uint64_t start = hpx::util::high_resolution_clock::now();
+
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            tasks.push_back(hpx::async(&run_ops<Map>, std::ref(m),
+                t * num_tasks + i + 1));
+        }
+        hpx::wait_all(tasks);
+
+        elapsed += hpx::util::high_resolution_clock::now() - start;
+    }
+
+    double ops = double(num_tasks) * num_ops * test_count;
+    return ops / (elapsed * 1e-9);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    num_keys = vm["num_keys"].as<std::size_t>();
+    num_ops = vm["num_ops"].as<std::size_t>();
+    num_tasks = vm["num_tasks"].as<std::size_t>();
+    set_ratio = vm["set_ratio"].as<double>();
+    test_count = vm["test_count"].as<int>();
+
+    if (num_tasks == 0)
+        num_tasks = 4 * hpx::get_os_thread_count();
+
+    if (num_keys == 0 || test_count <= 0 || set_ratio < 0 || set_ratio > 1)
+    {
+        hpx::cout << "invalid command line arguments...\n" << hpx::flush;
+        return hpx::finalize();
+    }
+
+    // reference: single lock
+    double locked_ops = 0;
+    {
+        locked_map m;
+        for (std::size_t k = 0; k != num_keys; ++k)
+            m.map_[k] = 0.0;
+
+        locked_ops = measure(m);
+    }
+
+    // a single partition of hpx::unordered_map
+    double partition_ops = 0;
+    {
+        hpx::unordered_map<std::size_t, double> um(hpx::container_layout(1));
+        for (std::size_t k = 0; k != num_keys; ++k)
+            um.set_value(hpx::launch::sync, k, 0.0);
+
+        partition_map m(um);
+        partition_ops = measure(m);
+    }
+
+    hpx::cout
+        << "threads, tasks, keys, set ratio, single lock [Mops/s], "
+           "partition [Mops/s]\n"
+        << hpx::get_os_thread_count() << ", " << num_tasks << ", "
+        << num_keys << ", " << set_ratio << ", "
+        << locked_ops * 1e-6 << ", " << partition_ops * 1e-6 << "\n"
+        << hpx::flush;
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    boost::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("num_keys"
+        , boost::program_options::value<std::size_t>()->default_value(10000)
+        , "number of distinct keys (default: 10000)")
+
+        ("num_ops"
+        , boost::program_options::value<std::size_t>()->default_value(100000)
+        , "number of operations executed by each task (default: 100000)")
+
+        ("num_tasks"
+        , boost::program_options::value<std::size_t>()->default_value(0)
+        , "number of concurrent tasks (default: 4 * number of cores)")
+
+        ("set_ratio"
+        , boost::program_options::value<double>()->default_value(0.1)
+        , "fraction of set operations (default: 0.1)")
+
+        ("test_count"
+        , boost::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+        ;
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
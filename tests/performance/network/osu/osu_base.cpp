@@ -7,15 +7,102 @@
 // Bidirectional network bandwidth test
 
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
 
 #include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
 
 void print_header();
 void run_benchmark(boost::program_options::variables_map & vm);
 
+///////////////////////////////////////////////////////////////////////////////
+// Report the parcelports the measurements were taken with, this allows to
+// compare the results of running with --hpx:ini=hpx.parcel.<pp>.enable=...
+void print_parcelports()
+{
+    std::ostringstream strm;
+    hpx::get_runtime().get_parcel_handler().list_parcelports(strm);
+
+    std::istringstream lines(strm.str());
+    for (std::string line; std::getline(lines, line); /**/)
+    {
+        if (!line.empty())
+            hpx::cout << "# " << line << "\n";
+    }
+    hpx::cout << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Recycle the memory large messages are received into. The received
+// serialize_buffers take over this memory, reusing it avoids paying for
+// fresh allocations and page faults for every message.
+struct receive_buffer_pool
+{
+    typedef hpx::lcos::local::spinlock mutex_type;
+
+    std::shared_ptr<char> allocate(std::size_t size)
+    {
+        char* p = nullptr;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            std::vector<char*>& buffers = buffers_[size];
+            if (!buffers.empty())
+            {
+                p = buffers.back();
+                buffers.pop_back();
+            }
+        }
+
+        if (p == nullptr)
+            p = new char[size];
+
+        return std::shared_ptr<char>(p,
+            [this, size](char* p)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                buffers_[size].push_back(p);
+            });
+    }
+
+    mutex_type mtx_;
+    std::map<std::size_t, std::vector<char*> > buffers_;
+};
+
+void use_receive_buffer_pool()
+{
+    // the pool is never destroyed, received buffers may still refer to it
+    static receive_buffer_pool* pool = new receive_buffer_pool;
+
+    hpx::parcelset::set_receive_buffer_provider(
+        [](std::size_t size)
+        {
+            return pool->allocate(size);
+        });
+}
+HPX_PLAIN_ACTION(use_receive_buffer_pool);
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map & vm)
 {
+    if (vm.count("receive-buffer-pool"))
+    {
+        for (hpx::id_type const& id : hpx::find_all_localities())
+            use_receive_buffer_pool_action()(id);
+
+        hpx::cout << "# receiving into pooled buffers\n" << hpx::flush;
+    }
+
+    print_parcelports();
     print_header();
     run_benchmark(vm);
     return hpx::finalize();
@@ -42,7 +129,9 @@ int main(int argc, char* argv[])
          "Minimum size of message to send")
         ("max-size",
          boost::program_options::value<std::size_t>()->default_value((1<<22)),
-         "Maximum size of message to send");
+         "Maximum size of message to send")
+        ("receive-buffer-pool",
+         "Receive large messages into recycled buffers on all localities");
 
     return hpx::init(desc, argc, argv);
 }
@@ -8,9 +8,12 @@
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/async.hpp>
 #include <hpx/include/serialization.hpp>
+#include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
 
 #include <cstddef>
 #include <complex>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -36,7 +39,12 @@ int hpx_main(boost::program_options::variables_map& vm)
 
     if (0 == hpx::get_locality_id())
     {
-        hpx::cout << "Running With nparcel = " << n << "\n" << hpx::flush;
+        // list the parcelports which are available for the measurement
+        std::ostringstream strm;
+        hpx::get_runtime().get_parcel_handler().list_parcelports(strm);
+
+        hpx::cout << strm.str()
+                  << "Running With nparcel = " << n << "\n" << hpx::flush;
     }
 
     //Create instance of the actions
@@ -50,14 +58,17 @@ int hpx_main(boost::program_options::variables_map& vm)
     hpx::naming::id_type other_locality = dummy[0];
 
 
+    hpx::util::high_resolution_timer t;
+
     for(std::size_t i=0; i<n; ++i)
     {
         vec.push_back(hpx::async(act,other_locality));
     }
 
     hpx::when_all(vec).then(
-        [&recieved, n](hpx::future<std::vector<hpx::future<std::complex<double>>>> dummy)
+        [&recieved, &t, n](hpx::future<std::vector<hpx::future<std::complex<double>>>> dummy)
         {
+            double const elapsed = t.elapsed();
             std::vector<hpx::future<std::complex<double>>> number = dummy.get();
             for (std::size_t i = 0; i < n; ++i)
             {
@@ -65,7 +76,11 @@ int hpx_main(boost::program_options::variables_map& vm)
             }
             hpx::evaluate_active_counters(false, " All Futures Done");
             hpx::cout << "Now Done With Lambda and the last recieved value is "
-                      <<recieved[n-1]<< "\n" << hpx::flush;
+                      <<recieved[n-1]<< "\n"
+                      << "Elapsed time: " << elapsed << " [s], "
+                      << (n / elapsed) << " [parcels/s], "
+                      << (elapsed / n) * 1e6 << " [us/parcel]\n"
+                      << hpx::flush;
         }
     ).get();
     return hpx::finalize();
@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2017 Taeguk Kwon
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = (unsigned int)std::random_device{}();
+std::mt19937 _rand(seed);
+///////////////////////////////////////////////////////////////////////////////
+
+struct random_fill
+{
+    random_fill(std::size_t random_range)
+        : gen(_rand()),
+        dist(0, random_range - 1)
+    {}
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the input is restored before every run, only the algorithm itself is timed
+template <typename F>
+double run_sort_benchmark(int test_count, std::vector<int> const& org,
+    F && f)
+{
+    std::vector<int> v(org.size());
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::copy(std::begin(org), std::end(org), std::begin(v));
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        f(v);
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+    {
+        seed = vm["seed"].as<unsigned int>();
+        _rand.seed(seed);
+    }
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t random_range = vm["random_range"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    if (random_range < 1)
+        random_range = 1;
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n" << std::endl;
+
+    std::cout << "* Preparing Benchmark..." << std::endl;
+    std::vector<int> v(vector_size);
+
+    // initialize data
+    using namespace hpx::parallel;
+    generate(execution::par, std::begin(v), std::end(v),
+        random_fill(random_range));
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    std::cout << "--- run_sort_benchmark_std ---" << std::endl;
+    double time_std = run_sort_benchmark(test_count, v,
+        [&](std::vector<int>& c)
+        {
+            std::sort(std::begin(c), std::end(c));
+        });
+
+    // a user supplied comparison disables the radix sort, which allows to
+    // compare both parallel implementations on the same input
+    std::cout << "--- run_sort_benchmark_par_comparison ---" << std::endl;
+    double time_par_comparison = run_sort_benchmark(test_count, v,
+        [&](std::vector<int>& c)
+        {
+            sort(execution::par, std::begin(c), std::end(c),
+                [](int lhs, int rhs) { return lhs < rhs; });
+        });
+
+    std::cout << "--- run_sort_benchmark_par_radix ---" << std::endl;
+    double time_par_radix = run_sort_benchmark(test_count, v,
+        [&](std::vector<int>& c)
+        {
+            sort(execution::par, std::begin(c), std::end(c));
+        });
+
+    std::cout << "--- run_sort_by_key_benchmark_par_radix ---" << std::endl;
+    std::vector<int> values(vector_size);
+    double time_par_by_key = run_sort_benchmark(test_count, v,
+        [&](std::vector<int>& c)
+        {
+            sort_by_key(execution::par, std::begin(c), std::end(c),
+                std::begin(values));
+        });
+
+    std::cout << "\n-------------- Benchmark Result --------------" << std::endl;
+    auto fmt = "sort ({1}) : {2}(sec)";
+    hpx::util::format_to(std::cout, fmt, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par comparison",
+        time_par_comparison) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par radix",
+        time_par_radix) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par radix by key",
+        time_par_by_key) << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("vector_size",
+            boost::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("random_range",
+            boost::program_options::value<std::size_t>()->default_value(1000000),
+            "range of random numbers [0, x) (default: 1000000)")
+        ("test_count",
+            boost::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", boost::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
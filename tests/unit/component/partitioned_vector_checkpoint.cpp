@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/partitioned_vector_checkpoint.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/util/checkpoint.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+
+typedef hpx::partitioned_vector<double> vector_type;
+typedef hpx::partitioned_vector_checkpoint<double> checkpoint_type;
+
+void fill_vector(vector_type& v, double val)
+{
+    hpx::parallel::fill(hpx::parallel::execution::par,
+        v.begin(), v.end(), val);
+}
+
+void test_delta_checkpoints()
+{
+    std::size_t const num_segments = 4;
+    std::size_t const partition_size = 100;
+
+    vector_type v(num_segments * partition_size, 1.0,
+        hpx::container_layout(num_segments, hpx::find_all_localities()));
+
+    checkpoint_type base = hpx::save_partitioned_vector_checkpoint(v).get();
+    HPX_TEST(!base.is_delta());
+    HPX_TEST_EQ(base.num_segments(), num_segments);
+    HPX_TEST_EQ(base.get_stored_segments().size(), num_segments);
+
+    // nothing was modified, the delta does not store any data
+    checkpoint_type empty = hpx::save_partitioned_vector_checkpoint(v, base).get();
+    HPX_TEST(empty.is_delta());
+    HPX_TEST(empty.get_stored_segments().empty());
+
+    // modify the third segment only
+    v.set_value(hpx::launch::sync, 2 * partition_size + 5, 42.0);
+
+    checkpoint_type delta1 = hpx::save_partitioned_vector_checkpoint(v, base).get();
+    HPX_TEST(delta1.is_delta());
+    HPX_TEST_EQ(delta1.get_stored_segments().size(), std::size_t(1));
+    HPX_TEST_EQ(delta1.get_stored_segments()[0], std::size_t(2));
+
+    // modify the first and the last segment
+    v.set_value(hpx::launch::sync, 7, 43.0);
+    v.set_value(hpx::launch::sync, 3 * partition_size + 99, 44.0);
+
+    checkpoint_type delta2 =
+        hpx::save_partitioned_vector_checkpoint(v, delta1).get();
+    HPX_TEST_EQ(delta2.get_stored_segments().size(), std::size_t(2));
+    HPX_TEST_EQ(delta2.get_stored_segments()[0], std::size_t(0));
+    HPX_TEST_EQ(delta2.get_stored_segments()[1], std::size_t(3));
+
+    // checkpoints can be stored like any other serializable object
+    std::vector<checkpoint_type> deltas(2);
+    {
+        hpx::util::checkpoint c =
+            hpx::util::save_checkpoint(hpx::launch::sync, delta1, delta2);
+        hpx::util::restore_checkpoint(c, deltas[0], deltas[1]);
+    }
+
+    // overwrite all data and restore the vector
+    fill_vector(v, 0.0);
+
+    hpx::restore_partitioned_vector_checkpoint(v, base, deltas).get();
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        double expected = 1.0;
+        if (i == 2 * partition_size + 5)
+            expected = 42.0;
+        else if (i == 7)
+            expected = 43.0;
+        else if (i == 3 * partition_size + 99)
+            expected = 44.0;
+
+        HPX_TEST_EQ(v[i], expected);
+    }
+
+    // restoring the base only discards the modifications
+    hpx::restore_partitioned_vector_checkpoint(v, base).get();
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], 1.0);
+    }
+
+    // a delta checkpoint can't be used as the base
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::restore_partitioned_vector_checkpoint(v, delta1).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the deltas have to be applied in order
+    {
+        std::vector<checkpoint_type> reversed;
+        reversed.push_back(delta2);
+        reversed.push_back(delta1);
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::restore_partitioned_vector_checkpoint(v, base, reversed).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_data);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // corrupted checkpoints are rejected: a segment which does not exist and
+    // a base checkpoint which does not cover all segments
+    std::vector<std::vector<std::size_t> > const invalid_segments = {
+        {0, 1, 2, num_segments}, {0, 1, 2}};
+
+    for (std::vector<std::size_t> const& segments : invalid_segments)
+    {
+        checkpoint_type corrupted(false,
+            std::vector<hpx::naming::gid_type>(base.get_ids()),
+            std::vector<std::uint64_t>(base.get_modification_counts()),
+            std::vector<std::uint64_t>(),
+            std::vector<std::size_t>(segments),
+            std::vector<std::vector<double> >(
+                segments.size(), std::vector<double>(partition_size)));
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::restore_partitioned_vector_checkpoint(v, corrupted).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_data);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+// writes through references or iterators handed out before a checkpoint was
+// taken have to be captured by the next delta
+void test_mutable_access()
+{
+    typedef hpx::partitioned_vector_partition<double, std::vector<double> >
+        partition_type;
+    typedef hpx::server::partitioned_vector<double, std::vector<double> >
+        server_type;
+
+    std::size_t const num_segments = 2;
+    std::size_t const partition_size = 10;
+
+    vector_type v(num_segments * partition_size, 1.0,
+        hpx::container_layout(num_segments));
+
+    partition_type part(v.segment_begin()->get_id());
+    std::shared_ptr<server_type> data = part.get_ptr();
+
+    std::vector<double>::iterator it = data->begin();
+
+    checkpoint_type base = hpx::save_partitioned_vector_checkpoint(v).get();
+
+    *(it + 3) = 42.0;
+
+    std::vector<checkpoint_type> deltas;
+    deltas.push_back(hpx::save_partitioned_vector_checkpoint(v, base).get());
+    HPX_TEST_EQ(deltas[0].get_stored_segments().size(), std::size_t(1));
+    HPX_TEST_EQ(deltas[0].get_stored_segments()[0], std::size_t(0));
+
+    // the segment is considered to be modified until the access is released
+    *(it + 4) = 43.0;
+
+    deltas.push_back(
+        hpx::save_partitioned_vector_checkpoint(v, deltas[0]).get());
+    HPX_TEST_EQ(deltas[1].get_stored_segments().size(), std::size_t(1));
+
+    *(it + 5) = 44.0;
+    part.release_mutable_access(hpx::launch::sync);
+
+    deltas.push_back(
+        hpx::save_partitioned_vector_checkpoint(v, deltas[1]).get());
+    HPX_TEST_EQ(deltas[2].get_stored_segments().size(), std::size_t(1));
+
+    deltas.push_back(
+        hpx::save_partitioned_vector_checkpoint(v, deltas[2]).get());
+    HPX_TEST(deltas[3].get_stored_segments().empty());
+
+    fill_vector(v, 0.0);
+    hpx::restore_partitioned_vector_checkpoint(v, base, deltas).get();
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        double expected = 1.0;
+        if (i == 3)
+            expected = 42.0;
+        else if (i == 4)
+            expected = 43.0;
+        else if (i == 5)
+            expected = 44.0;
+
+        HPX_TEST_EQ(v[i], expected);
+    }
+}
+
+int main()
+{
+    test_delta_checkpoints();
+    test_mutable_access();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,342 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/partitioned_vector_view.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/lcos/spmd_block.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+
+std::size_t const num_tiles_1d = 8;
+std::size_t const extent_1d = 16;
+
+std::array<std::size_t, 2> const num_tiles_2d = {{4, 3}};
+std::array<std::size_t, 2> const extents_2d = {{5, 4}};
+
+double value_2d(std::size_t x, std::size_t y)
+{
+    return static_cast<double>(x + 1000 * y);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_halo_1d(hpx::lcos::spmd_block const& block, std::string const& name,
+    std::size_t width, bool periodic)
+{
+    using vector_type = hpx::partitioned_vector<double>;
+    using view_type = hpx::partitioned_vector_view<double, 1>;
+    using halo_type = hpx::partitioned_vector_halo<double, 1>;
+
+    vector_type v;
+    v.connect_to(hpx::launch::sync, name);
+
+    view_type view(block, v.begin(), v.end(), {num_tiles_1d});
+    halo_type halo(view, {{extent_1d}}, width, periodic);
+
+    for (std::size_t t = 0; t != num_tiles_1d; ++t)
+    {
+        auto tile = view(t);
+        HPX_TEST_EQ(tile.is_owned_by_current_thread(), halo.is_owned({{t}}));
+
+        if (tile.is_owned_by_current_thread())
+        {
+            std::vector<double>& data = tile.data();
+            for (std::size_t i = 0; i != extent_1d; ++i)
+                data[i] = static_cast<double>(t * extent_1d + i);
+        }
+    }
+
+    block.sync_all();
+    halo.exchange_halos().get();
+    block.sync_all();
+
+    for (std::size_t t = 0; t != num_tiles_1d; ++t)
+    {
+        if (!halo.is_owned({{t}}))
+            continue;
+
+        // lower neighbour
+        if (t == 0 && !periodic)
+        {
+            HPX_TEST(!halo.has_ghost({{t}}, 0, hpx::halo_side::lower));
+            HPX_TEST(halo.get_ghost({{t}}, 0, hpx::halo_side::lower).empty());
+        }
+        else
+        {
+            std::size_t n = (t + num_tiles_1d - 1) % num_tiles_1d;
+            std::vector<double> const& ghost =
+                halo.get_ghost({{t}}, 0, hpx::halo_side::lower);
+
+            HPX_TEST_EQ(ghost.size(), width);
+            for (std::size_t l = 0; l != ghost.size(); ++l)
+            {
+                HPX_TEST_EQ(ghost[l], static_cast<double>(
+                    n * extent_1d + extent_1d - width + l));
+            }
+        }
+
+        // upper neighbour
+        if (t == num_tiles_1d - 1 && !periodic)
+        {
+            HPX_TEST(!halo.has_ghost({{t}}, 0, hpx::halo_side::upper));
+            HPX_TEST(halo.get_ghost({{t}}, 0, hpx::halo_side::upper).empty());
+        }
+        else
+        {
+            std::size_t n = (t + 1) % num_tiles_1d;
+            std::vector<double> const& ghost =
+                halo.get_ghost({{t}}, 0, hpx::halo_side::upper);
+
+            HPX_TEST_EQ(ghost.size(), width);
+            for (std::size_t l = 0; l != ghost.size(); ++l)
+            {
+                HPX_TEST_EQ(
+                    ghost[l], static_cast<double>(n * extent_1d + l));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void verify_ghost_2d(hpx::partitioned_vector_halo<double, 2> const& halo,
+    std::array<std::size_t, 2> const& index, std::size_t dim,
+    hpx::halo_side side, std::size_t width, bool periodic)
+{
+    // determine the neighbour across the given face
+    std::array<std::size_t, 2> n = index;
+    if (side == hpx::halo_side::lower)
+    {
+        if (n[dim] == 0)
+        {
+            if (!periodic)
+            {
+                HPX_TEST(!halo.has_ghost(index, dim, side));
+                HPX_TEST(halo.get_ghost(index, dim, side).empty());
+                return;
+            }
+            n[dim] = num_tiles_2d[dim];
+        }
+        --n[dim];
+    }
+    else if (++n[dim] == num_tiles_2d[dim])
+    {
+        if (!periodic)
+        {
+            HPX_TEST(!halo.has_ghost(index, dim, side));
+            HPX_TEST(halo.get_ghost(index, dim, side).empty());
+            return;
+        }
+        n[dim] = 0;
+    }
+
+    std::array<std::size_t, 2> ghost_extents = extents_2d;
+    ghost_extents[dim] = width;
+
+    std::vector<double> const& ghost = halo.get_ghost(index, dim, side);
+    HPX_TEST(halo.has_ghost(index, dim, side));
+    HPX_TEST_EQ(ghost.size(), ghost_extents[0] * ghost_extents[1]);
+
+    for (std::size_t y = 0; y != ghost_extents[1]; ++y)
+    {
+        for (std::size_t x = 0; x != ghost_extents[0]; ++x)
+        {
+            std::array<std::size_t, 2> c = {{x, y}};
+            if (side == hpx::halo_side::lower)
+                c[dim] += extents_2d[dim] - width;
+
+            HPX_TEST_EQ(ghost[x + ghost_extents[0] * y],
+                value_2d(n[0] * extents_2d[0] + c[0],
+                    n[1] * extents_2d[1] + c[1]));
+        }
+    }
+}
+
+void test_halo_2d(hpx::lcos::spmd_block const& block, std::string const& name,
+    std::size_t width, bool periodic)
+{
+    using vector_type = hpx::partitioned_vector<double>;
+    using view_type = hpx::partitioned_vector_view<double, 2>;
+    using halo_type = hpx::partitioned_vector_halo<double, 2>;
+
+    vector_type v;
+    v.connect_to(hpx::launch::sync, name);
+
+    view_type view(
+        block, v.begin(), v.end(), {num_tiles_2d[0], num_tiles_2d[1]});
+    halo_type halo(view, extents_2d, width, periodic);
+
+    for (std::size_t j = 0; j != num_tiles_2d[1]; ++j)
+    {
+        for (std::size_t i = 0; i != num_tiles_2d[0]; ++i)
+        {
+            auto tile = view(i, j);
+            if (!tile.is_owned_by_current_thread())
+                continue;
+
+            std::vector<double>& data = tile.data();
+            for (std::size_t y = 0; y != extents_2d[1]; ++y)
+            {
+                for (std::size_t x = 0; x != extents_2d[0]; ++x)
+                {
+                    data[x + extents_2d[0] * y] =
+                        value_2d(i * extents_2d[0] + x, j * extents_2d[1] + y);
+                }
+            }
+        }
+    }
+
+    block.sync_all();
+    halo.exchange_halos().get();
+    block.sync_all();
+
+    for (std::size_t j = 0; j != num_tiles_2d[1]; ++j)
+    {
+        for (std::size_t i = 0; i != num_tiles_2d[0]; ++i)
+        {
+            std::array<std::size_t, 2> index = {{i, j}};
+            if (!halo.is_owned(index))
+                continue;
+
+            for (std::size_t d = 0; d != 2; ++d)
+            {
+                verify_ghost_2d(halo, index, d, hpx::halo_side::lower,
+                    width, periodic);
+                verify_ghost_2d(halo, index, d, hpx::halo_side::upper,
+                    width, periodic);
+            }
+        }
+    }
+}
+
+void test_invalid_halo(hpx::lcos::spmd_block const& block,
+    std::string const& name)
+{
+    using vector_type = hpx::partitioned_vector<double>;
+    using view_type = hpx::partitioned_vector_view<double, 2>;
+    using halo_type = hpx::partitioned_vector_halo<double, 2>;
+
+    vector_type v;
+    v.connect_to(hpx::launch::sync, name);
+
+    view_type view(
+        block, v.begin(), v.end(), {num_tiles_2d[0], num_tiles_2d[1]});
+
+    // the ghost width exceeds the extent of the tiles
+    bool caught_exception = false;
+    try
+    {
+        halo_type halo(view, extents_2d, extents_2d[0] + 1);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    // the extents do not match the size of the tiles
+    caught_exception = false;
+    try
+    {
+        halo_type halo(view, {{extents_2d[0], extents_2d[1] + 1}}, 1);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+// blocks exceeding the size of a partition are rejected in release builds
+void test_invalid_blocks()
+{
+    using vector_type = hpx::partitioned_vector<double>;
+    using partition_type =
+        hpx::partitioned_vector_partition<double, std::vector<double>>;
+
+    vector_type v(2 * extent_1d, hpx::container_layout(2));
+    partition_type part(v.segment_begin()->get_id());
+
+    std::vector<double> blocks =
+        part.get_blocks(hpx::launch::sync, 1, 3, 2, extent_1d / 3);
+    HPX_TEST_EQ(blocks.size(), std::size_t(6));
+
+    // first, count, block size and stride; the last two would overflow
+    std::array<std::array<std::size_t, 4>, 5> const invalid = {{
+        {{extent_1d, 1, 1, 1}},
+        {{1, 1, extent_1d, 1}},
+        {{0, 3, 2, extent_1d / 2}},
+        {{0, std::size_t(-1), 1, std::size_t(1) << 62}},
+        {{0, std::size_t(-1), 2, 0}},
+    }};
+
+    for (auto const& b : invalid)
+    {
+        bool caught_exception = false;
+        try
+        {
+            part.get_blocks(hpx::launch::sync, b[0], b[1], b[2], b[3]);
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void bulk_test(hpx::lcos::spmd_block block, std::string name_1d,
+    std::string name_2d)
+{
+    test_halo_1d(block, name_1d, 1, false);
+    test_halo_1d(block, name_1d, 3, true);
+
+    test_halo_2d(block, name_2d, 1, false);
+    test_halo_2d(block, name_2d, 2, true);
+
+    test_invalid_halo(block, name_2d);
+}
+HPX_PLAIN_ACTION(bulk_test, bulk_test_action);
+
+int main()
+{
+    using vector_type = hpx::partitioned_vector<double>;
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    vector_type v_1d(num_tiles_1d * extent_1d,
+        hpx::container_layout(num_tiles_1d, localities));
+
+    std::size_t num_tiles = num_tiles_2d[0] * num_tiles_2d[1];
+    vector_type v_2d(num_tiles * extents_2d[0] * extents_2d[1],
+        hpx::container_layout(num_tiles, localities));
+
+    std::string name_1d("halo_vector_1d");
+    std::string name_2d("halo_vector_2d");
+    v_1d.register_as(hpx::launch::sync, name_1d);
+    v_2d.register_as(hpx::launch::sync, name_2d);
+
+    hpx::future<void> join = hpx::lcos::define_spmd_block(
+        "block", 4, bulk_test_action(), name_1d, name_2d);
+
+    join.get();
+
+    test_invalid_blocks();
+
+    return hpx::util::report_errors();
+}
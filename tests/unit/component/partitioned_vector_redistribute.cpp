@@ -0,0 +1,251 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+typedef hpx::partitioned_vector<int> vector_type;
+
+void fill_vector(vector_type& v)
+{
+    int i = 0;
+    for (vector_type::iterator it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        *it = i;
+    }
+}
+
+void verify_vector(vector_type const& v, std::size_t size)
+{
+    HPX_TEST_EQ(v.size(), size);
+
+    int i = 0;
+    for (vector_type::const_iterator it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, i);
+    }
+}
+
+// return the locality ids of all segments of the given vector
+std::vector<std::uint32_t> get_segment_localities(vector_type& v)
+{
+    std::vector<std::uint32_t> localities;
+    for (vector_type::segment_iterator sit = v.segment_begin();
+         sit != v.segment_end(); ++sit)
+    {
+        localities.push_back(
+            hpx::naming::get_locality_id_from_id(sit->get_id()));
+    }
+    return localities;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_redistribute()
+{
+    std::size_t const size = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    vector_type v(size, hpx::container_layout(4, localities));
+    fill_vector(v);
+
+    vector_type::iterator it = v.begin() + 17;
+
+    // redistributing to the same layout does not move anything
+    hpx::redistribution_statistics stats = v.redistribute(
+        hpx::launch::sync, hpx::block_distribution(4, localities));
+    HPX_TEST_EQ(stats.partitions_kept_, std::size_t(4));
+    HPX_TEST_EQ(stats.partitions_created_, std::size_t(0));
+    HPX_TEST_EQ(stats.elements_moved_, std::uint64_t(0));
+    HPX_TEST_EQ(stats.bytes_moved_, std::uint64_t(0));
+    verify_vector(v, size);
+
+    // place the partitions in a round robin fashion
+    stats = v.redistribute(
+        hpx::launch::sync, hpx::cyclic_distribution(7, localities));
+    HPX_TEST_EQ(stats.partitions_kept_, std::size_t(0));
+    HPX_TEST_EQ(stats.partitions_created_, std::size_t(7));
+    HPX_TEST_EQ(stats.elements_moved_, std::uint64_t(size));
+    HPX_TEST_EQ(stats.bytes_moved_, std::uint64_t(size * sizeof(int)));
+    HPX_TEST(stats.bytes_transferred_ <= stats.bytes_moved_);
+    verify_vector(v, size);
+
+    std::vector<std::uint32_t> segments = get_segment_localities(v);
+    HPX_TEST_EQ(segments.size(), std::size_t(7));
+    for (std::size_t i = 0; i != segments.size(); ++i)
+    {
+        HPX_TEST_EQ(segments[i], hpx::naming::get_locality_id_from_id(
+            localities[i % localities.size()]));
+    }
+
+    // global iterators stay valid
+    HPX_TEST_EQ(*it, 17);
+
+    // the first locality gets three times as many partitions as the others
+    std::vector<double> weights(localities.size(), 1.0);
+    weights[0] = 3.0;
+
+    std::size_t num_parts = 4 * (localities.size() + 2);
+    stats = v.redistribute(hpx::launch::sync,
+        hpx::weighted_distribution(num_parts, localities, weights));
+    verify_vector(v, size);
+
+    segments = get_segment_localities(v);
+    HPX_TEST_EQ(segments.size(), num_parts);
+
+    std::size_t first_locality = 0;
+    for (std::uint32_t id : segments)
+    {
+        if (id == hpx::naming::get_locality_id_from_id(localities[0]))
+            ++first_locality;
+    }
+    HPX_TEST_EQ(first_locality, std::size_t(12));
+
+    // asynchronous redistribution
+    hpx::future<hpx::redistribution_statistics> f =
+        v.redistribute(hpx::block_distribution(3, localities));
+    stats = f.get();
+    HPX_TEST_EQ(stats.partitions_created_ + stats.partitions_kept_,
+        std::size_t(3));
+    verify_vector(v, size);
+    HPX_TEST_EQ(*it, 17);
+}
+
+// instances connecting to a registered vector after it was redistributed
+// have to see the new layout
+void test_redistribute_registered()
+{
+    std::size_t const size = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    std::string const name("partitioned_vector_redistribute_registered");
+
+    vector_type v(size, hpx::container_layout(4, localities));
+    fill_vector(v);
+    v.register_as(hpx::launch::sync, name);
+
+    v.redistribute(hpx::launch::sync, hpx::cyclic_distribution(7, localities));
+    std::vector<std::uint32_t> segments = get_segment_localities(v);
+
+    vector_type connected;
+    connected.connect_to(hpx::launch::sync, name);
+    verify_vector(connected, size);
+
+    HPX_TEST(get_segment_localities(connected) == segments);
+    for (vector_type::segment_iterator sit1 = v.segment_begin(),
+            sit2 = connected.segment_begin();
+         sit1 != v.segment_end(); ++sit1, ++sit2)
+    {
+        HPX_TEST_EQ(sit1->get_id(), sit2->get_id());
+    }
+}
+
+void test_invalid_distribution()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::weighted_distribution(4, localities,
+            std::vector<double>(localities.size() + 1, 1.0));
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        hpx::cyclic_distribution(0, localities);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+// ranges exceeding the size of a partition are rejected in release builds
+void test_invalid_ranges()
+{
+    std::size_t const size = 50;
+
+    vector_type v(2 * size, hpx::container_layout(2));
+    fill_vector(v);
+
+    hpx::partitioned_vector_partition<int, std::vector<int> > part(
+        v.segment_begin()->get_id());
+
+    std::vector<int> values = part.get_range(hpx::launch::sync, size - 2, 2);
+    HPX_TEST_EQ(values.size(), std::size_t(2));
+    HPX_TEST_EQ(values[1], int(size - 1));
+
+    bool caught_exception = false;
+    try
+    {
+        part.get_range(hpx::launch::sync, size - 1, 2);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    // first + count overflows
+    caught_exception = false;
+    try
+    {
+        part.get_range(hpx::launch::sync, 1, std::size_t(-1));
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        std::vector<hpx::server::partitioned_vector_range> ranges;
+        ranges.emplace_back(part.get_id(), 0, 2);
+        part.copy_ranges(hpx::launch::sync, size - 1, ranges);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+
+    // nothing was overwritten by the rejected copy
+    verify_vector(v, 2 * size);
+}
+
+int main()
+{
+    test_redistribute();
+    test_redistribute_registered();
+    test_invalid_distribution();
+    test_invalid_ranges();
+
+    return hpx::util::report_errors();
+}
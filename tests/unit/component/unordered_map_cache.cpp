@@ -0,0 +1,167 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::size_t, double);
+
+typedef hpx::unordered_map<std::size_t, double> map_type;
+typedef hpx::unordered_map_cache<std::size_t, double> cache_type;
+
+std::size_t const num_keys = 100;
+
+std::vector<std::size_t> make_keys(std::size_t first, std::size_t count)
+{
+    std::vector<std::size_t> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+        keys.push_back(first + i);
+    return keys;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bulk_operations(map_type& m)
+{
+    std::vector<std::size_t> keys = make_keys(0, num_keys);
+
+    std::vector<double> vals;
+    for (std::size_t k : keys)
+        vals.push_back(double(k));
+
+    m.set_values(hpx::launch::sync, keys, vals);
+    HPX_TEST_EQ(m.size(), num_keys);
+
+    for (std::size_t k : keys)
+        HPX_TEST_EQ(m.get_value(hpx::launch::sync, k), double(k));
+
+    // the values are returned in the order of the (unsorted) keys
+    std::vector<std::size_t> reversed(keys.rbegin(), keys.rend());
+    std::vector<double> result = m.get_values(reversed).get();
+    HPX_TEST_EQ(result.size(), num_keys);
+    for (std::size_t i = 0; i != reversed.size(); ++i)
+        HPX_TEST_EQ(result[i], double(reversed[i]));
+
+    HPX_TEST(m.get_values(hpx::launch::sync, std::vector<std::size_t>())
+        .empty());
+}
+
+void test_cache(map_type& m)
+{
+    std::size_t num_partitions = m.get_num_partitions();
+    std::vector<std::size_t> keys = make_keys(0, num_keys);
+
+    std::size_t remote_keys = 0;
+    std::size_t remote_partitions = 0;
+    {
+        std::vector<bool> used(num_partitions, false);
+        for (std::size_t k : keys)
+        {
+            std::size_t part = m.get_partition(k);
+            if (m.is_local_partition(part))
+                continue;
+
+            ++remote_keys;
+            if (!used[part])
+            {
+                used[part] = true;
+                ++remote_partitions;
+            }
+        }
+    }
+
+    cache_type c(m);
+
+    // the first access fetches all values, one request per partition
+    std::vector<double> result = c.get_values(hpx::launch::sync, keys);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+        HPX_TEST_EQ(result[i], double(keys[i]));
+
+    hpx::unordered_map_cache_statistics stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits, std::uint64_t(0));
+    HPX_TEST_EQ(stats.misses, std::uint64_t(num_keys));
+    HPX_TEST_EQ(stats.round_trips, std::uint64_t(remote_partitions));
+    HPX_TEST_EQ(stats.round_trips_saved,
+        std::uint64_t(remote_keys - remote_partitions));
+    HPX_TEST_EQ(c.size(), num_keys);
+
+    // the second access is served from the cache
+    c.reset_statistics();
+    result = c.get_values(hpx::launch::sync, keys);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+        HPX_TEST_EQ(result[i], double(keys[i]));
+
+    stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits, std::uint64_t(num_keys));
+    HPX_TEST_EQ(stats.misses, std::uint64_t(0));
+    HPX_TEST_EQ(stats.round_trips, std::uint64_t(0));
+    HPX_TEST_EQ(stats.round_trips_saved, std::uint64_t(remote_keys));
+
+    // nothing was modified, validation keeps all entries
+    c.validate(hpx::launch::sync);
+    HPX_TEST_EQ(c.get_statistics().invalidations, std::uint64_t(0));
+    HPX_TEST_EQ(c.size(), num_keys);
+
+    // writes through the cache keep the entries valid
+    c.set_value(hpx::launch::sync, 7, 42.0);
+    c.validate(hpx::launch::sync);
+    HPX_TEST_EQ(c.get_statistics().invalidations, std::uint64_t(0));
+    HPX_TEST_EQ(c.get_value(hpx::launch::sync, 7), 42.0);
+    HPX_TEST_EQ(m.get_value(hpx::launch::sync, 7), 42.0);
+
+    // modifying the map directly invalidates the partition on validation
+    m.set_value(hpx::launch::sync, 8, 43.0);
+    c.validate(hpx::launch::sync);
+    HPX_TEST_EQ(c.get_statistics().invalidations, std::uint64_t(1));
+    HPX_TEST_EQ(c.get_value(hpx::launch::sync, 8), 43.0);
+
+    // all other values are still correct
+    result = c.get_values(hpx::launch::sync, keys);
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        double expected = double(keys[i]);
+        if (keys[i] == 7)
+            expected = 42.0;
+        else if (keys[i] == 8)
+            expected = 43.0;
+        HPX_TEST_EQ(result[i], expected);
+    }
+
+    c.invalidate();
+    HPX_TEST_EQ(c.size(), std::size_t(0));
+}
+
+void test_batching_only(map_type& m)
+{
+    std::vector<std::size_t> keys = make_keys(0, num_keys);
+
+    // a cache with zero capacity does not store any values
+    cache_type c(m, 0);
+    c.get_values(hpx::launch::sync, keys);
+    c.get_values(hpx::launch::sync, keys);
+
+    hpx::unordered_map_cache_statistics stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits, std::uint64_t(0));
+    HPX_TEST_EQ(stats.misses, std::uint64_t(2 * num_keys));
+    HPX_TEST_EQ(c.size(), std::size_t(0));
+}
+
+int main()
+{
+    map_type m(hpx::container_layout(4, hpx::find_all_localities()));
+
+    test_bulk_operations(m);
+    test_cache(m);
+    test_batching_only(m);
+
+    return hpx::util::report_errors();
+}
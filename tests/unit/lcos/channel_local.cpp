@@ -5,6 +5,7 @@
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/apply.hpp>
+#include <hpx/include/async.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
@@ -325,6 +326,281 @@ void closed_channel_set1()
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void pingpong2()
+{
+    hpx::lcos::local::bounded_channel<std::string> pings(1);
+    hpx::lcos::local::bounded_channel<std::string> pongs(1);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        ping(pings, "passed message");
+        pong(pings, pongs);
+
+        std::string result = pongs.get(hpx::launch::sync);
+        HPX_TEST_EQ(std::string("passed message"), result);
+    }
+}
+
+// many producers and consumers sharing a channel which is much smaller than
+// the number of exchanged values, producers have to wait for free space
+void bounded_channel_producers_consumers()
+{
+    int const num_producers = 4;
+    int const num_consumers = 4;
+    int const num_values = 1000;
+
+    hpx::lcos::local::bounded_channel<int> c(4);
+
+    std::vector<hpx::future<void> > producers;
+    for (int p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async(
+            [c, p]() mutable
+            {
+                for (int i = 0; i != num_values; ++i)
+                    c.set(p * num_values + i);
+            }));
+    }
+
+    std::vector<hpx::future<long> > consumers;
+    for (int q = 0; q != num_consumers; ++q)
+    {
+        consumers.push_back(hpx::async(
+            [c]() -> long
+            {
+                long sum = 0;
+                for (int i = 0; i != num_producers * num_values / num_consumers;
+                     ++i)
+                {
+                    sum += c.get(hpx::launch::sync);
+                }
+                return sum;
+            }));
+    }
+
+    hpx::wait_all(producers);
+
+    long sum = 0;
+    for (auto& f : consumers)
+        sum += f.get();
+
+    long const count = long(num_producers) * num_values;
+    HPX_TEST_EQ(sum, count * (count - 1) / 2);
+}
+
+// stress a small channel with concurrent producers and consumers, a set
+// which finds its slot still claimed by a running get must not lose the
+// capacity it reserved
+void bounded_channel_stress()
+{
+    int const num_producers = 8;
+    int const num_consumers = 8;
+    int const num_values = 10000;
+
+    hpx::lcos::local::bounded_channel<int> c(4);
+
+    std::vector<hpx::future<void> > producers;
+    for (int p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async(
+            [c, p]() mutable
+            {
+                for (int i = 0; i != num_values; ++i)
+                    c.set(p * num_values + i);
+            }));
+    }
+
+    std::vector<hpx::future<long long> > consumers;
+    for (int q = 0; q != num_consumers; ++q)
+    {
+        consumers.push_back(hpx::async(
+            [c]() -> long long
+            {
+                long long sum = 0;
+                for (int i = 0; i != num_producers * num_values / num_consumers;
+                     ++i)
+                {
+                    sum += c.get(hpx::launch::sync);
+                }
+                return sum;
+            }));
+    }
+
+    hpx::wait_all(producers);
+
+    long long sum = 0;
+    for (auto& f : consumers)
+        sum += f.get();
+
+    long long const count = (long long)(num_producers) * num_values;
+    HPX_TEST_EQ(sum, count * (count - 1) / 2);
+
+    // the full capacity is still available, and not more than that
+    for (int i = 0; i != 4; ++i)
+        HPX_TEST(c.set(hpx::launch::async, i).is_ready());
+
+    hpx::future<void> f = c.set(hpx::launch::async, 4);
+    HPX_TEST(!f.is_ready());
+
+    for (int i = 0; i != 5; ++i)
+        HPX_TEST_EQ(c.get(hpx::launch::sync), i);
+    f.get();
+}
+
+void bounded_channel_async_set()
+{
+    hpx::lcos::local::bounded_channel<int> c(2);
+
+    // the third value does not fit, setting it completes once a value was
+    // retrieved
+    c.set(1);
+    c.set(2);
+    hpx::future<void> f = c.set(hpx::launch::async, 3);
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 1);
+    f.get();
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 2);
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 3);
+}
+
+void bounded_channel_capacity_one()
+{
+    hpx::lcos::local::bounded_channel<int> c(1);
+
+    // the channel holds exactly one value, the second one has to wait
+    c.set(1);
+    hpx::future<void> f = c.set(hpx::launch::async, 2);
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 1);
+    f.get();
+
+    hpx::future<void> f1 = c.set(hpx::launch::async, 3);
+    HPX_TEST(!f1.is_ready());
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 2);
+    f1.get();
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 3);
+}
+
+struct no_default_constructor
+{
+    explicit no_default_constructor(int value)
+      : value_(value)
+    {}
+
+    int value_;
+};
+
+void bounded_channel_no_default_constructor()
+{
+    hpx::lcos::local::bounded_channel<no_default_constructor> c(2);
+
+    c.set(no_default_constructor(1));
+    c.set(no_default_constructor(2));
+
+    // a getter waiting for a value
+    hpx::future<no_default_constructor> f1 = c.get();
+    HPX_TEST_EQ(f1.get().value_, 1);
+    HPX_TEST_EQ(c.get().get().value_, 2);
+
+    hpx::future<no_default_constructor> f2 = c.get();
+    HPX_TEST(!f2.is_ready());
+
+    c.set(no_default_constructor(3));
+    HPX_TEST_EQ(f2.get().value_, 3);
+}
+
+void bounded_channel_range()
+{
+    std::atomic<int> received_elements(0);
+
+    hpx::lcos::local::bounded_channel<std::string> queue(4);
+    queue.set("one");
+    queue.set("two");
+    queue.set("three");
+    queue.close();
+
+    for (auto const& elem : queue)
+    {
+        (void)elem;
+        ++received_elements;
+    }
+
+    HPX_TEST_EQ(received_elements.load(), 3);
+}
+
+void bounded_channel_range_void()
+{
+    std::atomic<int> received_elements(0);
+
+    hpx::lcos::local::bounded_channel<> queue(4);
+    queue.set();
+    queue.set();
+    queue.set();
+    queue.close();
+
+    for (auto const& elem : queue)
+    {
+        (void)elem;
+        ++received_elements;
+    }
+
+    HPX_TEST_EQ(received_elements.load(), 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void deadlock_test2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void)value;
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_get2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        c.close();
+
+        int value = c.get(hpx::launch::sync);
+        HPX_TEST(false);
+        (void)value;
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void closed_channel_set2()
+{
+    bool caught_exception = false;
+    try {
+        hpx::lcos::local::bounded_channel<int> c(4);
+        c.close();
+
+        c.set(42);
+        HPX_TEST(false);
+    }
+    catch(hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -346,5 +622,18 @@ int main(int argc, char* argv[])
     closed_channel_get1();
     closed_channel_set1();
 
+    pingpong2();
+    bounded_channel_producers_consumers();
+    bounded_channel_stress();
+    bounded_channel_async_set();
+    bounded_channel_capacity_one();
+    bounded_channel_no_default_constructor();
+    bounded_channel_range();
+    bounded_channel_range_void();
+
+    deadlock_test2();
+    closed_channel_get2();
+    closed_channel_set2();
+
     return hpx::util::report_errors();
 }
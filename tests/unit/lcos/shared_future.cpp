@@ -11,7 +11,9 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -1536,6 +1538,43 @@ void test_wait_for_three_out_of_five_futures()
     HPX_TEST(hpx::util::get<4>(result.futures).is_ready());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_continuations_attached_concurrently_run_once()
+{
+    std::size_t const num_continuations = 64;
+
+    hpx::lcos::local::promise<int> pt;
+    hpx::shared_future<int> f = pt.get_future().share();
+
+    std::atomic<std::size_t> invoked(0);
+    std::vector<hpx::future<void> > attachers;
+    std::vector<hpx::future<int> > continuations(num_continuations);
+
+    for (std::size_t i = 0; i != num_continuations; ++i)
+    {
+        attachers.push_back(hpx::async(
+            [&, i]()
+            {
+                continuations[i] = f.then(hpx::launch::sync,
+                    [&](hpx::shared_future<int> && f)
+                    {
+                        ++invoked;
+                        return f.get();
+                    });
+            }));
+
+        // make the value available while continuations are being attached
+        if (i == num_continuations / 2)
+            pt.set_value(42);
+    }
+
+    hpx::wait_all(attachers);
+    for (auto& c : continuations)
+        HPX_TEST_EQ(c.get(), 42);
+
+    HPX_TEST_EQ(invoked.load(), num_continuations);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using boost::program_options::variables_map;
 using boost::program_options::options_description;
@@ -1599,6 +1638,7 @@ int hpx_main(variables_map&)
         test_wait_for_all_five_futures();
         test_wait_for_two_out_of_five_futures();
         test_wait_for_three_out_of_five_futures();
+        test_continuations_attached_concurrently_run_once();
     }
 
     hpx::finalize();
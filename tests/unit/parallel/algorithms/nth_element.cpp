@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use a size which forces the parallel versions to actually split the work
+std::size_t const test_size = 300007;
+
+struct throw_always
+{
+    template <typename T1, typename T2>
+    bool operator()(T1 const&, T2 const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+std::vector<int> make_data(int value_range)
+{
+    std::uniform_int_distribution<> dis(0, value_range - 1);
+
+    std::vector<int> c(test_size);
+    for (auto& v : c)
+        v = dis(gen);
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Comp = std::less<int> >
+void test_nth_element(ExPolicy policy, int value_range, Comp comp = Comp())
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(value_range);
+    std::vector<int> d = c;
+
+    std::uniform_int_distribution<std::size_t> dis(0, test_size - 1);
+    std::size_t n = dis(gen);
+
+    auto result = hpx::parallel::nth_element(policy,
+        std::begin(c), std::begin(c) + n, std::end(c), comp);
+    std::nth_element(std::begin(d), std::begin(d) + n, std::end(d), comp);
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST_EQ(c[n], d[n]);
+    HPX_TEST(std::none_of(std::begin(c), std::begin(c) + n,
+        [&](int v) { return comp(c[n], v); }));
+    HPX_TEST(std::none_of(std::begin(c) + n, std::end(c),
+        [&](int v) { return comp(v, c[n]); }));
+}
+
+template <typename ExPolicy>
+void test_nth_element_async(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d = c;
+
+    std::size_t n = test_size / 3;
+
+    auto f = hpx::parallel::nth_element(policy,
+        std::begin(c), std::begin(c) + n, std::end(c));
+    std::nth_element(std::begin(d), std::begin(d) + n, std::end(d));
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST_EQ(c[n], d[n]);
+}
+
+template <typename ExPolicy>
+void test_nth_element_exception(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(1000);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::nth_element(policy, std::begin(c),
+            std::begin(c) + test_size / 2, std::end(c), throw_always());
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy,
+            std::random_access_iterator_tag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void nth_element_test()
+{
+    using namespace hpx::parallel;
+
+    test_nth_element(execution::seq, 10007);
+    test_nth_element(execution::par, 10007);
+    test_nth_element(execution::par_unseq, 10007);
+
+    // many duplicates
+    test_nth_element(execution::seq, 3);
+    test_nth_element(execution::par, 3);
+    test_nth_element(execution::par_unseq, 3);
+
+    test_nth_element(execution::seq, 10007, std::greater<int>());
+    test_nth_element(execution::par, 10007, std::greater<int>());
+
+    test_nth_element_async(execution::seq(execution::task));
+    test_nth_element_async(execution::par(execution::task));
+
+    test_nth_element_exception(execution::seq);
+    test_nth_element_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    nth_element_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
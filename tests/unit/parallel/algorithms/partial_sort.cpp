@@ -0,0 +1,201 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use a size which forces the parallel versions to actually split the work
+std::size_t const test_size = 300007;
+
+struct throw_always
+{
+    template <typename T1, typename T2>
+    bool operator()(T1 const&, T2 const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+std::vector<int> make_data(int value_range)
+{
+    std::uniform_int_distribution<> dis(0, value_range - 1);
+
+    std::vector<int> c(test_size);
+    for (auto& v : c)
+        v = dis(gen);
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Comp = std::less<int> >
+void test_partial_sort(ExPolicy policy, std::size_t n, Comp comp = Comp())
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d = c;
+
+    auto result = hpx::parallel::partial_sort(policy,
+        std::begin(c), std::begin(c) + n, std::end(c), comp);
+    std::partial_sort(std::begin(d), std::begin(d) + n, std::end(d), comp);
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + n, std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy policy, std::size_t n)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> d = c;
+
+    auto f = hpx::parallel::partial_sort(policy,
+        std::begin(c), std::begin(c) + n, std::end(c));
+    std::partial_sort(std::begin(d), std::begin(d) + n, std::end(d));
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(std::equal(std::begin(c), std::begin(c) + n, std::begin(d)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy policy, std::size_t n)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(10007);
+    std::vector<int> const orig = c;
+
+    std::vector<int> dest(n), solution(n);
+
+    auto result = hpx::parallel::partial_sort_copy(policy,
+        std::begin(c), std::end(c), std::begin(dest), std::end(dest));
+    auto solution_end = std::partial_sort_copy(
+        std::begin(c), std::end(c), std::begin(solution), std::end(solution));
+
+    HPX_TEST(c == orig);
+    HPX_TEST(std::distance(std::begin(dest), result) ==
+        std::distance(std::begin(solution), solution_end));
+    HPX_TEST(std::equal(std::begin(dest), result, std::begin(solution)));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_exception(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c = make_data(1000);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::partial_sort(policy, std::begin(c),
+            std::begin(c) + 100, std::end(c), throw_always());
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy,
+            std::random_access_iterator_tag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void partial_sort_test()
+{
+    using namespace hpx::parallel;
+
+    test_partial_sort(execution::seq, 100);
+    test_partial_sort(execution::par, 100);
+    test_partial_sort(execution::par_unseq, 100);
+
+    // the sorted part is large enough to be sorted in parallel as well
+    test_partial_sort(execution::seq, test_size / 2);
+    test_partial_sort(execution::par, test_size / 2);
+    test_partial_sort(execution::par, test_size);
+
+    test_partial_sort(execution::seq, 1000, std::greater<int>());
+    test_partial_sort(execution::par, 1000, std::greater<int>());
+
+    test_partial_sort_async(execution::seq(execution::task), 1000);
+    test_partial_sort_async(execution::par(execution::task), 1000);
+
+    test_partial_sort_copy(execution::seq, 1000);
+    test_partial_sort_copy(execution::par, 1000);
+    test_partial_sort_copy(execution::par, 2 * test_size);
+
+    test_partial_sort_exception(execution::seq);
+    test_partial_sort_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,250 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use a size which is large enough to make sort() use the radix sort
+std::size_t const test_size = 300007;
+
+///////////////////////////////////////////////////////////////////////////////
+// the radix sort has to be selected for arithmetic keys only
+using hpx::parallel::v1::detail::use_radix_sort;
+using hpx::parallel::v1::detail::less;
+using hpx::parallel::util::projection_identity;
+
+typedef std::vector<int>::iterator int_iterator;
+typedef std::vector<std::string>::iterator string_iterator;
+
+static_assert(
+    use_radix_sort<int_iterator, less, projection_identity>::value,
+    "use_radix_sort<int_iterator, less, projection_identity>::value");
+static_assert(
+    use_radix_sort<int_iterator, std::less<int>, projection_identity>::value,
+    "use_radix_sort<int_iterator, std::less<int>, projection_identity>::value");
+static_assert(
+    !use_radix_sort<
+        int_iterator, std::greater<int>, projection_identity
+    >::value,
+    "!use_radix_sort<int_iterator, std::greater<int>, projection_identity>");
+static_assert(
+    !use_radix_sort<string_iterator, less, projection_identity>::value,
+    "!use_radix_sort<string_iterator, less, projection_identity>::value");
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T> >::type
+make_keys()
+{
+    std::uniform_int_distribution<T> dis(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> c(test_size);
+    for (auto& v : c)
+        v = dis(gen);
+    return c;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T> >::type
+make_keys()
+{
+    std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+
+    std::vector<T> c(test_size);
+    for (auto& v : c)
+        v = dis(gen);
+
+    // make sure special values end up in their place as well
+    c[0] = T(0);
+    c[1] = -T(0);
+    c[2] = std::numeric_limits<T>::infinity();
+    c[3] = -std::numeric_limits<T>::infinity();
+    c[4] = (std::numeric_limits<T>::max)();
+    c[5] = std::numeric_limits<T>::lowest();
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy>
+void test_sort_radix(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<T> c = make_keys<T>();
+    std::vector<T> d = c;
+
+    auto result = hpx::parallel::sort(policy, std::begin(c), std::end(c));
+    std::sort(std::begin(d), std::end(d));
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(c == d);
+}
+
+template <typename T, typename ExPolicy>
+void test_sort_radix_async(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<T> c = make_keys<T>();
+    std::vector<T> d = c;
+
+    auto f = hpx::parallel::sort(policy, std::begin(c), std::end(c),
+        std::less<T>());
+    std::sort(std::begin(d), std::end(d));
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(c == d);
+}
+
+struct element
+{
+    element() = default;
+    element(std::int64_t key, std::size_t index) : key(key), index(index) {}
+
+    std::int64_t key;
+    std::size_t index;
+};
+
+template <typename ExPolicy>
+void test_sort_radix_proj(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::int64_t> keys = make_keys<std::int64_t>();
+
+    std::vector<element> c;
+    c.reserve(test_size);
+    for (std::size_t i = 0; i != test_size; ++i)
+        c.push_back(element(keys[i], i));
+
+    hpx::parallel::sort(policy, std::begin(c), std::end(c),
+        std::less<std::int64_t>(), &element::key);
+
+    // every element has to be moved as a whole
+    for (std::size_t i = 0; i != test_size; ++i)
+        HPX_TEST_EQ(c[i].key, keys[c[i].index]);
+
+    std::sort(std::begin(keys), std::end(keys));
+    for (std::size_t i = 0; i != test_size; ++i)
+        HPX_TEST_EQ(c[i].key, keys[i]);
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_radix(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> keys = make_keys<int>();
+
+    // the values remember the key they belong to
+    std::vector<long long> values(test_size);
+    std::transform(std::begin(keys), std::end(keys), std::begin(values),
+        [](int key) { return -static_cast<long long>(key); });
+
+    hpx::parallel::sort_by_key(policy, std::begin(keys), std::end(keys),
+        std::begin(values));
+
+    HPX_TEST(std::is_sorted(std::begin(keys), std::end(keys)));
+    for (std::size_t i = 0; i != test_size; ++i)
+        HPX_TEST_EQ(values[i], -static_cast<long long>(keys[i]));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_sort_radix()
+{
+    using namespace hpx::parallel;
+
+    test_sort_radix<T>(execution::par);
+    test_sort_radix<T>(execution::par_unseq);
+
+    test_sort_radix_async<T>(execution::par(execution::task));
+}
+
+void sort_radix_test()
+{
+    using namespace hpx::parallel;
+
+    test_sort_radix<std::int16_t>();
+    test_sort_radix<std::uint16_t>();
+    test_sort_radix<int>();
+    test_sort_radix<unsigned int>();
+    test_sort_radix<std::int64_t>();
+    test_sort_radix<std::uint64_t>();
+    test_sort_radix<float>();
+    test_sort_radix<double>();
+
+    test_sort_radix_proj(execution::par);
+    test_sort_radix_proj(execution::par_unseq);
+
+    test_sort_by_key_radix(execution::par);
+    test_sort_by_key_radix(execution::par_unseq);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    sort_radix_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
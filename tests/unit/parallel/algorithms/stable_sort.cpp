@@ -0,0 +1,242 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use a size which forces the parallel versions to actually split the work
+std::size_t const test_size = 300007;
+
+struct throw_always
+{
+    template <typename T1, typename T2>
+    bool operator()(T1 const&, T2 const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+struct element
+{
+    element() = default;
+    element(int key, std::size_t index) : key(key), index(index) {}
+
+    int key;
+    std::size_t index;
+};
+
+std::vector<element> make_elements(int key_range)
+{
+    std::uniform_int_distribution<> dis(0, key_range - 1);
+
+    std::vector<element> c;
+    c.reserve(test_size);
+    for (std::size_t i = 0; i != test_size; ++i)
+        c.push_back(element(dis(gen), i));
+    return c;
+}
+
+// every group of equal keys has to keep its original order
+bool is_stably_sorted(std::vector<element> const& c)
+{
+    for (std::size_t i = 1; i < c.size(); ++i)
+    {
+        if (c[i].key < c[i - 1].key)
+            return false;
+        if (c[i].key == c[i - 1].key && c[i].index < c[i - 1].index)
+            return false;
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    // a small key range produces plenty of equivalent elements
+    std::vector<element> c = make_elements(100);
+
+    auto result = hpx::parallel::stable_sort(policy,
+        std::begin(c), std::end(c),
+        [](element const& lhs, element const& rhs)
+        {
+            return lhs.key < rhs.key;
+        });
+
+    HPX_TEST(result == std::end(c));
+    HPX_TEST(is_stably_sorted(c));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_proj(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> c = make_elements(1000);
+
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        std::less<int>(), &element::key);
+
+    HPX_TEST(is_stably_sorted(c));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> c = make_elements(100);
+
+    auto f = hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+        std::less<int>(), &element::key);
+
+    HPX_TEST(f.get() == std::end(c));
+    HPX_TEST(is_stably_sorted(c));
+}
+
+template <typename ExPolicy>
+void test_stable_sort_strings(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::uniform_int_distribution<> dis(0, 9999);
+
+    std::vector<std::string> c(test_size);
+    for (auto& s : c)
+        s = std::to_string(dis(gen));
+
+    std::vector<std::string> d = c;
+
+    // compare by length only, strings are not default ordered this way
+    auto comp = [](std::string const& lhs, std::string const& rhs)
+        {
+            return lhs.size() < rhs.size();
+        };
+
+    hpx::parallel::stable_sort(policy, std::begin(c), std::end(c), comp);
+    std::stable_sort(std::begin(d), std::end(d), comp);
+
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    std::vector<int> c(test_size);
+    std::iota(std::begin(c), std::end(c), 0);
+    std::shuffle(std::begin(c), std::end(c), gen);
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::stable_sort(policy, std::begin(c), std::end(c),
+            throw_always());
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy,
+            std::random_access_iterator_tag>::call(policy, e);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort(execution::seq);
+    test_stable_sort(execution::par);
+    test_stable_sort(execution::par_unseq);
+
+    test_stable_sort_proj(execution::seq);
+    test_stable_sort_proj(execution::par);
+    test_stable_sort_proj(execution::par_unseq);
+
+    test_stable_sort_async(execution::seq(execution::task));
+    test_stable_sort_async(execution::par(execution::task));
+
+    test_stable_sort_strings(execution::seq);
+    test_stable_sort_strings(execution::par);
+
+    test_stable_sort_exception(execution::seq);
+    test_stable_sort_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    stable_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
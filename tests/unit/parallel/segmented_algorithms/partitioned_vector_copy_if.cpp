@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_copy.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return int(val) % 2 != 0;
+    }
+};
+
+struct is_large
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return int(val) >= 240;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T((i * 7919) % 251);
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+// only the first count elements are compared
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v,
+    std::vector<T> const& expected, std::size_t count)
+{
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin();
+    for (std::size_t i = 0; i != count; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void copy_if_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+
+    std::vector<T> values = fill_vector(c);
+    std::vector<T> expected;
+    std::copy_if(values.begin(), values.end(), std::back_inserter(expected),
+        is_odd());
+
+    auto result = hpx::parallel::copy_if(copy_policy,
+        c.begin(), c.end(), d.begin(), is_odd());
+    HPX_TEST(result.in() == c.end());
+    HPX_TEST(result.out() == d.begin() + expected.size());
+    verify_vector(d, expected, expected.size());
+
+    // the source range is not modified
+    verify_vector(c, values, size);
+
+    // most elements are not copied, the destination has a different layout
+    hpx::partitioned_vector<T> e(size, hpx::container_layout(2));
+
+    expected.clear();
+    std::copy_if(values.begin(), values.end(), std::back_inserter(expected),
+        is_large());
+
+    result = hpx::parallel::copy_if(copy_policy,
+        c.begin(), c.end(), e.begin(), is_large());
+    HPX_TEST(result.out() == e.begin() + expected.size());
+    verify_vector(e, expected, expected.size());
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void copy_if_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+
+    std::vector<T> values = fill_vector(c);
+    std::vector<T> expected;
+    std::copy_if(values.begin(), values.end(), std::back_inserter(expected),
+        is_odd());
+
+    auto f = hpx::parallel::copy_if(copy_policy,
+        c.begin(), c.end(), d.begin(), is_odd());
+    HPX_TEST(f.get().out() == d.begin() + expected.size());
+    verify_vector(d, expected, expected.size());
+}
+
+template <typename T, typename DistPolicy>
+void copy_if_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    copy_if_algo_tests_with_policy<T>(size, policy, seq);
+    copy_if_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    copy_if_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    copy_if_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void copy_if_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    copy_if_tests_with_policy<T>(length, hpx::container_layout);
+    copy_if_tests_with_policy<T>(length, hpx::container_layout(3));
+    copy_if_tests_with_policy<T>(length,
+        hpx::container_layout(3, localities));
+    copy_if_tests_with_policy<T>(length,
+        hpx::container_layout(localities));
+    copy_if_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    copy_if_tests<double>();
+    copy_if_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,158 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_merge.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// fills the vector with sorted values, lots of duplicates
+template <typename T, typename Comp>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v, Comp comp)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        values.push_back(T((i * 7919) % 251));
+    }
+    std::sort(values.begin(), values.end(), comp);
+
+    typename hpx::partitioned_vector<T>::iterator it = v.begin();
+    for (std::size_t i = 0; i != values.size(); ++it, ++i)
+    {
+        *it = values[i];
+    }
+    return values;
+}
+
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v,
+    std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+        end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void merge_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& merge_policy)
+{
+    std::size_t size1 = size / 3;
+    std::size_t size2 = size - size1;
+
+    hpx::partitioned_vector<T> c1(size1, policy);
+    hpx::partitioned_vector<T> c2(size2, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+
+    std::vector<T> values1 = fill_vector(c1, std::less<T>());
+    std::vector<T> values2 = fill_vector(c2, std::less<T>());
+
+    std::vector<T> expected(size);
+    std::merge(values1.begin(), values1.end(), values2.begin(),
+        values2.end(), expected.begin());
+
+    auto result = hpx::parallel::merge(merge_policy, c1.begin(), c1.end(),
+        c2.begin(), c2.end(), d.begin());
+    HPX_TEST(result.in1() == c1.end());
+    HPX_TEST(result.in2() == c2.end());
+    HPX_TEST(result.out() == d.end());
+    verify_vector(d, expected);
+
+    // merging in descending order into a differently partitioned vector
+    hpx::partitioned_vector<T> e(size, hpx::container_layout(2));
+
+    values1 = fill_vector(c1, std::greater<T>());
+    values2 = fill_vector(c2, std::greater<T>());
+    std::merge(values1.begin(), values1.end(), values2.begin(),
+        values2.end(), expected.begin(), std::greater<T>());
+
+    result = hpx::parallel::merge(merge_policy, c1.begin(), c1.end(),
+        c2.begin(), c2.end(), e.begin(), std::greater<T>());
+    HPX_TEST(result.out() == e.end());
+    verify_vector(e, expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void merge_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& merge_policy)
+{
+    std::size_t size1 = size / 3;
+    std::size_t size2 = size - size1;
+
+    hpx::partitioned_vector<T> c1(size1, policy);
+    hpx::partitioned_vector<T> c2(size2, policy);
+    hpx::partitioned_vector<T> d(size, policy);
+
+    std::vector<T> values1 = fill_vector(c1, std::less<T>());
+    std::vector<T> values2 = fill_vector(c2, std::less<T>());
+
+    std::vector<T> expected(size);
+    std::merge(values1.begin(), values1.end(), values2.begin(),
+        values2.end(), expected.begin());
+
+    auto f = hpx::parallel::merge(merge_policy, c1.begin(), c1.end(),
+        c2.begin(), c2.end(), d.begin());
+    HPX_TEST(f.get().out() == d.end());
+    verify_vector(d, expected);
+}
+
+template <typename T, typename DistPolicy>
+void merge_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    merge_algo_tests_with_policy<T>(size, policy, seq);
+    merge_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    merge_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    merge_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void merge_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    merge_tests_with_policy<T>(length, hpx::container_layout);
+    merge_tests_with_policy<T>(length, hpx::container_layout(3));
+    merge_tests_with_policy<T>(length,
+        hpx::container_layout(3, localities));
+    merge_tests_with_policy<T>(length,
+        hpx::container_layout(localities));
+    merge_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    merge_tests<double>();
+    merge_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,149 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_partition.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return int(val) % 2 != 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T((i * 7919) % 251);
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_partition(hpx::partitioned_vector<T> const& v,
+    std::vector<T> expected, std::size_t count)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::vector<T> values;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+        end = v.end();
+    for (std::size_t i = 0; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(is_odd()(*it), i < count);
+        values.push_back(*it);
+    }
+
+    // the elements are a permutation of the original ones
+    std::sort(values.begin(), values.end());
+    std::sort(expected.begin(), expected.end());
+    HPX_TEST(values == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void partition_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& partition_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::count_if(expected.begin(), expected.end(),
+        is_odd());
+
+    iterator result = hpx::parallel::partition(partition_policy,
+        c.begin(), c.end(), is_odd());
+    HPX_TEST(result == c.begin() + count);
+    verify_partition(c, expected, count);
+
+    // partitioning a partitioned sequence does not move any elements
+    result = hpx::parallel::partition(partition_policy,
+        c.begin(), c.end(), is_odd());
+    HPX_TEST(result == c.begin() + count);
+    verify_partition(c, expected, count);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void partition_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& partition_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::count_if(expected.begin(), expected.end(),
+        is_odd());
+
+    hpx::future<iterator> f = hpx::parallel::partition(partition_policy,
+        c.begin(), c.end(), is_odd());
+    HPX_TEST(f.get() == c.begin() + count);
+    verify_partition(c, expected, count);
+}
+
+template <typename T, typename DistPolicy>
+void partition_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    partition_algo_tests_with_policy<T>(size, policy, seq);
+    partition_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    partition_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    partition_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void partition_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    partition_tests_with_policy<T>(length, hpx::container_layout);
+    partition_tests_with_policy<T>(length, hpx::container_layout(3));
+    partition_tests_with_policy<T>(length,
+        hpx::container_layout(3, localities));
+    partition_tests_with_policy<T>(length,
+        hpx::container_layout(localities));
+    partition_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    partition_tests<double>();
+    partition_tests<int>();
+
+    return hpx::util::report_errors();
+}
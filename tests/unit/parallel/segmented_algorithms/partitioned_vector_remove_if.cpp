@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_remove.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return int(val) % 2 != 0;
+    }
+};
+
+struct is_small
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return int(val) < 240;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T((i * 7919) % 251);
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+// only the first count elements are compared
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v,
+    std::vector<T> const& expected, std::size_t count)
+{
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin();
+    for (std::size_t i = 0; i != count; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void remove_if_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& remove_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::distance(expected.begin(),
+        std::remove_if(expected.begin(), expected.end(), is_odd()));
+
+    iterator result = hpx::parallel::remove_if(remove_policy,
+        c.begin(), c.end(), is_odd());
+    HPX_TEST(result == c.begin() + count);
+    verify_vector(c, expected, count);
+
+    // most elements are removed
+    expected = fill_vector(c);
+    count = std::distance(expected.begin(),
+        std::remove_if(expected.begin(), expected.end(), is_small()));
+
+    result = hpx::parallel::remove_if(remove_policy,
+        c.begin(), c.end(), is_small());
+    HPX_TEST(result == c.begin() + count);
+    verify_vector(c, expected, count);
+
+    // nothing is removed
+    expected = fill_vector(c);
+    result = hpx::parallel::remove(remove_policy, c.begin(), c.end(), T(-1));
+    HPX_TEST(result == c.end());
+    verify_vector(c, expected, size);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void remove_if_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& remove_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::distance(expected.begin(),
+        std::remove_if(expected.begin(), expected.end(), is_odd()));
+
+    hpx::future<iterator> f = hpx::parallel::remove_if(remove_policy,
+        c.begin(), c.end(), is_odd());
+    HPX_TEST(f.get() == c.begin() + count);
+    verify_vector(c, expected, count);
+}
+
+template <typename T, typename DistPolicy>
+void remove_if_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    remove_if_algo_tests_with_policy<T>(size, policy, seq);
+    remove_if_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    remove_if_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    remove_if_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void remove_if_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    remove_if_tests_with_policy<T>(length, hpx::container_layout);
+    remove_if_tests_with_policy<T>(length, hpx::container_layout(3));
+    remove_if_tests_with_policy<T>(length,
+        hpx::container_layout(3, localities));
+    remove_if_tests_with_policy<T>(length,
+        hpx::container_layout(localities));
+    remove_if_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    remove_if_tests<double>();
+    remove_if_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_sort.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        // lots of duplicates, no particular order
+        T val = T((i * 7919) % 251);
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v,
+    std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+        end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(std::size_t size, DistPolicy const& policy,
+    ExPolicy const& sort_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::sort(expected.begin(), expected.end());
+
+    iterator result = hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    verify_vector(c, expected);
+
+    // sorting a sorted sequence does not change it
+    hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    verify_vector(c, expected);
+
+    expected = fill_vector(c);
+    std::sort(expected.begin() + 1, expected.end() - 1, std::greater<T>());
+
+    result = hpx::parallel::sort(sort_policy, c.begin() + 1, c.end() - 1,
+        std::greater<T>());
+    HPX_TEST(result == c.end() - 1);
+    verify_vector(c, expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::sort(expected.begin(), expected.end());
+
+    hpx::future<iterator> f =
+        hpx::parallel::sort(sort_policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    verify_vector(c, expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    sort_algo_tests_with_policy<T>(size, policy, seq);
+    sort_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    sort_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    sort_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+    sort_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
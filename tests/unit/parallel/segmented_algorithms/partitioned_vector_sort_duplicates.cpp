@@ -0,0 +1,200 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+std::size_t const num_partitions = 32;
+std::size_t const partition_size = 100;
+
+// only a handful of distinct keys spread over all partitions
+int make_key(std::size_t i, std::size_t num_keys)
+{
+    return static_cast<int>((i * 7) % num_keys);
+}
+
+void verify_vector(hpx::partitioned_vector<int> const& v,
+    std::vector<int> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    hpx::partitioned_vector<int>::const_iterator it = v.begin(),
+        end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void sort_duplicates_test(ExPolicy const& policy, std::size_t num_keys)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::partitioned_vector<int> c(num_partitions * partition_size,
+        hpx::container_layout(num_partitions, localities));
+
+    std::vector<int> expected;
+    expected.reserve(c.size());
+
+    std::size_t i = 0;
+    for (auto it = c.begin(); it != c.end(); ++it, ++i)
+    {
+        *it = make_key(i, num_keys);
+        expected.push_back(*it);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    verify_vector(c, expected);
+}
+
+template <typename ExPolicy>
+void merge_duplicates_test(ExPolicy const& policy, std::size_t num_keys)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    std::size_t size = num_partitions * partition_size;
+
+    hpx::partitioned_vector<int> c1(size / 2,
+        hpx::container_layout(num_partitions / 2, localities));
+    hpx::partitioned_vector<int> c2(size - size / 2,
+        hpx::container_layout(num_partitions / 2, localities));
+    hpx::partitioned_vector<int> d(size,
+        hpx::container_layout(num_partitions, localities));
+
+    std::vector<int> values1, values2;
+    for (std::size_t i = 0; i != c1.size(); ++i)
+        values1.push_back(make_key(i, num_keys));
+    for (std::size_t i = 0; i != c2.size(); ++i)
+        values2.push_back(make_key(i, num_keys));
+    std::sort(values1.begin(), values1.end());
+    std::sort(values2.begin(), values2.end());
+
+    auto it1 = c1.begin();
+    for (std::size_t i = 0; i != values1.size(); ++it1, ++i)
+        *it1 = values1[i];
+    auto it2 = c2.begin();
+    for (std::size_t i = 0; i != values2.size(); ++it2, ++i)
+        *it2 = values2[i];
+
+    std::vector<int> expected(size);
+    std::merge(values1.begin(), values1.end(), values2.begin(),
+        values2.end(), expected.begin());
+
+    auto result = hpx::parallel::merge(policy, c1.begin(), c1.end(),
+        c2.begin(), c2.end(), d.begin());
+    HPX_TEST(result.out() == d.end());
+    verify_vector(d, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Divide locally stored segments into classes the same way the segmented
+// sort does and verify that no destination has to fetch much more data than
+// it keeps, even if most of the elements are equivalent.
+void class_balance_test(std::size_t num_keys)
+{
+    namespace detail = hpx::parallel::v1::detail;
+
+    typedef std::vector<int>::iterator iterator;
+    typedef hpx::parallel::util::projection_identity proj_type;
+
+    std::vector<std::vector<int> > segments(num_partitions);
+    std::vector<detail::segment_range<iterator> > ranges;
+    ranges.reserve(num_partitions);
+
+    std::size_t num_classes =
+        detail::exchange_classes_per_segment * num_partitions;
+
+    std::vector<detail::exchange_sample<int> > samples;
+    for (std::size_t s = 0; s != num_partitions; ++s)
+    {
+        std::vector<int>& data = segments[s];
+        for (std::size_t i = 0; i != partition_size; ++i)
+            data.push_back(make_key(s * partition_size + i, num_keys));
+        std::sort(data.begin(), data.end());
+
+        ranges.push_back(detail::segment_range<iterator>{
+            hpx::invalid_id, data.begin(), data.size()});
+
+        std::vector<detail::exchange_sample<int> > s_samples =
+            detail::get_regular_samples<int>(
+                data.begin(), data.end(), num_classes, s);
+        samples.insert(samples.end(), s_samples.begin(), s_samples.end());
+    }
+
+    detail::sort_samples(samples, std::less<int>(), proj_type());
+    std::vector<detail::exchange_sample<int> > splitters =
+        detail::get_splitters(samples, num_classes);
+
+    std::vector<std::vector<std::size_t> > bounds;
+    for (std::size_t s = 0; s != num_partitions; ++s)
+    {
+        bounds.push_back(detail::segment_class_bounds::sequential(
+            hpx::parallel::execution::seq, segments[s].begin(),
+            segments[s].end(), splitters, s, std::less<int>(), proj_type(),
+            proj_type()));
+    }
+
+    std::vector<detail::segment_destination<iterator, iterator> >
+        destinations(ranges.begin(), ranges.end());
+
+    detail::add_class_slices(destinations, ranges, bounds,
+        std::vector<detail::segment_range<iterator> >(),
+        std::vector<std::vector<std::size_t> >(), splitters.size() + 1);
+
+    // every element is kept by exactly one destination and no destination
+    // fetches more than three times the amount of data it keeps
+    std::size_t kept = 0;
+    for (auto const& d : destinations)
+    {
+        std::size_t fetched = 0;
+        for (auto const& slice : d.slices1_)
+            fetched += slice.count_;
+
+        HPX_TEST_EQ(d.count_, partition_size);
+        HPX_TEST_LTE(d.skip_ + d.count_, fetched);
+        HPX_TEST_LTE(fetched, 3 * partition_size);
+
+        kept += d.count_;
+    }
+    HPX_TEST_EQ(kept, num_partitions * partition_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    using namespace hpx::parallel::execution;
+
+    for (std::size_t num_keys : {1, 2, 3, 5})
+    {
+        sort_duplicates_test(seq, num_keys);
+        sort_duplicates_test(par, num_keys);
+
+        merge_duplicates_test(seq, num_keys);
+        merge_duplicates_test(par, num_keys);
+
+        class_balance_test(num_keys);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,149 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/parallel_unique.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+struct equal_parity
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return int(lhs) % 2 == int(rhs) % 2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T((i / 5) % 3 + (i / 15) % 4);
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+// only the first count elements are compared
+template <typename T>
+void verify_vector(hpx::partitioned_vector<T> const& v,
+    std::vector<T> const& expected, std::size_t count)
+{
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin();
+    for (std::size_t i = 0; i != count; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& unique_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::distance(expected.begin(),
+        std::unique(expected.begin(), expected.end()));
+
+    iterator result = hpx::parallel::unique(unique_policy,
+        c.begin(), c.end());
+    HPX_TEST(result == c.begin() + count);
+    verify_vector(c, expected, count);
+
+    // the remaining elements are unique already
+    result = hpx::parallel::unique(unique_policy, c.begin(), result);
+    HPX_TEST(result == c.begin() + count);
+    verify_vector(c, expected, count);
+
+    // using a predicate
+    expected = fill_vector(c);
+    count = std::distance(expected.begin(),
+        std::unique(expected.begin(), expected.end(), equal_parity()));
+
+    result = hpx::parallel::unique(unique_policy,
+        c.begin(), c.end(), equal_parity());
+    HPX_TEST(result == c.begin() + count);
+    verify_vector(c, expected, count);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& unique_policy)
+{
+    typedef typename hpx::partitioned_vector<T>::iterator iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+
+    std::vector<T> expected = fill_vector(c);
+    std::size_t count = std::distance(expected.begin(),
+        std::unique(expected.begin(), expected.end()));
+
+    hpx::future<iterator> f = hpx::parallel::unique(unique_policy,
+        c.begin(), c.end());
+    HPX_TEST(f.get() == c.begin() + count);
+    verify_vector(c, expected, count);
+}
+
+template <typename T, typename DistPolicy>
+void unique_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    unique_algo_tests_with_policy<T>(size, policy, seq);
+    unique_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    unique_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    unique_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void unique_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    unique_tests_with_policy<T>(length, hpx::container_layout);
+    unique_tests_with_policy<T>(length, hpx::container_layout(3));
+    unique_tests_with_policy<T>(length,
+        hpx::container_layout(3, localities));
+    unique_tests_with_policy<T>(length,
+        hpx::container_layout(localities));
+    unique_tests_with_policy<T>(7, hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    unique_tests<double>();
+    unique_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -224,6 +224,9 @@ int hpx_main(boost::program_options::variables_map& vm)
         // compare number of parcels with number of messages generated
         print_counters("/parcels/count/*/sent");
         print_counters("/messages/count/*/sent");
+
+        // number of threads involved in serializing the messages
+        print_counters("/serialize/threads/*/sent");
     }
 #endif
 
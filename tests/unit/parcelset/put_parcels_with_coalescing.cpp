@@ -253,6 +253,8 @@ int hpx_main(boost::program_options::variables_map& vm)
     print_counters("/coalescing{locality#0/total}/count/parcels@test2_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
+    print_counters("/coalescing{locality#0/total}/count/"
+        "parcels-per-message-limit@test1_action");
 
     return hpx::finalize();
 }
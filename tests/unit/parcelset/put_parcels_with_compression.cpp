@@ -68,6 +68,10 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test1_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test1_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test1_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test1_action)
+#elif defined(HPX_HAVE_COMPRESSION_ZSTD)
+HPX_ACTION_USES_ZSTD_COMPRESSION(test1_action)
 #endif
 
 HPX_REGISTER_ACTION(test1_action);
@@ -123,6 +127,10 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test2_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test2_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test2_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test2_action)
+#elif defined(HPX_HAVE_COMPRESSION_ZSTD)
+HPX_ACTION_USES_ZSTD_COMPRESSION(test2_action)
 #endif
 
 HPX_PLAIN_ACTION(test2, test2_action);
@@ -272,6 +280,23 @@ void verify_counters()
             << ", value: " << data_value.get_value<double>()
             << std::endl;
     }
+
+    // the filters must have been invoked for at least some of the messages
+    std::vector<performance_counter> compression_counters =
+        discover_counters("/compression/time/*/*");
+
+    double compression_time = 0;
+    for (performance_counter const& counter : compression_counters)
+    {
+        counter_value value = counter.get_counter_value(hpx::launch::sync);
+        compression_time += value.get_value<double>();
+
+        hpx::cout
+            << "counter: " << counter.get_name(hpx::launch::sync)
+            << ", value: " << value.get_value<double>()
+            << std::endl;
+    }
+    HPX_TEST(compression_time > 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
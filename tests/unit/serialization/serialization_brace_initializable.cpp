@@ -9,6 +9,9 @@
 #include <hpx/include/serialization.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -66,6 +69,87 @@ bool operator==(const B& b1, const B& b2)
         == std::tie(b2.a, b2.sign);
 }
 
+enum class color : std::uint16_t
+{
+    red = 0x0102,
+    green = 0x0304
+};
+
+struct C
+{
+    double floating_number;
+    std::int32_t int_number;
+    std::array<float, 3> floats;
+    color col;
+    char sign;
+};
+
+static_assert(hpx::traits::detail::arity<C>().value == 5,
+    "hpx::traits::detail::arity<C>() == size<5>{}");
+static_assert(hpx::serialization::detail::struct_layout<C>::is_bitwise,
+    "struct_layout<C>::is_bitwise");
+static_assert(hpx::serialization::detail::is_bitwise_struct<C>::value,
+    "is_bitwise_struct<C>::value");
+static_assert(!hpx::serialization::detail::struct_layout<A>::is_bitwise,
+    "!struct_layout<A>::is_bitwise");
+static_assert(!hpx::serialization::detail::struct_layout<B>::is_bitwise,
+    "!struct_layout<B>::is_bitwise");
+
+bool operator==(const C& c1, const C& c2)
+{
+    return std::tie(c1.floating_number, c1.int_number, c1.floats, c1.col,
+            c1.sign)
+        == std::tie(c2.floating_number, c2.int_number, c2.floats, c2.col,
+            c2.sign);
+}
+
+void test_bitwise(std::uint32_t flags)
+{
+    std::size_t const n = 1000;
+
+    {
+        std::vector<char> buf;
+        hpx::serialization::output_archive oar(buf, flags);
+
+        C c{1234.8281, -1919, {{1.f, 2.f, 3.f}}, color::green, 'u'};
+        oar << c;
+
+        hpx::serialization::input_archive iar(buf, oar.bytes_written());
+        C deserialized_c;
+        iar >> deserialized_c;
+
+        HPX_TEST(c == deserialized_c);
+    }
+
+    {
+        std::vector<C> cs;
+        cs.reserve(n);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            float f = static_cast<float>(i);
+            cs.push_back(C{i * 0.5, static_cast<std::int32_t>(i) - 500,
+                {{f, f + 1.f, f + 2.f}}, i % 2 ? color::red : color::green,
+                static_cast<char>(i % 128)});
+        }
+
+        std::vector<char> buf;
+        hpx::serialization::output_archive oar(buf, flags);
+        oar << cs;
+
+        // the structs are stored as one block unless disabled
+        if (!(flags & hpx::serialization::disable_array_optimization))
+        {
+            HPX_TEST_LT(oar.bytes_written(), n * sizeof(C) + 64);
+        }
+
+        hpx::serialization::input_archive iar(buf, oar.bytes_written());
+        std::vector<C> deserialized_cs;
+        iar >> deserialized_cs;
+
+        HPX_TEST(cs == deserialized_cs);
+    }
+}
+
 int main()
 {
     std::vector<char> buf;
@@ -91,6 +175,11 @@ int main()
         HPX_TEST(b == deserialized_b);
     }
 
+    test_bitwise(0);
+    test_bitwise(hpx::serialization::endian_little);
+    test_bitwise(hpx::serialization::endian_big);
+    test_bitwise(hpx::serialization::disable_array_optimization);
+
     return hpx::util::report_errors();
 }
 #endif
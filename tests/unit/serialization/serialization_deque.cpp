@@ -13,6 +13,7 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <vector>
 
@@ -235,6 +236,24 @@ void test_non_default_constructible()
     }
 }
 
+// elements spanning several segments of the deque
+void test_bitwise(std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer, flags);
+    std::deque<double> os;
+    for (int k = 0; k < 10000; ++k)
+    {
+        os.push_front(k * 0.5);
+    }
+    oarchive << os;
+
+    hpx::serialization::input_archive iarchive(buffer);
+    std::deque<double> is;
+    iarchive >> is;
+    HPX_TEST(os == is);
+}
+
 int main()
 {
     test_bool();
@@ -273,5 +292,8 @@ int main()
 
     test_non_default_constructible();
 
+    test_bitwise(0);
+    test_bitwise(hpx::serialization::disable_array_optimization);
+
     return hpx::util::report_errors();
 }
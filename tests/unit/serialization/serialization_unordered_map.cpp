@@ -15,6 +15,7 @@
 #include <hpx/util/lightweight_test.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <numeric>
 #include <unordered_map>
@@ -123,6 +124,31 @@ void test_vector_as_value()
     }
 }
 
+// keys and values are transmitted as separate blocks
+void test_bitwise(std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer, flags);
+    std::unordered_map<int, double> os;
+    for (int k = 0; k < 10000; ++k)
+    {
+        os.insert(std::make_pair(k, k * 0.5));
+    }
+    oarchive << os;
+
+    if (!(flags & hpx::serialization::disable_array_optimization))
+    {
+        // the padding of the pairs is not transmitted
+        HPX_TEST_LT(buffer.size(),
+            os.size() * sizeof(std::pair<const int, double>));
+    }
+
+    hpx::serialization::input_archive iarchive(buffer);
+    std::unordered_map<int, double> is;
+    iarchive >> is;
+    HPX_TEST(os == is);
+}
+
 int main()
 {
     test<char>((std::numeric_limits<char>::min)(),
@@ -154,5 +180,8 @@ int main()
 
     test_vector_as_value();
 
+    test_bitwise(0);
+    test_bitwise(hpx::serialization::disable_array_optimization);
+
     return hpx::util::report_errors();
 }
@@ -9,9 +9,12 @@
 #include <hpx/include/actions.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/util/lightweight_test.hpp>
+#include <hpx/runtime/parcelset/receive_buffer.hpp>
 #include <hpx/runtime/serialization/serialize_buffer.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -128,6 +131,62 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Emulate a parcelport which receives the zero-copy chunks into
+// receive_buffers, large buffers have to take over that memory.
+template <typename T>
+void test_adopt_received_chunks(std::size_t size)
+{
+    hpx::serialization::serialize_buffer<T> send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+        send_buffer[i] = static_cast<T>(size - i);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(buffer, 0, &chunks);
+    oarchive << send_buffer;
+    std::size_t archive_size = oarchive.bytes_written();
+
+    std::vector<hpx::parcelset::receive_buffer> received(chunks.size());
+    std::vector<std::shared_ptr<char> > owners(chunks.size());
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        hpx::serialization::serialization_chunk& c = chunks[i];
+        if (c.type_ != hpx::serialization::chunk_type_pointer)
+            continue;
+
+        received[i].resize(c.size_);
+        std::memcpy(received[i].data(), c.data_.cpos_, c.size_);
+        c.data_.cpos_ = received[i].data();
+        owners[i] = received[i].shared_data();
+    }
+
+    hpx::serialization::serialize_buffer<T> recv_buffer;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, archive_size, &chunks, &owners);
+        iarchive >> recv_buffer;
+    }
+    received.clear();
+    owners.clear();
+
+    HPX_TEST_EQ(recv_buffer.size(), size);
+    HPX_TEST(std::equal(send_buffer.begin(), send_buffer.end(),
+        recv_buffer.begin()));
+
+    bool adopted = false;
+    for (hpx::serialization::serialization_chunk const& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer &&
+            c.data_.cpos_ == static_cast<void const*>(recv_buffer.data()))
+        {
+            adopted = true;
+        }
+    }
+    HPX_TEST_EQ(adopted,
+        size * sizeof(T) >= HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -151,6 +210,9 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<char>(size);
         test_fixed_size_initialization_for_persistent_buffers<float>(size);
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
+
+        test_adopt_received_chunks<char>(size);
+        test_adopt_received_chunks<double>(size);
     }
 
     return hpx::finalize();
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (C) 2011 Bryce Lelbach
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/compat/thread.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace compat = hpx::compat;
+
+// the deque starts small to make sure it has to grow while being stolen from
+boost::lockfree::chase_lev_deque<std::uint64_t> queue(4);
+
+std::vector<std::atomic<std::uint64_t>*> taken;
+std::atomic<bool> done(false);
+
+std::uint64_t threads = 4;
+std::uint64_t items = 500000;
+
+void take(std::uint64_t item)
+{
+    BOOST_TEST(item < items);
+    ++*taken[item];
+}
+
+// The owner pushes all items, every now and then it pops some of them back.
+void owner_thread()
+{
+    std::uint64_t r = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        queue.push(i);
+        if (i % 3 == 0 && queue.pop(r))
+            take(r);
+    }
+
+    while (queue.pop(r))
+        take(r);
+
+    done = true;
+}
+
+void thief_thread(std::uint64_t num_thread)
+{
+    std::uint64_t r = 0;
+    while (!done || !queue.empty())
+    {
+        if (num_thread % 2 == 0)
+        {
+            if (queue.steal(r))
+                take(r);
+        }
+        else
+        {
+            if (queue.steal_half(r, &take, 16) != 0)
+                take(r);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using boost::program_options::variables_map;
+    using boost::program_options::options_description;
+    using boost::program_options::value;
+    using boost::program_options::store;
+    using boost::program_options::command_line_parser;
+    using boost::program_options::notify;
+
+    variables_map vm;
+
+    options_description
+        desc_cmdline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of worker threads stealing objects from the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+
+    store(
+        command_line_parser(argc,
+            argv).options(desc_cmdline).allow_unregistered().run(),vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return boost::report_errors();
+    }
+
+    for (std::uint64_t i = 0; i != items; ++i)
+        taken.push_back(new std::atomic<std::uint64_t>(0));
+
+    {
+        std::vector<compat::thread> tg;
+
+        for (std::uint64_t i = 0; i != threads; ++i)
+            tg.push_back(compat::thread(hpx::util::bind(&thief_thread, i)));
+
+        tg.push_back(compat::thread(&owner_thread));
+
+        for (compat::thread& t : tg)
+        {
+            if (t.joinable())
+                t.join();
+        }
+    }
+
+    BOOST_TEST(queue.empty());
+
+    // every item has to be taken exactly once
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        BOOST_TEST_EQ(taken[i]->load(), std::uint64_t(1));
+        delete taken[i];
+    }
+
+    return boost::report_errors();
+}
@@ -91,6 +91,14 @@ int main(int argc, char* argv[])
         test_scheduler<scheduler_type>(argc, argv);
     }
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<
+                hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev
+            >;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
 #if defined(HPX_HAVE_ABP_SCHEDULER)
     {
         using scheduler_type =
@@ -0,0 +1,118 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threadmanager.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> count(0);
+
+void test_func()
+{
+    HPX_TEST(hpx::threads::get_self_id() != hpx::threads::invalid_thread_id);
+    HPX_TEST(hpx::threads::get_self().is_stackless());
+    HPX_TEST_EQ(hpx::threads::get_self_stacksize(),
+        std::size_t(hpx::threads::get_stack_size(
+            hpx::threads::thread_stacksize_nostack)));
+
+    // yielding is a no-op for stackless threads
+    hpx::this_thread::yield();
+
+    ++count;
+}
+
+void test_run_to_completion()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    std::vector<hpx::future<void> > tasks;
+    for (std::size_t i = 0; i != 100; ++i)
+        tasks.push_back(hpx::async(exec, &test_func));
+
+    hpx::wait_all(tasks);
+    for (auto& f : tasks)
+        HPX_TEST(!f.has_exception());
+
+    HPX_TEST_EQ(count.load(), std::size_t(100));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool child_func()
+{
+    return !hpx::threads::get_self().is_stackless();
+}
+
+hpx::future<bool> spawn_child()
+{
+    // threads created with the size of the current stack get a stack
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_current);
+    return hpx::async(exec, &child_func);
+}
+
+void test_children_have_stack()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    hpx::future<bool> f = hpx::async(exec, &spawn_child);
+    HPX_TEST(f.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void suspend_func()
+{
+    hpx::this_thread::suspend(hpx::threads::suspended);
+}
+
+void test_suspension_fails()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::async(exec, &suspend_func).get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_run_to_completion();
+    test_children_have_stack();
+    test_suspension_fails();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
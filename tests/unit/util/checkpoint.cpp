@@ -7,7 +7,10 @@
 // restore_checkpoint.
 //
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
@@ -223,5 +226,100 @@ int main()
     // Cleanup
     std::remove("test_file_10.txt");
 
+    // Test 11
+    //  test writing a checkpoint file and restoring from the mapped file
+    int integer11 = 42;
+    std::string str11 = "I am a string of characters";
+    std::vector<double> vec11(100000);
+    for (std::size_t i = 0; i != vec11.size(); ++i)
+    {
+        vec11[i] = i * 0.5;
+    }
+    hpx::future<std::vector<int>> fut11 = hpx::make_ready_future(test_vec);
+
+    hpx::util::save_checkpoint_file(
+        "test_file_11.ckp", integer11, str11, vec11, fut11).get();
+
+    {
+        hpx::util::checkpoint_file file11("test_file_11.ckp");
+        HPX_TEST_EQ(file11.size(), std::size_t(4));
+
+        int integer11_1;
+        std::string str11_1;
+        std::vector<double> vec11_1;
+        hpx::future<std::vector<int>> fut11_1;
+        restore_checkpoint(file11, integer11_1, str11_1, vec11_1, fut11_1);
+
+        HPX_TEST_EQ(integer11, integer11_1);
+        HPX_TEST_EQ(str11, str11_1);
+        HPX_TEST(vec11 == vec11_1);
+        HPX_TEST(test_vec == fut11_1.get());
+
+        // objects can be restored individually and in any order
+        std::vector<double> vec11_2;
+        std::string str11_2;
+        file11.restore(2, vec11_2);
+        file11.restore(1, str11_2);
+
+        HPX_TEST(vec11 == vec11_2);
+        HPX_TEST_EQ(str11, str11_2);
+    }
+
+    // Test 12
+    //  test rejecting files which are not checkpoint files
+    {
+        std::ofstream test_file_12("test_file_12.txt");
+        test_file_12 << save_checkpoint(hpx::launch::sync, vec11);
+        test_file_12.close();
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::util::checkpoint_file file12("test_file_12.txt");
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_data);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // Test 13
+    //  test rejecting a checkpoint file with a corrupted number of objects,
+    //  the size of the index computed from it overflows
+    {
+        std::ifstream test_file_11("test_file_11.ckp", std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(test_file_11)),
+            std::istreambuf_iterator<char>());
+        test_file_11.close();
+
+        // the number of objects follows the magic, the version and the
+        // byte order
+        std::uint64_t const num_objects = std::uint64_t(1) << 60;
+        std::memcpy(&contents[16], &num_objects, sizeof(num_objects));
+
+        std::ofstream test_file_13("test_file_13.ckp", std::ios::binary);
+        test_file_13 << contents;
+        test_file_13.close();
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::util::checkpoint_file file13("test_file_13.ckp");
+        }
+        catch (hpx::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.get_error(), hpx::invalid_data);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // Cleanup
+    std::remove("test_file_11.ckp");
+    std::remove("test_file_12.txt");
+    std::remove("test_file_13.ckp");
+
     return 0;
 }
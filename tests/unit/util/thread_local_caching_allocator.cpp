@@ -0,0 +1,119 @@
+//  Copyright (c) 2026 agent
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/thread_local_caching_allocator.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate_sizes()
+{
+    hpx::util::thread_local_caching_allocator<char> alloc;
+
+    // cover cached and non-cached block sizes alike
+    std::vector<std::pair<char*, std::size_t> > blocks;
+    for (std::size_t size = 1; size <= 2048; size = 2 * size + 1)
+    {
+        char* p = alloc.allocate(size);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) %
+            alignof(std::max_align_t), std::uintptr_t(0));
+        std::memset(p, int(size & 0xff), size);
+        blocks.emplace_back(p, size);
+    }
+
+    for (auto const& b : blocks)
+    {
+        for (std::size_t i = 0; i != b.second; ++i)
+            HPX_TEST_EQ(b.first[i], char(b.second & 0xff));
+        alloc.deallocate(b.first, b.second);
+    }
+
+#if HPX_HAVE_THREAD_LOCAL_ALLOCATOR_MAX_BLOCK_SIZE >= 32
+    // blocks are reused
+    char* p1 = alloc.allocate(32);
+    alloc.deallocate(p1, 32);
+    char* p2 = alloc.allocate(32);
+    HPX_TEST_EQ(p1, p2);
+    alloc.deallocate(p2, 32);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_container()
+{
+    std::vector<int, hpx::util::thread_local_caching_allocator<int> > v;
+    for (int i = 0; i != 1000; ++i)
+        v.push_back(i);
+
+    for (int i = 0; i != 1000; ++i)
+        HPX_TEST_EQ(v[i], i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// blocks may be released on a different thread than they were allocated on
+void test_release_on_other_thread()
+{
+    hpx::util::thread_local_caching_allocator<std::int64_t> alloc;
+
+    std::vector<hpx::future<std::int64_t*> > allocated;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        allocated.push_back(hpx::async(
+            [alloc, i]() mutable
+            {
+                std::int64_t* p = alloc.allocate(4);
+                p[0] = p[3] = std::int64_t(i);
+                return p;
+            }));
+    }
+
+    std::vector<hpx::future<void> > released;
+    std::size_t i = 0;
+    for (auto& f : allocated)
+    {
+        std::int64_t* p = f.get();
+        HPX_TEST_EQ(p[0], std::int64_t(i));
+        HPX_TEST_EQ(p[3], std::int64_t(i));
+        ++i;
+
+        released.push_back(hpx::async(
+            [alloc, p]() mutable
+            {
+                alloc.deallocate(p, 4);
+            }));
+    }
+    hpx::wait_all(released);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_allocate_sizes();
+    test_container();
+    test_release_on_other_thread();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}